@@ -142,6 +142,7 @@ let package = Package(
         "src/core/client_channel/global_subchannel_pool.h",
         "src/core/client_channel/local_subchannel_pool.cc",
         "src/core/client_channel/local_subchannel_pool.h",
+        "src/core/client_channel/pending_connectivity_updates.h",
         "src/core/client_channel/retry_filter.cc",
         "src/core/client_channel/retry_filter.h",
         "src/core/client_channel/retry_filter_legacy_call_data.cc",
@@ -1073,6 +1074,8 @@ let package = Package(
         "src/core/handshaker/proxy_mapper.h",
         "src/core/handshaker/proxy_mapper_registry.cc",
         "src/core/handshaker/proxy_mapper_registry.h",
+        "src/core/handshaker/security/handshake_executor.cc",
+        "src/core/handshaker/security/handshake_executor.h",
         "src/core/handshaker/security/secure_endpoint.cc",
         "src/core/handshaker/security/secure_endpoint.h",
         "src/core/handshaker/security/security_handshaker.cc",
@@ -1149,6 +1152,8 @@ let package = Package(
         "src/core/lib/event_engine/cf_engine/dns_service_resolver.h",
         "src/core/lib/event_engine/channel_args_endpoint_config.cc",
         "src/core/lib/event_engine/channel_args_endpoint_config.h",
+        "src/core/lib/event_engine/coarse_timer_queue.cc",
+        "src/core/lib/event_engine/coarse_timer_queue.h",
         "src/core/lib/event_engine/common_closures.h",
         "src/core/lib/event_engine/default_event_engine.cc",
         "src/core/lib/event_engine/default_event_engine.h",
@@ -1167,6 +1172,8 @@ let package = Package(
         "src/core/lib/event_engine/nameser.h",
         "src/core/lib/event_engine/poller.h",
         "src/core/lib/event_engine/posix.h",
+        "src/core/lib/event_engine/posix_engine/busy_poll.cc",
+        "src/core/lib/event_engine/posix_engine/busy_poll.h",
         "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc",
         "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.h",
         "src/core/lib/event_engine/posix_engine/ev_poll_posix.cc",
@@ -1198,6 +1205,8 @@ let package = Package(
         "src/core/lib/event_engine/posix_engine/timer_heap.h",
         "src/core/lib/event_engine/posix_engine/timer_manager.cc",
         "src/core/lib/event_engine/posix_engine/timer_manager.h",
+        "src/core/lib/event_engine/posix_engine/timer_wheel.cc",
+        "src/core/lib/event_engine/posix_engine/timer_wheel.h",
         "src/core/lib/event_engine/posix_engine/traced_buffer_list.cc",
         "src/core/lib/event_engine/posix_engine/traced_buffer_list.h",
         "src/core/lib/event_engine/posix_engine/wakeup_fd_eventfd.cc",
@@ -1219,6 +1228,8 @@ let package = Package(
         "src/core/lib/event_engine/tcp_socket_utils.h",
         "src/core/lib/event_engine/thread_local.cc",
         "src/core/lib/event_engine/thread_local.h",
+        "src/core/lib/event_engine/thread_pool/numa_topology.cc",
+        "src/core/lib/event_engine/thread_pool/numa_topology.h",
         "src/core/lib/event_engine/thread_pool/thread_count.cc",
         "src/core/lib/event_engine/thread_pool/thread_count.h",
         "src/core/lib/event_engine/thread_pool/thread_pool.h",
@@ -1589,6 +1600,8 @@ let package = Package(
         "src/core/lib/security/authorization/matchers.h",
         "src/core/lib/security/authorization/rbac_policy.cc",
         "src/core/lib/security/authorization/rbac_policy.h",
+        "src/core/lib/security/authorization/rbac_program.cc",
+        "src/core/lib/security/authorization/rbac_program.h",
         "src/core/lib/security/authorization/rbac_translator.cc",
         "src/core/lib/security/authorization/rbac_translator.h",
         "src/core/lib/security/authorization/stdout_logger.cc",
@@ -1748,6 +1761,7 @@ let package = Package(
         "src/core/lib/transport/bdp_estimator.h",
         "src/core/lib/transport/call_arena_allocator.cc",
         "src/core/lib/transport/call_arena_allocator.h",
+        "src/core/lib/transport/call_destination.cc",
         "src/core/lib/transport/call_filters.cc",
         "src/core/lib/transport/call_filters.h",
         "src/core/lib/transport/call_final_info.cc",
@@ -1937,11 +1951,15 @@ let package = Package(
         "src/core/tsi/local_transport_security.h",
         "src/core/tsi/ssl/key_logging/ssl_key_logging.cc",
         "src/core/tsi/ssl/key_logging/ssl_key_logging.h",
+        "src/core/tsi/ssl/ktls/ssl_ktls.cc",
+        "src/core/tsi/ssl/ktls/ssl_ktls.h",
         "src/core/tsi/ssl/session_cache/ssl_session.h",
         "src/core/tsi/ssl/session_cache/ssl_session_boringssl.cc",
         "src/core/tsi/ssl/session_cache/ssl_session_cache.cc",
         "src/core/tsi/ssl/session_cache/ssl_session_cache.h",
         "src/core/tsi/ssl/session_cache/ssl_session_openssl.cc",
+        "src/core/tsi/ssl/session_ticket/ssl_session_ticket_key_ring.cc",
+        "src/core/tsi/ssl/session_ticket/ssl_session_ticket_key_ring.h",
         "src/core/tsi/ssl_transport_security.cc",
         "src/core/tsi/ssl_transport_security.h",
         "src/core/tsi/ssl_transport_security_utils.cc",
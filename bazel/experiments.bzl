@@ -21,15 +21,18 @@ EXPERIMENT_ENABLES = {
     "call_v3": "call_v3",
     "canary_client_privacy": "canary_client_privacy",
     "client_privacy": "client_privacy",
+    "coarse_deadline_timers": "coarse_deadline_timers",
     "event_engine_client": "event_engine_client",
     "event_engine_dns": "event_engine_dns",
     "event_engine_listener": "event_engine_listener",
+    "event_engine_timer_wheel": "event_engine_timer_wheel",
     "free_large_allocator": "free_large_allocator",
     "http2_stats_fix": "http2_stats_fix",
     "keepalive_fix": "keepalive_fix",
     "keepalive_server_fix": "keepalive_server_fix",
     "monitoring_experiment": "monitoring_experiment",
     "multiping": "multiping",
+    "numa_aware_thread_pool": "numa_aware_thread_pool",
     "peer_state_based_framing": "peer_state_based_framing",
     "pending_queue_cap": "pending_queue_cap",
     "pick_first_new": "pick_first_new",
@@ -42,10 +45,13 @@ EXPERIMENT_ENABLES = {
     "server_privacy": "server_privacy",
     "tcp_frame_size_tuning": "tcp_frame_size_tuning",
     "tcp_rcv_lowat": "tcp_rcv_lowat",
+    "tls_kernel_offload": "tls_kernel_offload",
+    "tls_zero_copy_frame_protector": "tls_zero_copy_frame_protector",
     "trace_record_callops": "trace_record_callops",
     "unconstrained_max_quota_buffer_size": "unconstrained_max_quota_buffer_size",
     "work_serializer_clears_time_cache": "work_serializer_clears_time_cache",
     "work_serializer_dispatch": "event_engine_client,work_serializer_dispatch",
+    "work_serializer_run_budget": "work_serializer_run_budget",
 }
 
 EXPERIMENT_POLLERS = [
@@ -60,8 +66,12 @@ EXPERIMENTS = {
         },
         "off": {
             "core_end2end_test": [
+                "coarse_deadline_timers",
                 "event_engine_client",
                 "promise_based_server_call",
+                "tls_kernel_offload",
+                "tls_zero_copy_frame_protector",
+                "work_serializer_run_budget",
             ],
             "endpoint_test": [
                 "tcp_frame_size_tuning",
@@ -77,6 +87,9 @@ EXPERIMENTS = {
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
             ],
+            "lb_unit_test": [
+                "work_serializer_run_budget",
+            ],
             "logging_test": [
                 "promise_based_server_call",
             ],
@@ -108,7 +121,11 @@ EXPERIMENTS = {
         },
         "off": {
             "core_end2end_test": [
+                "coarse_deadline_timers",
                 "promise_based_server_call",
+                "tls_kernel_offload",
+                "tls_zero_copy_frame_protector",
+                "work_serializer_run_budget",
             ],
             "endpoint_test": [
                 "tcp_frame_size_tuning",
@@ -121,6 +138,9 @@ EXPERIMENTS = {
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
             ],
+            "lb_unit_test": [
+                "work_serializer_run_budget",
+            ],
             "logging_test": [
                 "promise_based_server_call",
             ],
@@ -147,9 +167,13 @@ EXPERIMENTS = {
         "off": {
             "core_end2end_test": [
                 "chaotic_good",
+                "coarse_deadline_timers",
                 "event_engine_client",
                 "promise_based_client_call",
                 "promise_based_server_call",
+                "tls_kernel_offload",
+                "tls_zero_copy_frame_protector",
+                "work_serializer_run_budget",
             ],
             "endpoint_test": [
                 "tcp_frame_size_tuning",
@@ -168,6 +192,9 @@ EXPERIMENTS = {
             "lame_client_test": [
                 "promise_based_client_call",
             ],
+            "lb_unit_test": [
+                "work_serializer_run_budget",
+            ],
             "logging_test": [
                 "promise_based_server_call",
             ],
@@ -1052,6 +1052,20 @@ GRPCAPI void grpc_tls_credentials_options_set_verify_server_cert(
 GRPCAPI void grpc_tls_credentials_options_set_send_client_ca_list(
     grpc_tls_credentials_options* options, bool send_client_ca_list);
 
+/**
+ * EXPERIMENTAL API - Subject to change
+ *
+ * Sets the file a TLS server reads its session ticket keys from, and how often
+ * it is re-read. The file holds 80 byte keys back to back: the first key
+ * encrypts new tickets and all of them decrypt the tickets that clients
+ * present, so that servers sharing the file can resume each other's sessions
+ * and keys can be rotated without invalidating the tickets in flight. If not
+ * set, each server encrypts its tickets with its own random key.
+ */
+GRPCAPI void grpc_tls_credentials_options_set_session_ticket_key_file(
+    grpc_tls_credentials_options* options, const char* path,
+    unsigned int refresh_interval_sec);
+
 /** --- SSL Session Cache. ---
 
     A SSL session cache object represents a way to cache client sessions
@@ -383,6 +383,14 @@
 /** Configure the Differentiated Services Code Point used on outgoing packets.
  *  Integer value ranging from 0 to 63. */
 #define GRPC_ARG_DSCP "grpc.dscp"
+/** EXPERIMENTAL. If set, listening sockets (and so the connections accepted
+ *  from them) request kernel busy polling with SO_BUSY_POLL for this many
+ *  microseconds, and prefer busy polling over interrupts where the kernel
+ *  supports SO_PREFER_BUSY_POLL. Raising SO_BUSY_POLL above the
+ *  net.core.busy_read sysctl requires CAP_NET_ADMIN; without it, the server
+ *  logs an error and listens without busy polling. Linux only. Int valued,
+ *  microseconds. Defaults to 0 (disabled). */
+#define GRPC_ARG_TCP_BUSY_POLL_USEC "grpc.tcp_busy_poll_usec"
 /** Connection Attempt Delay for use in Happy Eyeballs, in milliseconds.
  *  Defaults to 250ms. */
 #define GRPC_ARG_HAPPY_EYEBALLS_CONNECTION_ATTEMPT_DELAY_MS \
@@ -396,6 +404,19 @@
  * If unspecified, it is unlimited */
 #define GRPC_ARG_MAX_ALLOWED_INCOMING_CONNECTIONS \
   "grpc.max_allowed_incoming_connections"
+/** Configure the max number of security handshake steps (such as TLS
+ * handshake messages, including their signing and verification) that a server
+ * runs at the same time. If set, these steps run on the EventEngine instead of
+ * the thread that read the handshake data. If unspecified, handshake steps run
+ * inline and are not limited. */
+#define GRPC_ARG_MAX_CONCURRENT_HANDSHAKES "grpc.max_concurrent_handshakes"
+/** Configure the max number of security handshake steps that may wait for
+ * one of the GRPC_ARG_MAX_CONCURRENT_HANDSHAKES slots. Beyond it, new
+ * handshakes fail and incoming connections are rejected until the queue
+ * drains. With 0, handshakes never wait: they fail whenever all the
+ * GRPC_ARG_MAX_CONCURRENT_HANDSHAKES slots are busy, but connections are
+ * still accepted. If unspecified or negative, it is unlimited. */
+#define GRPC_ARG_MAX_QUEUED_HANDSHAKES "grpc.max_queued_handshakes"
 /** \} */
 
 #endif /* GRPC_IMPL_CHANNEL_ARG_NAMES_H */
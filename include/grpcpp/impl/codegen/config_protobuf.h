@@ -37,6 +37,11 @@
 #endif
 #endif
 
+#ifndef GRPC_CUSTOM_ARENA
+#include <google/protobuf/arena.h>
+#define GRPC_CUSTOM_ARENA ::google::protobuf::Arena
+#endif
+
 #ifndef GRPC_CUSTOM_DESCRIPTOR
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/descriptor.pb.h>
@@ -73,6 +78,22 @@
 #define GRPC_CUSTOM_CODEDINPUTSTREAM ::google::protobuf::io::CodedInputStream
 #endif
 
+#ifndef GRPC_CUSTOM_CODEDOUTPUTSTREAM
+#include <google/protobuf/io/coded_stream.h>
+#define GRPC_CUSTOM_CODEDOUTPUTSTREAM ::google::protobuf::io::CodedOutputStream
+#endif
+
+#ifndef GRPC_CUSTOM_STRINGOUTPUTSTREAM
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#define GRPC_CUSTOM_STRINGOUTPUTSTREAM \
+  ::google::protobuf::io::StringOutputStream
+#endif
+
+#ifndef GRPC_CUSTOM_WIREFORMATLITE
+#include <google/protobuf/wire_format_lite.h>
+#define GRPC_CUSTOM_WIREFORMATLITE ::google::protobuf::internal::WireFormatLite
+#endif
+
 #ifndef GRPC_CUSTOM_JSONUTIL
 #include <google/protobuf/util/json_util.h>
 #include <google/protobuf/util/type_resolver_util.h>
@@ -87,6 +108,8 @@ namespace protobuf {
 
 typedef GRPC_CUSTOM_MESSAGE Message;
 typedef GRPC_CUSTOM_MESSAGELITE MessageLite;
+typedef GRPC_CUSTOM_ARENA Arena;
+typedef GRPC_CUSTOM_WIREFORMATLITE WireFormatLite;
 
 typedef GRPC_CUSTOM_DESCRIPTOR Descriptor;
 typedef GRPC_CUSTOM_DESCRIPTORPOOL DescriptorPool;
@@ -113,6 +136,8 @@ namespace io {
 typedef GRPC_CUSTOM_ZEROCOPYOUTPUTSTREAM ZeroCopyOutputStream;
 typedef GRPC_CUSTOM_ZEROCOPYINPUTSTREAM ZeroCopyInputStream;
 typedef GRPC_CUSTOM_CODEDINPUTSTREAM CodedInputStream;
+typedef GRPC_CUSTOM_CODEDOUTPUTSTREAM CodedOutputStream;
+typedef GRPC_CUSTOM_STRINGOUTPUTSTREAM StringOutputStream;
 }  // namespace io
 
 }  // namespace protobuf
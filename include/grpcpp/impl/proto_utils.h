@@ -49,8 +49,14 @@ Status GenericSerialize(const grpc::protobuf::MessageLite& msg, ByteBuffer* bb,
                 "ProtoBufferWriter must be a subclass of "
                 "::protobuf::io::ZeroCopyOutputStream");
   *own_buffer = true;
+  // Computes and caches the sizes of the message and of its submessages, which
+  // the serialization below reuses rather than walking the message again.
   int byte_size = static_cast<int>(msg.ByteSizeLong());
-  if (static_cast<size_t>(byte_size) <= GRPC_SLICE_INLINED_SIZE) {
+  // The default writer would allocate a single slice of that size anyway:
+  // serialize directly into it, with the faster flat array serializer.
+  if (static_cast<size_t>(byte_size) <= GRPC_SLICE_INLINED_SIZE ||
+      (std::is_same<ProtoBufferWriter, grpc::ProtoBufferWriter>::value &&
+       byte_size <= kProtoBufferWriterMaxBufferLength)) {
     Slice slice(byte_size);
     // We serialize directly into the allocated slices memory
     CHECK(slice.end() == msg.SerializeWithCachedSizesToArray(
@@ -61,7 +67,10 @@ Status GenericSerialize(const grpc::protobuf::MessageLite& msg, ByteBuffer* bb,
     return grpc::Status::OK;
   }
   ProtoBufferWriter writer(bb, kProtoBufferWriterMaxBufferLength, byte_size);
-  return msg.SerializeToZeroCopyStream(&writer)
+  protobuf::io::CodedOutputStream output(&writer);
+  msg.SerializeWithCachedSizes(&output);
+  output.Trim();
+  return !output.HadError() && output.ByteCount() == byte_size
              ? grpc::Status::OK
              : Status(StatusCode::INTERNAL, "Failed to serialize message");
 }
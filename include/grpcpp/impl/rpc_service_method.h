@@ -36,6 +36,8 @@
 namespace grpc {
 class ServerContextBase;
 namespace internal {
+class InlineReactionBudget;
+
 /// Base class for running an RPC handler.
 class MethodHandler {
  public:
@@ -51,15 +53,19 @@ class MethodHandler {
     /// \param requester : used only by the callback API. It is a function
     ///        called by the RPC Controller to request another RPC (and also
     ///        to set up the state required to make that request possible)
+    /// \param inline_budget : used only by the callback API. It is set if the
+    ///        method was declared non-blocking, to run its reactions inline
     HandlerParameter(Call* c, grpc::ServerContextBase* context, void* req,
                      Status req_status, void* handler_data,
-                     std::function<void()> requester)
+                     std::function<void()> requester,
+                     InlineReactionBudget* inline_budget = nullptr)
         : call(c),
           server_context(context),
           request(req),
           status(req_status),
           internal_data(handler_data),
-          call_requester(std::move(requester)) {}
+          call_requester(std::move(requester)),
+          inline_reaction_budget(inline_budget) {}
     ~HandlerParameter() {}
     Call* const call;
     grpc::ServerContextBase* const server_context;
@@ -67,6 +73,7 @@ class MethodHandler {
     const Status status;
     void* const internal_data;
     const std::function<void()> call_requester;
+    InlineReactionBudget* const inline_reaction_budget;
   };
   virtual void RunHandler(const HandlerParameter& param) = 0;
 
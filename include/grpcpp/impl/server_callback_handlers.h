@@ -57,7 +57,8 @@ class CallbackUnaryHandler : public grpc::internal::MethodHandler {
                                             sizeof(ServerCallbackUnaryImpl)))
         ServerCallbackUnaryImpl(
             static_cast<grpc::CallbackServerContext*>(param.server_context),
-            param.call, allocator_state, param.call_requester);
+            param.call, allocator_state, param.call_requester,
+            param.inline_reaction_budget);
     param.server_context->BeginCompletionOp(
         param.call, [call](bool) { call->MaybeDone(); }, call);
 
@@ -164,7 +165,7 @@ class CallbackUnaryHandler : public grpc::internal::MethodHandler {
             reactor->OnSendInitialMetadataDone(ok);
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
-          &meta_ops_, /*can_inline=*/false);
+          &meta_ops_, inline_reaction_budget_);
       meta_ops_.SendInitialMetadata(&ctx_->initial_metadata_,
                                     ctx_->initial_metadata_flags());
       if (ctx_->compression_level_set()) {
@@ -181,11 +182,13 @@ class CallbackUnaryHandler : public grpc::internal::MethodHandler {
     ServerCallbackUnaryImpl(
         grpc::CallbackServerContext* ctx, grpc::internal::Call* call,
         MessageHolder<RequestType, ResponseType>* allocator_state,
-        std::function<void()> call_requester)
+        std::function<void()> call_requester,
+        grpc::internal::InlineReactionBudget* inline_reaction_budget)
         : ctx_(ctx),
           call_(*call),
           allocator_state_(allocator_state),
-          call_requester_(std::move(call_requester)) {
+          call_requester_(std::move(call_requester)),
+          inline_reaction_budget_(inline_reaction_budget) {
       ctx_->set_message_allocator_state(allocator_state);
     }
 
@@ -235,6 +238,9 @@ class CallbackUnaryHandler : public grpc::internal::MethodHandler {
     grpc::internal::Call call_;
     MessageHolder<RequestType, ResponseType>* const allocator_state_;
     std::function<void()> call_requester_;
+    // Set if the method was declared non-blocking, to run its reactions
+    // inline.
+    grpc::internal::InlineReactionBudget* const inline_reaction_budget_;
     // reactor_ can always be loaded/stored with relaxed memory ordering because
     // its value is only set once, independently of other data in the object,
     // and the loads that use it will always actually come provably later even
@@ -260,15 +266,27 @@ class CallbackClientStreamingHandler : public grpc::internal::MethodHandler {
           grpc::CallbackServerContext*, ResponseType*)>
           get_reactor)
       : get_reactor_(std::move(get_reactor)) {}
+
+  void SetMessageAllocator(
+      MessageAllocator<RequestType, ResponseType>* allocator) {
+    allocator_ = allocator;
+  }
+
   void RunHandler(const HandlerParameter& param) final {
     // Arena allocate a reader structure (that includes response)
     grpc_call_ref(param.call->call());
 
+    // Only the response of the allocated messages is used.
+    MessageHolder<RequestType, ResponseType>* allocator_state = nullptr;
+    if (allocator_ != nullptr) {
+      allocator_state = allocator_->AllocateMessages();
+    }
     auto* reader = new (grpc_call_arena_alloc(param.call->call(),
                                               sizeof(ServerCallbackReaderImpl)))
         ServerCallbackReaderImpl(
             static_cast<grpc::CallbackServerContext*>(param.server_context),
-            param.call, param.call_requester);
+            param.call, allocator_state, param.call_requester,
+            param.inline_reaction_budget);
     // Inlineable OnDone can be false in the CompletionOp callback because there
     // is no read reactor that has an inlineable OnDone; this only applies to
     // the DefaultReactor (which is unary).
@@ -301,6 +319,7 @@ class CallbackClientStreamingHandler : public grpc::internal::MethodHandler {
   std::function<ServerReadReactor<RequestType>*(grpc::CallbackServerContext*,
                                                 ResponseType*)>
       get_reactor_;
+  MessageAllocator<RequestType, ResponseType>* allocator_ = nullptr;
 
   class ServerCallbackReaderImpl : public ServerCallbackReader<RequestType> {
    public:
@@ -328,7 +347,7 @@ class CallbackClientStreamingHandler : public grpc::internal::MethodHandler {
       // The response is dropped if the status is not OK.
       if (s.ok()) {
         finish_ops_.ServerSendStatus(&ctx_->trailing_metadata_,
-                                     finish_ops_.SendMessagePtr(&resp_));
+                                     finish_ops_.SendMessagePtr(response()));
       } else {
         finish_ops_.ServerSendStatus(&ctx_->trailing_metadata_, s);
       }
@@ -350,7 +369,7 @@ class CallbackClientStreamingHandler : public grpc::internal::MethodHandler {
             reactor->OnSendInitialMetadataDone(ok);
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
-          &meta_ops_, /*can_inline=*/false);
+          &meta_ops_, inline_reaction_budget_);
       meta_ops_.SendInitialMetadata(&ctx_->initial_metadata_,
                                     ctx_->initial_metadata_flags());
       if (ctx_->compression_level_set()) {
@@ -370,10 +389,20 @@ class CallbackClientStreamingHandler : public grpc::internal::MethodHandler {
    private:
     friend class CallbackClientStreamingHandler<RequestType, ResponseType>;
 
-    ServerCallbackReaderImpl(grpc::CallbackServerContext* ctx,
-                             grpc::internal::Call* call,
-                             std::function<void()> call_requester)
-        : ctx_(ctx), call_(*call), call_requester_(std::move(call_requester)) {}
+    ServerCallbackReaderImpl(
+        grpc::CallbackServerContext* ctx, grpc::internal::Call* call,
+        MessageHolder<RequestType, ResponseType>* allocator_state,
+        std::function<void()> call_requester,
+        grpc::internal::InlineReactionBudget* inline_reaction_budget)
+        : ctx_(ctx),
+          call_(*call),
+          allocator_state_(allocator_state),
+          call_requester_(std::move(call_requester)),
+          inline_reaction_budget_(inline_reaction_budget) {
+      if (allocator_state_ != nullptr) {
+        ctx_->set_message_allocator_state(allocator_state_);
+      }
+    }
 
     grpc_call* call() override { return call_.call(); }
 
@@ -391,7 +420,7 @@ class CallbackClientStreamingHandler : public grpc::internal::MethodHandler {
             reactor->OnReadDone(ok);
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
-          &read_ops_, /*can_inline=*/false);
+          &read_ops_, inline_reaction_budget_);
       read_ops_.set_core_cq_tag(&read_tag_);
       this->BindReactor(reactor);
       this->MaybeCallOnCancel(reactor);
@@ -403,12 +432,18 @@ class CallbackClientStreamingHandler : public grpc::internal::MethodHandler {
 
     ~ServerCallbackReaderImpl() {}
 
-    ResponseType* response() { return &resp_; }
+    ResponseType* response() {
+      return allocator_state_ != nullptr ? allocator_state_->response()
+                                         : &resp_;
+    }
 
     void CallOnDone() override {
       reactor_.load(std::memory_order_relaxed)->OnDone();
       grpc_call* call = call_.call();
       auto call_requester = std::move(call_requester_);
+      if (allocator_state_ != nullptr) {
+        allocator_state_->Release();
+      }
       if (ctx_->context_allocator() != nullptr) {
         ctx_->context_allocator()->Release(ctx_);
       }
@@ -435,8 +470,12 @@ class CallbackClientStreamingHandler : public grpc::internal::MethodHandler {
 
     grpc::CallbackServerContext* const ctx_;
     grpc::internal::Call call_;
+    MessageHolder<RequestType, ResponseType>* const allocator_state_;
+    // Unused if the response is allocated by the message allocator.
     ResponseType resp_;
     std::function<void()> call_requester_;
+    // Follows ServerCallbackUnaryImpl.
+    grpc::internal::InlineReactionBudget* const inline_reaction_budget_;
     // The memory ordering of reactor_ follows ServerCallbackUnaryImpl.
     std::atomic<ServerReadReactor<RequestType>*> reactor_;
     // callbacks_outstanding_ follows a refcount pattern
@@ -453,6 +492,12 @@ class CallbackServerStreamingHandler : public grpc::internal::MethodHandler {
           grpc::CallbackServerContext*, const RequestType*)>
           get_reactor)
       : get_reactor_(std::move(get_reactor)) {}
+
+  void SetMessageAllocator(
+      MessageAllocator<RequestType, ResponseType>* allocator) {
+    allocator_ = allocator;
+  }
+
   void RunHandler(const HandlerParameter& param) final {
     // Arena allocate a writer structure
     grpc_call_ref(param.call->call());
@@ -462,7 +507,9 @@ class CallbackServerStreamingHandler : public grpc::internal::MethodHandler {
         ServerCallbackWriterImpl(
             static_cast<grpc::CallbackServerContext*>(param.server_context),
             param.call, static_cast<RequestType*>(param.request),
-            param.call_requester);
+            static_cast<MessageHolder<RequestType, ResponseType>*>(
+                param.internal_data),
+            param.call_requester, param.inline_reaction_budget);
     // Inlineable OnDone can be false in the CompletionOp callback because there
     // is no write reactor that has an inlineable OnDone; this only applies to
     // the DefaultReactor (which is unary).
@@ -491,18 +538,29 @@ class CallbackServerStreamingHandler : public grpc::internal::MethodHandler {
   }
 
   void* Deserialize(grpc_call* call, grpc_byte_buffer* req,
-                    grpc::Status* status, void** /*handler_data*/) final {
+                    grpc::Status* status, void** handler_data) final {
     grpc::ByteBuffer buf;
     buf.set_buffer(req);
-    auto* request =
-        new (grpc_call_arena_alloc(call, sizeof(RequestType))) RequestType();
+    RequestType* request;
+    if (allocator_ != nullptr) {
+      // Only the request of the allocated messages is used. The writer
+      // releases them, even if the request cannot be deserialized.
+      auto* allocator_state = allocator_->AllocateMessages();
+      *handler_data = allocator_state;
+      request = allocator_state->request();
+    } else {
+      request =
+          new (grpc_call_arena_alloc(call, sizeof(RequestType))) RequestType();
+    }
     *status =
         grpc::SerializationTraits<RequestType>::Deserialize(&buf, request);
     buf.Release();
     if (status->ok()) {
       return request;
     }
-    request->~RequestType();
+    if (allocator_ == nullptr) {
+      request->~RequestType();
+    }
     return nullptr;
   }
 
@@ -510,6 +568,7 @@ class CallbackServerStreamingHandler : public grpc::internal::MethodHandler {
   std::function<ServerWriteReactor<ResponseType>*(grpc::CallbackServerContext*,
                                                   const RequestType*)>
       get_reactor_;
+  MessageAllocator<RequestType, ResponseType>* allocator_ = nullptr;
 
   class ServerCallbackWriterImpl : public ServerCallbackWriter<ResponseType> {
    public:
@@ -554,7 +613,7 @@ class CallbackServerStreamingHandler : public grpc::internal::MethodHandler {
             reactor->OnSendInitialMetadataDone(ok);
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
-          &meta_ops_, /*can_inline=*/false);
+          &meta_ops_, inline_reaction_budget_);
       meta_ops_.SendInitialMetadata(&ctx_->initial_metadata_,
                                     ctx_->initial_metadata_flags());
       if (ctx_->compression_level_set()) {
@@ -594,13 +653,22 @@ class CallbackServerStreamingHandler : public grpc::internal::MethodHandler {
    private:
     friend class CallbackServerStreamingHandler<RequestType, ResponseType>;
 
-    ServerCallbackWriterImpl(grpc::CallbackServerContext* ctx,
-                             grpc::internal::Call* call, const RequestType* req,
-                             std::function<void()> call_requester)
+    ServerCallbackWriterImpl(
+        grpc::CallbackServerContext* ctx, grpc::internal::Call* call,
+        const RequestType* req,
+        MessageHolder<RequestType, ResponseType>* allocator_state,
+        std::function<void()> call_requester,
+        grpc::internal::InlineReactionBudget* inline_reaction_budget)
         : ctx_(ctx),
           call_(*call),
           req_(req),
-          call_requester_(std::move(call_requester)) {}
+          allocator_state_(allocator_state),
+          call_requester_(std::move(call_requester)),
+          inline_reaction_budget_(inline_reaction_budget) {
+      if (allocator_state_ != nullptr) {
+        ctx_->set_message_allocator_state(allocator_state_);
+      }
+    }
 
     grpc_call* call() override { return call_.call(); }
 
@@ -615,7 +683,7 @@ class CallbackServerStreamingHandler : public grpc::internal::MethodHandler {
             reactor->OnWriteDone(ok);
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
-          &write_ops_, /*can_inline=*/false);
+          &write_ops_, inline_reaction_budget_);
       write_ops_.set_core_cq_tag(&write_tag_);
       this->BindReactor(reactor);
       this->MaybeCallOnCancel(reactor);
@@ -625,7 +693,9 @@ class CallbackServerStreamingHandler : public grpc::internal::MethodHandler {
       this->MaybeDone(/*inlineable_ondone=*/false);
     }
     ~ServerCallbackWriterImpl() {
-      if (req_ != nullptr) {
+      if (allocator_state_ != nullptr) {
+        allocator_state_->Release();
+      } else if (req_ != nullptr) {
         req_->~RequestType();
       }
     }
@@ -664,7 +734,10 @@ class CallbackServerStreamingHandler : public grpc::internal::MethodHandler {
     grpc::CallbackServerContext* const ctx_;
     grpc::internal::Call call_;
     const RequestType* req_;
+    MessageHolder<RequestType, ResponseType>* const allocator_state_;
     std::function<void()> call_requester_;
+    // Follows ServerCallbackUnaryImpl.
+    grpc::internal::InlineReactionBudget* const inline_reaction_budget_;
     // The memory ordering of reactor_ follows ServerCallbackUnaryImpl.
     std::atomic<ServerWriteReactor<ResponseType>*> reactor_;
     // callbacks_outstanding_ follows a refcount pattern
@@ -688,7 +761,7 @@ class CallbackBidiHandler : public grpc::internal::MethodHandler {
         param.call->call(), sizeof(ServerCallbackReaderWriterImpl)))
         ServerCallbackReaderWriterImpl(
             static_cast<grpc::CallbackServerContext*>(param.server_context),
-            param.call, param.call_requester);
+            param.call, param.call_requester, param.inline_reaction_budget);
     // Inlineable OnDone can be false in the CompletionOp callback because there
     // is no bidi reactor that has an inlineable OnDone; this only applies to
     // the DefaultReactor (which is unary).
@@ -766,7 +839,7 @@ class CallbackBidiHandler : public grpc::internal::MethodHandler {
             reactor->OnSendInitialMetadataDone(ok);
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
-          &meta_ops_, /*can_inline=*/false);
+          &meta_ops_, inline_reaction_budget_);
       meta_ops_.SendInitialMetadata(&ctx_->initial_metadata_,
                                     ctx_->initial_metadata_flags());
       if (ctx_->compression_level_set()) {
@@ -811,10 +884,14 @@ class CallbackBidiHandler : public grpc::internal::MethodHandler {
    private:
     friend class CallbackBidiHandler<RequestType, ResponseType>;
 
-    ServerCallbackReaderWriterImpl(grpc::CallbackServerContext* ctx,
-                                   grpc::internal::Call* call,
-                                   std::function<void()> call_requester)
-        : ctx_(ctx), call_(*call), call_requester_(std::move(call_requester)) {}
+    ServerCallbackReaderWriterImpl(
+        grpc::CallbackServerContext* ctx, grpc::internal::Call* call,
+        std::function<void()> call_requester,
+        grpc::internal::InlineReactionBudget* inline_reaction_budget)
+        : ctx_(ctx),
+          call_(*call),
+          call_requester_(std::move(call_requester)),
+          inline_reaction_budget_(inline_reaction_budget) {}
 
     grpc_call* call() override { return call_.call(); }
 
@@ -829,7 +906,7 @@ class CallbackBidiHandler : public grpc::internal::MethodHandler {
             reactor->OnWriteDone(ok);
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
-          &write_ops_, /*can_inline=*/false);
+          &write_ops_, inline_reaction_budget_);
       write_ops_.set_core_cq_tag(&write_tag_);
       read_tag_.Set(
           call_.call(),
@@ -840,7 +917,7 @@ class CallbackBidiHandler : public grpc::internal::MethodHandler {
             reactor->OnReadDone(ok);
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
-          &read_ops_, /*can_inline=*/false);
+          &read_ops_, inline_reaction_budget_);
       read_ops_.set_core_cq_tag(&read_tag_);
       this->BindReactor(reactor);
       this->MaybeCallOnCancel(reactor);
@@ -885,6 +962,8 @@ class CallbackBidiHandler : public grpc::internal::MethodHandler {
     grpc::CallbackServerContext* const ctx_;
     grpc::internal::Call call_;
     std::function<void()> call_requester_;
+    // Follows ServerCallbackUnaryImpl.
+    grpc::internal::InlineReactionBudget* const inline_reaction_budget_;
     // The memory ordering of reactor_ follows ServerCallbackUnaryImpl.
     std::atomic<ServerBidiReactor<RequestType, ResponseType>*> reactor_;
     // callbacks_outstanding_ follows a refcount pattern
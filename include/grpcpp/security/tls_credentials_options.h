@@ -186,6 +186,14 @@ class TlsServerCredentialsOptions final : public TlsCredentialsOptions {
   // form a ServerHello, and hence will be unusable.
   void set_send_client_ca_list(bool send_client_ca_list);
 
+  // Sets the file the server reads its session ticket keys from, re-reading it
+  // every |refresh_interval_sec| seconds. The file holds 80 byte keys back to
+  // back; the first one encrypts new tickets and all of them decrypt the
+  // tickets presented by clients. Servers that share the file can resume each
+  // other's TLS sessions. If not set, the server uses a random key.
+  void set_session_ticket_key_file(const std::string& path,
+                                   unsigned int refresh_interval_sec);
+
  private:
 };
 
@@ -20,7 +20,9 @@
 #define GRPCPP_SERVER_H
 
 #include <list>
+#include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include <grpc/compression.h>
@@ -34,6 +36,7 @@
 #include <grpcpp/impl/rpc_service_method.h>
 #include <grpcpp/security/server_credentials.h>
 #include <grpcpp/server_interface.h>
+#include <grpcpp/support/callback_common.h>
 #include <grpcpp/support/channel_arguments.h>
 #include <grpcpp/support/client_interceptor.h>
 #include <grpcpp/support/config.h>
@@ -352,6 +355,10 @@ class Server : public ServerInterface, private internal::GrpcLibrary {
 
   // Interface to read or update server-wide metrics. Optional.
   experimental::ServerMetricRecorder* server_metric_recorder_ = nullptr;
+
+  // The budgets of the callback methods declared non-blocking, by name.
+  std::map<std::string, std::unique_ptr<internal::InlineReactionBudget>>
+      inline_reaction_budgets_;
 };
 
 }  // namespace grpc
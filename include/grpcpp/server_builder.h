@@ -19,9 +19,11 @@
 #ifndef GRPCPP_SERVER_BUILDER_H
 #define GRPCPP_SERVER_BUILDER_H
 
+#include <chrono>
 #include <climits>
 #include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include <grpc/compression.h>
@@ -291,6 +293,15 @@ class ServerBuilder {
     void EnableCallMetricRecording(
         experimental::ServerMetricRecorder* server_metric_recorder = nullptr);
 
+    /// Declares that the reactions of the callback method \a method_name
+    /// (such as "/package.Service/Method") do not block, OnDone included. They
+    /// then run inline on the thread that completed their operation, instead
+    /// of being dispatched to the executor. If one of them takes longer than
+    /// \a latency_budget, the reactions of the method are dispatched to the
+    /// executor from then on.
+    void SetNonBlockingMethod(const std::string& method_name,
+                              std::chrono::nanoseconds latency_budget);
+
    private:
     ServerBuilder* builder_;
   };
@@ -419,6 +430,7 @@ class ServerBuilder {
   std::shared_ptr<experimental::AuthorizationPolicyProviderInterface>
       authorization_provider_;
   experimental::ServerMetricRecorder* server_metric_recorder_ = nullptr;
+  std::map<std::string, std::chrono::nanoseconds> non_blocking_methods_;
 };
 
 }  // namespace grpc
@@ -19,7 +19,11 @@
 #ifndef GRPCPP_SUPPORT_CALLBACK_COMMON_H
 #define GRPCPP_SUPPORT_CALLBACK_COMMON_H
 
+#include <atomic>
+#include <chrono>
 #include <functional>
+#include <string>
+#include <utility>
 
 #include "absl/log/check.h"
 
@@ -35,6 +39,52 @@
 namespace grpc {
 namespace internal {
 
+/// The latency budget of the reactions of a callback method that the
+/// application declared non-blocking (see
+/// ServerBuilder::experimental_type::SetNonBlockingMethod). The reactions of
+/// such a method run inline on the thread that completed their operation
+/// instead of being dispatched to the executor, until one of them takes longer
+/// than the budget: the reactions of the method are dispatched to the executor
+/// from then on, as the ones of the other methods.
+class InlineReactionBudget {
+ public:
+  InlineReactionBudget(std::string method_name,
+                       std::chrono::nanoseconds latency_budget)
+      : method_name_(std::move(method_name)),
+        latency_budget_(latency_budget) {}
+
+  InlineReactionBudget(const InlineReactionBudget&) = delete;
+  InlineReactionBudget& operator=(const InlineReactionBudget&) = delete;
+
+  bool inlineable() const {
+    return inlineable_.load(std::memory_order_relaxed);
+  }
+
+  /// Records that a reaction of the method took \a latency.
+  void Record(std::chrono::nanoseconds latency) {
+    if (latency > latency_budget_ &&
+        inlineable_.exchange(false, std::memory_order_relaxed)) {
+      gpr_log(GPR_ERROR,
+              "A reaction of the non-blocking method %s took %lld us, more "
+              "than its budget of %lld us: its reactions are no longer run "
+              "inline",
+              method_name_.c_str(),
+              static_cast<long long>(
+                  std::chrono::duration_cast<std::chrono::microseconds>(latency)
+                      .count()),
+              static_cast<long long>(
+                  std::chrono::duration_cast<std::chrono::microseconds>(
+                      latency_budget_)
+                      .count()));
+    }
+  }
+
+ private:
+  const std::string method_name_;
+  const std::chrono::nanoseconds latency_budget_;
+  std::atomic<bool> inlineable_{true};
+};
+
 /// An exception-safe way of invoking a user-specified callback function
 // TODO(vjpai): decide whether it is better for this to take a const lvalue
 //              parameter or an rvalue parameter, or if it even matters
@@ -173,11 +223,21 @@ class CallbackWithSuccessTag : public grpc_completion_queue_functor {
     inlineable = can_inline;
   }
 
+  // Sets a callback invoking a user-controlled reaction of a server method.
+  // It is only executed inline if the method was declared non-blocking (\a
+  // budget is not null) and none of its reactions exceeded the budget so far.
+  void Set(grpc_call* call, std::function<void(bool)> f,
+           CompletionQueueTag* ops, InlineReactionBudget* budget) {
+    Set(call, std::move(f), ops, budget != nullptr && budget->inlineable());
+    budget_ = budget;
+  }
+
   void Clear() {
     if (call_ != nullptr) {
       grpc_call* call = call_;
       call_ = nullptr;
       func_ = nullptr;
+      budget_ = nullptr;
       grpc_call_unref(call);
     }
   }
@@ -197,6 +257,7 @@ class CallbackWithSuccessTag : public grpc_completion_queue_functor {
   grpc_call* call_;
   std::function<void(bool)> func_;
   CompletionQueueTag* ops_;
+  InlineReactionBudget* budget_ = nullptr;
 
   static void StaticRun(grpc_completion_queue_functor* cb, int ok) {
     static_cast<CallbackWithSuccessTag*>(cb)->Run(static_cast<bool>(ok));
@@ -214,7 +275,18 @@ class CallbackWithSuccessTag : public grpc_completion_queue_functor {
 #endif
 
     if (do_callback) {
+      // The callback may destroy this tag.
+      InlineReactionBudget* budget = budget_;
+      if (budget == nullptr) {
+        CatchingCallback(func_, ok);
+        return;
+      }
+      // The next operations using this tag are dispatched to the executor if
+      // a reaction of the method exceeded the budget.
+      if (!budget->inlineable()) inlineable = false;
+      auto start = std::chrono::steady_clock::now();
       CatchingCallback(func_, ok);
+      budget->Record(std::chrono::steady_clock::now() - start);
     }
   }
 };
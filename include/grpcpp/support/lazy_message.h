@@ -0,0 +1,144 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPCPP_SUPPORT_LAZY_MESSAGE_H
+#define GRPCPP_SUPPORT_LAZY_MESSAGE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <initializer_list>
+#include <string>
+#include <type_traits>
+
+#include <grpcpp/impl/codegen/config_protobuf.h>
+#include <grpcpp/impl/proto_utils.h>
+#include <grpcpp/impl/serialization_traits.h>
+#include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/support/proto_buffer_reader.h>
+#include <grpcpp/support/status.h>
+
+namespace grpc {
+
+/// A protobuf message of type \a ProtoMessage, kept serialized as received.
+///
+/// It can be used instead of \a ProtoMessage as the request or response type
+/// of the generic stubs and services (see TemplatedGenericStub), and of the
+/// templated reader and writer classes. Reading it does not parse anything:
+/// the handler decides whether to parse the whole message, only a few of its
+/// fields, or none at all. Writing it sends the received slices as they are,
+/// without copying them, which lets a proxy forward the messages that it does
+/// not modify.
+template <class ProtoMessage>
+class LazyMessage {
+  static_assert(
+      std::is_base_of<protobuf::MessageLite, ProtoMessage>::value,
+      "LazyMessage requires a protobuf message type");
+
+ public:
+  LazyMessage() = default;
+
+  /// Serializes \a message, for instance to send a modified message.
+  explicit LazyMessage(const ProtoMessage& message) {
+    bool own_buffer;
+    status_ = GenericSerialize<ProtoBufferWriter, ProtoMessage>(
+        message, &buffer_, &own_buffer);
+  }
+
+  /// The serialized message.
+  const ByteBuffer& buffer() const { return buffer_; }
+  ByteBuffer* mutable_buffer() { return &buffer_; }
+
+  /// The size of the serialized message.
+  size_t Length() const { return buffer_.Length(); }
+
+  /// Parses the whole message into \a message. The serialized message is kept,
+  /// so that it can still be forwarded.
+  Status Parse(ProtoMessage* message) const {
+    if (!status_.ok()) return status_;
+    ProtoBufferReader reader(&buffer_);
+    if (!reader.status().ok()) return reader.status();
+    if (!message->ParseFromZeroCopyStream(&reader)) {
+      return Status(StatusCode::INTERNAL, message->InitializationErrorString());
+    }
+    return Status::OK;
+  }
+
+  /// Parses only the fields of \a message whose numbers are listed in
+  /// \a field_numbers, leaving the others unset. The other fields are
+  /// skipped without being parsed, submessages included.
+  Status ParseFields(std::initializer_list<int> field_numbers,
+                     ProtoMessage* message) const {
+    if (!status_.ok()) return status_;
+    ProtoBufferReader reader(&buffer_);
+    if (!reader.status().ok()) return reader.status();
+    std::string selected_fields;
+    {
+      protobuf::io::CodedInputStream input(&reader);
+      protobuf::io::StringOutputStream output_stream(&selected_fields);
+      protobuf::io::CodedOutputStream output(&output_stream);
+      for (uint32_t tag = input.ReadTag(); tag != 0; tag = input.ReadTag()) {
+        int field_number = protobuf::WireFormatLite::GetTagFieldNumber(tag);
+        bool selected = std::find(field_numbers.begin(), field_numbers.end(),
+                                  field_number) != field_numbers.end();
+        if (!(selected
+                  ? protobuf::WireFormatLite::SkipField(&input, tag, &output)
+                  : protobuf::WireFormatLite::SkipField(&input, tag))) {
+          return Status(StatusCode::INTERNAL, "Failed to parse message");
+        }
+      }
+      if (!input.ConsumedEntireMessage()) {
+        return Status(StatusCode::INTERNAL, "Failed to parse message");
+      }
+    }
+    if (!message->ParsePartialFromString(selected_fields)) {
+      return Status(StatusCode::INTERNAL, "Failed to parse message");
+    }
+    return Status::OK;
+  }
+
+ private:
+  friend class SerializationTraits<LazyMessage<ProtoMessage>>;
+
+  // Only read by the const methods, but ProtoBufferReader takes a pointer.
+  mutable ByteBuffer buffer_;
+  // Whether the message passed to the constructor could be serialized.
+  Status status_;
+};
+
+template <class ProtoMessage>
+class SerializationTraits<LazyMessage<ProtoMessage>> {
+ public:
+  static Status Deserialize(ByteBuffer* byte_buffer,
+                            LazyMessage<ProtoMessage>* dest) {
+    dest->status_ = Status::OK;
+    return SerializationTraits<ByteBuffer>::Deserialize(byte_buffer,
+                                                        &dest->buffer_);
+  }
+  static Status Serialize(const LazyMessage<ProtoMessage>& source,
+                          ByteBuffer* buffer, bool* own_buffer) {
+    if (!source.status_.ok()) return source.status_;
+    return SerializationTraits<ByteBuffer>::Serialize(source.buffer_, buffer,
+                                                      own_buffer);
+  }
+};
+
+}  // namespace grpc
+
+#endif  // GRPCPP_SUPPORT_LAZY_MESSAGE_H
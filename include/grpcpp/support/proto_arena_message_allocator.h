@@ -0,0 +1,161 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPCPP_SUPPORT_PROTO_ARENA_MESSAGE_ALLOCATOR_H
+#define GRPCPP_SUPPORT_PROTO_ARENA_MESSAGE_ALLOCATOR_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+
+#include <grpcpp/impl/codegen/config_protobuf.h>
+#include <grpcpp/support/message_allocator.h>
+
+namespace grpc_core {
+class CallSizeEstimator;
+}  // namespace grpc_core
+
+namespace grpc {
+namespace internal {
+
+// The part of ProtoArenaMessageAllocator that does not depend on the message
+// types: caches the idle arenas per thread, and sizes the initial block of the
+// new ones from the space that the messages of the previous calls used, like
+// the call arenas are sized.
+//
+// Cached entries are matched to their pool by an id that is never reused, so
+// that a pool created at the address of a destroyed one does not pick up the
+// entries of the latter. Those are freed by the thread that destroys the pool
+// and, for the other threads, the next time they use any pool.
+class ProtoArenaPool final {
+ public:
+  // An arena of the pool.
+  class Entry {
+   public:
+    Entry(ProtoArenaPool* pool, size_t block_size)
+        : pool_(pool), pool_id_(pool->id()), block_size_(block_size) {}
+    virtual ~Entry() = default;
+
+    ProtoArenaPool* pool() const { return pool_; }
+    uint64_t pool_id() const { return pool_id_; }
+    size_t block_size() const { return block_size_; }
+
+   private:
+    ProtoArenaPool* const pool_;
+    const uint64_t pool_id_;
+    const size_t block_size_;
+  };
+
+  ProtoArenaPool();
+  ~ProtoArenaPool();
+
+  ProtoArenaPool(const ProtoArenaPool&) = delete;
+  ProtoArenaPool& operator=(const ProtoArenaPool&) = delete;
+
+  // Returns an idle entry of the pool cached by the calling thread, or nullptr
+  // if there is none large enough.
+  Entry* TakeCachedEntry();
+
+  // Returns the size of the initial block of the new entries.
+  size_t BlockSize() const;
+
+  // Caches \a entry in the calling thread, once the messages allocated on it
+  // are destroyed. \a space_used is the space that they used.
+  void ReturnEntry(Entry* entry, size_t space_used);
+
+  uint64_t id() const { return id_; }
+
+  // The number of entries, of any pool, cached by the calling thread.
+  static size_t CachedEntriesForTesting();
+
+ private:
+  const uint64_t id_;
+  grpc_core::CallSizeEstimator* const size_estimator_;
+};
+
+}  // namespace internal
+
+/// A MessageAllocator for callback methods that places the request and the
+/// response of each call on a protobuf Arena, as well as whatever the handler
+/// allocates on that arena (see google::protobuf::Arena::Create and the
+/// GetArena() method of the messages). The messages and their fields are then
+/// destroyed at once when the call is done, and the memory of the arena is
+/// reused by the next calls of the thread.
+///
+/// It can be set with the SetMessageAllocatorFor_<Method> method that the
+/// code generator adds to the callback services, for the unary, client
+/// streaming (for the response) and server streaming (for the request)
+/// methods. The allocator must outlive the server.
+template <typename RequestT, typename ResponseT>
+class ProtoArenaMessageAllocator final
+    : public MessageAllocator<RequestT, ResponseT> {
+ public:
+  MessageHolder<RequestT, ResponseT>* AllocateMessages() override {
+    auto* arena = static_cast<PooledArena*>(pool_.TakeCachedEntry());
+    if (arena == nullptr) {
+      arena = new PooledArena(&pool_, pool_.BlockSize());
+    }
+    return protobuf::Arena::Create<MessageHolderImpl>(arena->arena(), arena);
+  }
+
+ private:
+  class PooledArena final : public internal::ProtoArenaPool::Entry {
+   public:
+    PooledArena(internal::ProtoArenaPool* pool, size_t block_size)
+        : Entry(pool, block_size),
+          block_(new char[block_size]),
+          arena_(block_.get(), block_size) {}
+
+    protobuf::Arena* arena() { return &arena_; }
+
+   private:
+    std::unique_ptr<char[]> block_;
+    // Destroyed before its initial block.
+    protobuf::Arena arena_;
+  };
+
+  // Allocated on the arena of its messages.
+  class MessageHolderImpl final : public MessageHolder<RequestT, ResponseT> {
+   public:
+    explicit MessageHolderImpl(PooledArena* arena) : arena_(arena) {
+      this->set_request(
+          protobuf::Arena::CreateMessage<RequestT>(arena->arena()));
+      this->set_response(
+          protobuf::Arena::CreateMessage<ResponseT>(arena->arena()));
+    }
+
+    void Release() override {
+      PooledArena* arena = arena_;
+      size_t space_used = arena->arena()->SpaceUsed();
+      // Destroys the messages and this holder, and frees the blocks allocated
+      // beyond the initial one.
+      arena->arena()->Reset();
+      arena->pool()->ReturnEntry(arena, space_used);
+    }
+
+   private:
+    PooledArena* const arena_;
+  };
+
+  internal::ProtoArenaPool pool_;
+};
+
+}  // namespace grpc
+
+#endif  // GRPCPP_SUPPORT_PROTO_ARENA_MESSAGE_ALLOCATOR_H
@@ -1079,7 +1079,17 @@ void PrintHeaderServerMethodCallback(grpc_generator::Printer* printer,
         "               ::grpc::CallbackServerContext* context, "
         "$RealResponse$* "
         "response) { "
-        "return this->$Method$(context, response); }));\n");
+        "return this->$Method$(context, response); }));}\n");
+    printer->Print(*vars,
+                   "void SetMessageAllocatorFor_$Method$(\n"
+                   "    ::grpc::MessageAllocator< "
+                   "$RealRequest$, $RealResponse$>* allocator) {\n"
+                   "  ::grpc::internal::MethodHandler* const handler = "
+                   "::grpc::Service::GetHandler($Idx$);\n"
+                   "  static_cast<::grpc::internal::"
+                   "CallbackClientStreamingHandler< "
+                   "$RealRequest$, $RealResponse$>*>(handler)\n"
+                   "          ->SetMessageAllocator(allocator);\n");
   } else if (ServerOnlyStreaming(method)) {
     printer->Print(
         *vars,
@@ -1090,7 +1100,17 @@ void PrintHeaderServerMethodCallback(grpc_generator::Printer* printer,
         "               ::grpc::CallbackServerContext* context, "
         "const $RealRequest$* "
         "request) { "
-        "return this->$Method$(context, request); }));\n");
+        "return this->$Method$(context, request); }));}\n");
+    printer->Print(*vars,
+                   "void SetMessageAllocatorFor_$Method$(\n"
+                   "    ::grpc::MessageAllocator< "
+                   "$RealRequest$, $RealResponse$>* allocator) {\n"
+                   "  ::grpc::internal::MethodHandler* const handler = "
+                   "::grpc::Service::GetHandler($Idx$);\n"
+                   "  static_cast<::grpc::internal::"
+                   "CallbackServerStreamingHandler< "
+                   "$RealRequest$, $RealResponse$>*>(handler)\n"
+                   "          ->SetMessageAllocator(allocator);\n");
   } else if (method->BidiStreaming()) {
     printer->Print(*vars,
                    "  ::grpc::Service::MarkMethodCallback($Idx$,\n"
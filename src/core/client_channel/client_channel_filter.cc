@@ -58,6 +58,7 @@
 #include "src/core/client_channel/dynamic_filters.h"
 #include "src/core/client_channel/global_subchannel_pool.h"
 #include "src/core/client_channel/local_subchannel_pool.h"
+#include "src/core/client_channel/pending_connectivity_updates.h"
 #include "src/core/client_channel/retry_filter.h"
 #include "src/core/client_channel/subchannel.h"
 #include "src/core/client_channel/subchannel_interface_internal.h"
@@ -806,11 +807,24 @@ class ClientChannelFilter::SubchannelWrapper final
                 "subchannel %p; hopping into work_serializer",
                 parent_->chand_, parent_.get(), parent_->subchannel_.get());
       }
+      if (!pending_updates_.Push(state, status)) {
+        if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_trace)) {
+          gpr_log(GPR_INFO,
+                  "chand=%p: merged connectivity change for subchannel "
+                  "wrapper %p into pending update",
+                  parent_->chand_, parent_.get());
+        }
+        return;
+      }
       self.release();  // Held by callback.
       parent_->chand_->work_serializer_->Run(
-          [this, state, status]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(
+          [this]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(
               *parent_->chand_->work_serializer_) {
-            ApplyUpdateInControlPlaneWorkSerializer(state, status);
+            // Each callback applies the oldest pending update, since the
+            // work serializer runs them in order.
+            PendingConnectivityUpdates::Update update = pending_updates_.Pop();
+            ApplyUpdateInControlPlaneWorkSerializer(update.state,
+                                                    update.status);
             Unref();
           },
           DEBUG_LOCATION);
@@ -871,6 +885,7 @@ class ClientChannelFilter::SubchannelWrapper final
     std::unique_ptr<SubchannelInterface::ConnectivityStateWatcherInterface>
         watcher_;
     RefCountedPtr<SubchannelWrapper> parent_;
+    PendingConnectivityUpdates pending_updates_;
   };
 
   // A heterogenous lookup comparator for data watchers that allows
@@ -2102,6 +2117,14 @@ grpc_error_handle ClientChannelFilter::CallData::ApplyServiceConfigToCallLocked(
     return absl_status_to_grpc_error(
         MaybeRewriteIllegalStatusCode(call_config_status, "ConfigSelector"));
   }
+  // Leave the dynamic filters that have nothing to do for this call out of
+  // its stack. This runs after resolution_mu_ is released, as the first call
+  // needing a given stack builds it.
+  dynamic_filters_ = dynamic_filters_->WithoutInactiveFilters(
+      [&](const grpc_channel_filter* filter) {
+        return (*config_selector)
+            ->IsFilterActive(filter, *service_config_call_data);
+      });
   // Apply our own method params to the call.
   auto* method_params = static_cast<ClientChannelMethodParsedConfig*>(
       service_config_call_data->GetMethodParsedConfig(
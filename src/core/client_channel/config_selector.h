@@ -71,6 +71,16 @@ class ConfigSelector : public RefCounted<ConfigSelector> {
   // to determine what set of dynamic filters will be configured.
   virtual std::vector<const grpc_channel_filter*> GetFilters() { return {}; }
 
+  // Returns whether the filters of type `filter` returned by GetFilters()
+  // have anything to do for a call, given the config that GetCallConfig()
+  // selected for it.  The channel leaves the filters that are inactive for a
+  // call out of the call's dynamic filter stack, saving their call data and
+  // their dispatch.
+  virtual bool IsFilterActive(const grpc_channel_filter* /*filter*/,
+                              const ServiceConfigCallData& /*call_config*/) {
+    return true;
+  }
+
   // Returns the call config to use for the call, or a status to fail
   // the call with.
   virtual absl::Status GetCallConfig(GetCallConfigArgs args) = 0;
@@ -152,15 +152,54 @@ absl::StatusOr<RefCountedPtr<grpc_channel_stack>> CreateChannelStack(
 RefCountedPtr<DynamicFilters> DynamicFilters::Create(
     const ChannelArgs& args, std::vector<const grpc_channel_filter*> filters) {
   // Attempt to create channel stack from requested filters.
-  auto p = CreateChannelStack(args, std::move(filters));
+  auto p = CreateChannelStack(args, filters);
   if (!p.ok()) {
     // Channel stack creation failed with requested filters.
     // Create with lame filter instead.
     auto error = p.status();
     p = CreateChannelStack(args.Set(MakeLameClientErrorArg(&error)),
                            {&LameClientFilter::kFilter});
+    // Nothing to prune from the lame stack.
+    filters.clear();
   }
-  return MakeRefCounted<DynamicFilters>(std::move(p.value()));
+  return MakeRefCounted<DynamicFilters>(std::move(p.value()), args,
+                                        std::move(filters));
+}
+
+RefCountedPtr<DynamicFilters> DynamicFilters::WithoutInactiveFilters(
+    absl::FunctionRef<bool(const grpc_channel_filter*)> is_active) {
+  // The set of filters left out must fit in the bitmask.
+  if (filters_.size() > 64) return Ref();
+  uint64_t inactive = 0;
+  for (size_t i = 0; i + 1 < filters_.size(); ++i) {
+    if ((inactive & (uint64_t{1} << i)) != 0) continue;
+    if (is_active(filters_[i])) continue;
+    for (size_t j = i; j + 1 < filters_.size(); ++j) {
+      if (filters_[j] == filters_[i]) inactive |= uint64_t{1} << j;
+    }
+  }
+  if (inactive == 0) return Ref();
+  {
+    MutexLock lock(&mu_);
+    auto it = pruned_stacks_.find(inactive);
+    if (it != pruned_stacks_.end()) return it->second;
+  }
+  // Build the stack without holding mu_, so that calls using stacks that are
+  // already built do not wait for it.
+  std::vector<const grpc_channel_filter*> filters;
+  for (size_t i = 0; i < filters_.size(); ++i) {
+    if ((inactive & (uint64_t{1} << i)) == 0) {
+      filters.push_back(filters_[i]);
+    }
+  }
+  RefCountedPtr<DynamicFilters> stack = Create(args_, std::move(filters));
+  MutexLock lock(&mu_);
+  // Another call may have built the same stack in the meantime.
+  auto it = pruned_stacks_.find(inactive);
+  if (it == pruned_stacks_.end()) {
+    it = pruned_stacks_.emplace(inactive, std::move(stack)).first;
+  }
+  return it->second;
 }
 
 RefCountedPtr<DynamicFilters::Call> DynamicFilters::CreateCall(
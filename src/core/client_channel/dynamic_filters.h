@@ -19,9 +19,15 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stdint.h>
+
+#include <map>
 #include <utility>
 #include <vector>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/function_ref.h"
+
 #include <grpc/slice.h>
 
 #include "src/core/lib/channel/channel_args.h"
@@ -32,6 +38,7 @@
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/iomgr/call_combiner.h"
 #include "src/core/lib/iomgr/closure.h"
@@ -94,8 +101,19 @@ class DynamicFilters final : public RefCounted<DynamicFilters> {
   static RefCountedPtr<DynamicFilters> Create(
       const ChannelArgs& args, std::vector<const grpc_channel_filter*> filters);
 
-  explicit DynamicFilters(RefCountedPtr<grpc_channel_stack> channel_stack)
-      : channel_stack_(std::move(channel_stack)) {}
+  DynamicFilters(RefCountedPtr<grpc_channel_stack> channel_stack,
+                 ChannelArgs args,
+                 std::vector<const grpc_channel_filter*> filters)
+      : channel_stack_(std::move(channel_stack)),
+        args_(std::move(args)),
+        filters_(std::move(filters)) {}
+
+  // Returns the stack to use for a call: this one without the filters for
+  // which is_active returns false, created the first time a call needs it.
+  // All the filters of one type are kept or left out together, so that their
+  // instance ids do not change. The last filter is always kept.
+  RefCountedPtr<DynamicFilters> WithoutInactiveFilters(
+      absl::FunctionRef<bool(const grpc_channel_filter*)> is_active);
 
   RefCountedPtr<Call> CreateCall(Call::Args args, grpc_error_handle* error);
 
@@ -103,6 +121,13 @@ class DynamicFilters final : public RefCounted<DynamicFilters> {
 
  private:
   RefCountedPtr<grpc_channel_stack> channel_stack_;
+  // The arguments of Create(), to build the pruned stacks.
+  const ChannelArgs args_;
+  const std::vector<const grpc_channel_filter*> filters_;
+  Mutex mu_;
+  // The pruned stacks, by the set of filters left out (bit i for filters_[i]).
+  std::map<uint64_t, RefCountedPtr<DynamicFilters>> pruned_stacks_
+      ABSL_GUARDED_BY(mu_);
 };
 
 }  // namespace grpc_core
@@ -0,0 +1,88 @@
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_SRC_CORE_CLIENT_CHANNEL_PENDING_CONNECTIVITY_UPDATES_H
+#define GRPC_SRC_CORE_CLIENT_CHANNEL_PENDING_CONNECTIVITY_UPDATES_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+
+#include <deque>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/log/check.h"
+#include "absl/status/status.h"
+
+#include <grpc/impl/connectivity_state.h>
+
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/transport/transport.h"
+
+namespace grpc_core {
+
+// The connectivity state updates of a subchannel that are waiting for the
+// channel's work serializer, oldest first.
+//
+// An update to the same state as the newest waiting one is redundant: it is
+// merged into that one, which takes its status, unless the waiting one
+// carries keepalive throttling information.  That information must reach
+// the channel even when the state does not change.
+class PendingConnectivityUpdates {
+ public:
+  struct Update {
+    grpc_connectivity_state state;
+    absl::Status status;
+  };
+
+  // Adds an update.  Returns true if the caller needs to schedule a callback
+  // to Pop() it, or false if it was merged into a waiting update.
+  bool Push(grpc_connectivity_state state, const absl::Status& status) {
+    MutexLock lock(&mu_);
+    if (!updates_.empty() && updates_.back().state == state &&
+        !updates_.back()
+             .status.GetPayload(kKeepaliveThrottlingKey)
+             .has_value()) {
+      updates_.back().status = status;
+      return false;
+    }
+    updates_.push_back({state, status});
+    return true;
+  }
+
+  // Takes the oldest waiting update.  There must be one.
+  Update Pop() {
+    MutexLock lock(&mu_);
+    CHECK(!updates_.empty());
+    Update update = std::move(updates_.front());
+    updates_.pop_front();
+    return update;
+  }
+
+  size_t size() {
+    MutexLock lock(&mu_);
+    return updates_.size();
+  }
+
+ private:
+  Mutex mu_;
+  std::deque<Update> updates_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_CLIENT_CHANNEL_PENDING_CONNECTIVITY_UPDATES_H
@@ -147,6 +147,26 @@ FaultInjectionFilter::FaultInjectionFilter(ChannelFilter::Args filter_args)
       service_config_parser_index_(
           FaultInjectionServiceConfigParser::ParserIndex()) {}
 
+bool FaultInjectionFilter::IsActiveForCall(
+    const ServiceConfigCallData& call_config) {
+  auto* method_params = static_cast<FaultInjectionMethodParsedConfig*>(
+      call_config.GetMethodParsedConfig(
+          FaultInjectionServiceConfigParser::ParserIndex()));
+  if (method_params == nullptr) return true;
+  // Without an abort code or a delay, from the policy or from a header, the
+  // percentages are never used.
+  for (size_t i = 0;; ++i) {
+    const auto* fi_policy = method_params->fault_injection_policy(i);
+    if (fi_policy == nullptr) return false;
+    if (fi_policy->abort_code != GRPC_STATUS_OK ||
+        !fi_policy->abort_code_header.empty() ||
+        fi_policy->delay != Duration::Zero() ||
+        !fi_policy->delay_header.empty()) {
+      return true;
+    }
+  }
+}
+
 // Construct a promise for one call.
 ArenaPromise<absl::Status> FaultInjectionFilter::Call::OnClientInitialMetadata(
     ClientMetadata& md, FaultInjectionFilter* filter) {
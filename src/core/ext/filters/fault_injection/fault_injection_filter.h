@@ -33,6 +33,7 @@
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/promise/arena_promise.h"
 #include "src/core/lib/transport/transport.h"
+#include "src/core/service_config/service_config_call_data.h"
 
 namespace grpc_core {
 
@@ -50,6 +51,11 @@ class FaultInjectionFilter
 
   explicit FaultInjectionFilter(ChannelFilter::Args filter_args);
 
+  // Returns false if no fault injection policy of the call's method can
+  // inject a fault, in which case the filter can be left out of the call's
+  // stack.
+  static bool IsActiveForCall(const ServiceConfigCallData& call_config);
+
   // Construct a promise for one call.
   class Call {
    public:
@@ -221,6 +221,19 @@ bool IsConfiguredPath(absl::string_view configured_path,
 }
 }  // namespace
 
+bool StatefulSessionFilter::IsActiveForCall(
+    const ServiceConfigCallData& call_config) {
+  auto* method_params = static_cast<StatefulSessionMethodParsedConfig*>(
+      call_config.GetMethodParsedConfig(
+          StatefulSessionServiceConfigParser::ParserIndex()));
+  if (method_params == nullptr) return true;
+  for (size_t i = 0;; ++i) {
+    const auto* cookie_config = method_params->GetConfig(i);
+    if (cookie_config == nullptr) return false;
+    if (cookie_config->name.has_value()) return true;
+  }
+}
+
 void StatefulSessionFilter::Call::OnClientInitialMetadata(
     ClientMetadata& md, StatefulSessionFilter* filter) {
   // Get config.
@@ -79,6 +79,10 @@ class StatefulSessionFilter
 
   explicit StatefulSessionFilter(ChannelFilter::Args filter_args);
 
+  // Returns false if no cookie is configured for the call's method, in which
+  // case the filter can be left out of the call's stack.
+  static bool IsActiveForCall(const ServiceConfigCallData& call_config);
+
   class Call {
    public:
     void OnClientInitialMetadata(ClientMetadata& md,
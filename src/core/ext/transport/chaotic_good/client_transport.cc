@@ -221,11 +221,14 @@ void ChaoticGoodClientTransport::AbortWithError() {
   lock.Release();
   for (const auto& pair : stream_map) {
     auto call_handler = pair.second;
-    call_handler.SpawnInfallible("cancel", [call_handler]() mutable {
-      call_handler.PushServerTrailingMetadata(ServerMetadataFromStatus(
-          absl::UnavailableError("Transport closed.")));
-      return Empty{};
-    });
+    call_handler.SpawnInfallible(
+        "cancel",
+        [call_handler]() mutable {
+          call_handler.PushServerTrailingMetadata(ServerMetadataFromStatus(
+              absl::UnavailableError("Transport closed.")));
+          return Empty{};
+        },
+        PartyPriority::kUrgent);
   }
 }
 
@@ -323,10 +323,13 @@ auto ChaoticGoodServerTransport::ReadOneFrame(ChaoticGoodTransport& transport) {
                        call_initiator.has_value(),
                        [&call_initiator]() {
                          auto c = std::move(*call_initiator);
-                         return c.SpawnWaitable("cancel", [c]() mutable {
-                           c.Cancel();
-                           return absl::OkStatus();
-                         });
+                         return c.SpawnWaitable(
+                             "cancel",
+                             [c]() mutable {
+                               c.Cancel();
+                               return absl::OkStatus();
+                             },
+                             PartyPriority::kUrgent);
                        },
                        []() -> absl::Status {
                          return absl::InternalError("Unexpected cancel frame");
@@ -410,10 +413,13 @@ void ChaoticGoodServerTransport::AbortWithError() {
   lock.Release();
   for (const auto& pair : stream_map) {
     auto call_initiator = pair.second;
-    call_initiator.SpawnInfallible("cancel", [call_initiator]() mutable {
-      call_initiator.Cancel();
-      return Empty{};
-    });
+    call_initiator.SpawnInfallible(
+        "cancel",
+        [call_initiator]() mutable {
+          call_initiator.Cancel();
+          return Empty{};
+        },
+        PartyPriority::kUrgent);
   }
 }
 
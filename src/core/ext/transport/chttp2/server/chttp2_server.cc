@@ -53,6 +53,7 @@
 #include "src/core/ext/transport/chttp2/transport/legacy_frame.h"
 #include "src/core/handshaker/handshaker.h"
 #include "src/core/handshaker/handshaker_registry.h"
+#include "src/core/handshaker/security/handshake_executor.h"
 #include "src/core/lib/address_utils/sockaddr_utils.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/config/core_configuration.h"
@@ -792,6 +793,18 @@ Chttp2ServerListener::Chttp2ServerListener(
     connection_quota_->SetMaxIncomingConnections(
         max_allowed_incoming_connections.value());
   }
+  auto max_concurrent_handshakes =
+      args.GetInt(GRPC_ARG_MAX_CONCURRENT_HANDSHAKES);
+  if (max_concurrent_handshakes.has_value() &&
+      *max_concurrent_handshakes > 0) {
+    auto max_queued_handshakes = args.GetInt(GRPC_ARG_MAX_QUEUED_HANDSHAKES);
+    if (max_queued_handshakes.has_value()) {
+      connection_quota_->SetMaxQueuedHandshakes(*max_queued_handshakes);
+    }
+    args_ = args_.SetObject(MakeRefCounted<HandshakeExecutor>(
+        *max_concurrent_handshakes, connection_quota_,
+        args_.GetObjectRef<EventEngine>()));
+  }
   GRPC_CLOSURE_INIT(&tcp_server_shutdown_complete_, TcpServerShutdownComplete,
                     this, grpc_schedule_on_exec_ctx);
 }
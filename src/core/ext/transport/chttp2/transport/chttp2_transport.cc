@@ -579,8 +579,8 @@ static void init_keepalive_pings_if_enabled_locked(
   DCHECK(error.ok());
   if (t->keepalive_time != grpc_core::Duration::Infinity()) {
     t->keepalive_state = GRPC_CHTTP2_KEEPALIVE_STATE_WAITING;
-    t->keepalive_ping_timer_handle =
-        t->event_engine->RunAfter(t->keepalive_time, [t = t->Ref()]() mutable {
+    t->keepalive_ping_timer_handle = grpc_chttp2_keepalive_timer_run_after(
+        t.get(), t->keepalive_time, [t = t->Ref()]() mutable {
           grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
           grpc_core::ExecCtx exec_ctx;
           init_keepalive_ping(std::move(t));
@@ -611,6 +611,11 @@ grpc_chttp2_transport::grpc_chttp2_transport(
       event_engine(
           channel_args
               .GetObjectRef<grpc_event_engine::experimental::EventEngine>()),
+      keepalive_timers(
+          grpc_core::IsCoarseDeadlineTimersEnabled()
+              ? grpc_event_engine::experimental::CoarseTimerQueue::Get(
+                    event_engine)
+              : nullptr),
       combiner(grpc_combiner_create(event_engine)),
       state_tracker(is_client ? "client_transport" : "server_transport",
                     GRPC_CHANNEL_READY),
@@ -719,8 +724,9 @@ static void close_transport_locked(grpc_chttp2_transport* t,
     connectivity_state_set(t, GRPC_CHANNEL_SHUTDOWN, absl::Status(),
                            "close_transport");
     if (t->keepalive_ping_timeout_handle != TaskHandle::kInvalid) {
-      t->event_engine->Cancel(std::exchange(t->keepalive_ping_timeout_handle,
-                                            TaskHandle::kInvalid));
+      grpc_chttp2_keepalive_timer_cancel(
+          t, std::exchange(t->keepalive_ping_timeout_handle,
+                           TaskHandle::kInvalid));
     }
     if (t->settings_ack_watchdog != TaskHandle::kInvalid) {
       t->event_engine->Cancel(
@@ -737,13 +743,15 @@ static void close_transport_locked(grpc_chttp2_transport* t,
     switch (t->keepalive_state) {
       case GRPC_CHTTP2_KEEPALIVE_STATE_WAITING:
         if (t->keepalive_ping_timer_handle != TaskHandle::kInvalid &&
-            t->event_engine->Cancel(t->keepalive_ping_timer_handle)) {
+            grpc_chttp2_keepalive_timer_cancel(
+                t, t->keepalive_ping_timer_handle)) {
           t->keepalive_ping_timer_handle = TaskHandle::kInvalid;
         }
         break;
       case GRPC_CHTTP2_KEEPALIVE_STATE_PINGING:
         if (t->keepalive_ping_timer_handle != TaskHandle::kInvalid &&
-            t->event_engine->Cancel(t->keepalive_ping_timer_handle)) {
+            grpc_chttp2_keepalive_timer_cancel(
+                t, t->keepalive_ping_timer_handle)) {
           t->keepalive_ping_timer_handle = TaskHandle::kInvalid;
         }
         break;
@@ -2736,7 +2744,8 @@ static void read_action_locked(
               "%s[%p]: Clear keepalive timer because data was received",
               t->is_client ? "CLIENT" : "SERVER", t.get());
     }
-    t->event_engine->Cancel(
+    grpc_chttp2_keepalive_timer_cancel(
+        t.get(),
         std::exchange(t->keepalive_ping_timeout_handle, TaskHandle::kInvalid));
   }
   grpc_error_handle err = error;
@@ -2930,8 +2939,8 @@ static void init_keepalive_ping_locked(
       grpc_chttp2_initiate_write(t.get(),
                                  GRPC_CHTTP2_INITIATE_WRITE_KEEPALIVE_PING);
     } else {
-      t->keepalive_ping_timer_handle =
-          t->event_engine->RunAfter(t->keepalive_time, [t] {
+      t->keepalive_ping_timer_handle = grpc_chttp2_keepalive_timer_run_after(
+          t.get(), t->keepalive_time, [t] {
             grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
             grpc_core::ExecCtx exec_ctx;
             init_keepalive_ping(t);
@@ -2962,8 +2971,8 @@ static void finish_keepalive_ping_locked(
       }
       t->keepalive_state = GRPC_CHTTP2_KEEPALIVE_STATE_WAITING;
       CHECK(t->keepalive_ping_timer_handle == TaskHandle::kInvalid);
-      t->keepalive_ping_timer_handle =
-          t->event_engine->RunAfter(t->keepalive_time, [t] {
+      t->keepalive_ping_timer_handle = grpc_chttp2_keepalive_timer_run_after(
+          t.get(), t->keepalive_time, [t] {
             grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
             grpc_core::ExecCtx exec_ctx;
             init_keepalive_ping(t);
@@ -2972,9 +2981,27 @@ static void finish_keepalive_ping_locked(
   }
 }
 
+TaskHandle grpc_chttp2_keepalive_timer_run_after(
+    grpc_chttp2_transport* t,
+    grpc_event_engine::experimental::EventEngine::Duration delay,
+    absl::AnyInvocable<void()> callback) {
+  if (t->keepalive_timers != nullptr) {
+    return t->keepalive_timers->RunAfter(delay, std::move(callback));
+  }
+  return t->event_engine->RunAfter(delay, std::move(callback));
+}
+
+bool grpc_chttp2_keepalive_timer_cancel(grpc_chttp2_transport* t,
+                                        TaskHandle handle) {
+  if (t->keepalive_timers != nullptr) {
+    return t->keepalive_timers->Cancel(handle);
+  }
+  return t->event_engine->Cancel(handle);
+}
+
 static void maybe_reset_keepalive_ping_timer_locked(grpc_chttp2_transport* t) {
   if (t->keepalive_ping_timer_handle != TaskHandle::kInvalid &&
-      t->event_engine->Cancel(t->keepalive_ping_timer_handle)) {
+      grpc_chttp2_keepalive_timer_cancel(t, t->keepalive_ping_timer_handle)) {
     // Cancel succeeds, resets the keepalive ping timer. Note that we don't
     // need to Ref or Unref here since we still hold the Ref.
     if (GRPC_TRACE_FLAG_ENABLED(grpc_http_trace) ||
@@ -2982,8 +3009,8 @@ static void maybe_reset_keepalive_ping_timer_locked(grpc_chttp2_transport* t) {
       gpr_log(GPR_INFO, "%s: Keepalive ping cancelled. Resetting timer.",
               std::string(t->peer_string.as_string_view()).c_str());
     }
-    t->keepalive_ping_timer_handle =
-        t->event_engine->RunAfter(t->keepalive_time, [t = t->Ref()]() mutable {
+    t->keepalive_ping_timer_handle = grpc_chttp2_keepalive_timer_run_after(
+        t, t->keepalive_time, [t = t->Ref()]() mutable {
           grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
           grpc_core::ExecCtx exec_ctx;
           init_keepalive_ping(std::move(t));
@@ -27,6 +27,7 @@
 #include <utility>
 
 #include "absl/container/flat_hash_map.h"
+#include "absl/functional/any_invocable.h"
 #include "absl/random/random.h"
 #include "absl/status/status.h"
 #include "absl/strings/string_view.h"
@@ -61,6 +62,7 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/tcp_tracer.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/event_engine/coarse_timer_queue.h"
 #include "src/core/lib/gprpp/bitset.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/ref_counted.h"
@@ -264,6 +266,10 @@ struct grpc_chttp2_transport final
   grpc_core::ReclamationSweep active_reclamation;
 
   std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine;
+  /// Keepalive timers are re-armed on every read; if set, they go through
+  /// this queue instead of event_engine.
+  grpc_core::RefCountedPtr<grpc_event_engine::experimental::CoarseTimerQueue>
+      keepalive_timers;
   grpc_core::Combiner* combiner;
   absl::BitGen bitgen;
 
@@ -840,6 +846,19 @@ void grpc_chttp2_exceeded_ping_strikes(grpc_chttp2_transport* t);
 /// pings_before_data_required.
 void grpc_chttp2_reset_ping_clock(grpc_chttp2_transport* t);
 
+/// Arms a keepalive timer (keepalive_ping_timer_handle or
+/// keepalive_ping_timeout_handle) on t->keepalive_timers if set, or on
+/// t->event_engine otherwise.
+grpc_event_engine::experimental::EventEngine::TaskHandle
+grpc_chttp2_keepalive_timer_run_after(
+    grpc_chttp2_transport* t,
+    grpc_event_engine::experimental::EventEngine::Duration delay,
+    absl::AnyInvocable<void()> callback);
+/// Cancels a timer armed by grpc_chttp2_keepalive_timer_run_after.
+bool grpc_chttp2_keepalive_timer_cancel(
+    grpc_chttp2_transport* t,
+    grpc_event_engine::experimental::EventEngine::TaskHandle handle);
+
 /// add a ref to the stream and add it to the writable list;
 /// ref will be dropped in writing.c
 void grpc_chttp2_mark_stream_writable(grpc_chttp2_transport* t,
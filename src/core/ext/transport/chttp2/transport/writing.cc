@@ -746,8 +746,8 @@ void grpc_chttp2_end_write(grpc_chttp2_transport* t, grpc_error_handle error) {
                 t->is_client ? "CLIENT" : "SERVER", t,
                 t->keepalive_timeout.ToString().c_str());
       }
-      t->keepalive_ping_timeout_handle =
-          t->event_engine->RunAfter(t->keepalive_timeout, [t = t->Ref()] {
+      t->keepalive_ping_timeout_handle = grpc_chttp2_keepalive_timer_run_after(
+          t, t->keepalive_timeout, [t = t->Ref()] {
             grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
             grpc_core::ExecCtx exec_ctx;
             grpc_chttp2_keepalive_timeout(t);
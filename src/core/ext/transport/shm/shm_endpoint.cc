@@ -0,0 +1,353 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/shm/shm_endpoint.h"
+
+#include <utility>
+
+#include "absl/log/check.h"
+
+#include <grpc/event_engine/slice.h>
+#include <grpc/support/port_platform.h>
+
+namespace grpc_core {
+namespace shm {
+
+using grpc_event_engine::experimental::EventEngine;
+using grpc_event_engine::experimental::MutableSlice;
+using grpc_event_engine::experimental::Slice;
+using grpc_event_engine::experimental::SliceBuffer;
+
+///////////////////////////////////////////////////////////////////////////////
+// SharedMemoryConnection
+
+SharedMemoryConnection::SharedMemoryConnection(
+    RefCountedPtr<SharedMemorySegment> segment,
+    std::unique_ptr<EventEngine::Endpoint> doorbell,
+    std::shared_ptr<EventEngine> event_engine)
+    : segment_(std::move(segment)),
+      event_engine_(std::move(event_engine)),
+      peer_address_(doorbell->GetPeerAddress()),
+      local_address_(doorbell->GetLocalAddress()),
+      doorbell_(std::move(doorbell)) {}
+
+std::unique_ptr<EventEngine::Endpoint> SharedMemoryConnection::CreateEndpoint(
+    SharedMemoryRing rx, SharedMemoryRing tx) {
+  auto endpoint =
+      std::make_unique<SharedMemoryEndpoint>(Ref(), std::move(rx), std::move(tx));
+  MutexLock lock(&endpoints_mu_);
+  endpoints_.insert(endpoint.get());
+  return endpoint;
+}
+
+void SharedMemoryConnection::Start() { ReadDoorbell(); }
+
+void SharedMemoryConnection::RemoveEndpoint(SharedMemoryEndpoint* endpoint) {
+  bool last;
+  {
+    MutexLock lock(&endpoints_mu_);
+    endpoints_.erase(endpoint);
+    last = endpoints_.empty();
+  }
+  if (!last) return;
+  // Nobody is left to wake: drop the doorbell, which fails any in-flight
+  // doorbell operations and with them the references they hold on us. The
+  // peer observes the hangup as a failed doorbell read.
+  std::unique_ptr<EventEngine::Endpoint> doorbell;
+  {
+    MutexLock lock(&doorbell_mu_);
+    doorbell = std::move(doorbell_);
+  }
+}
+
+void SharedMemoryConnection::ReadDoorbell() {
+  while (true) {
+    {
+      MutexLock lock(&doorbell_mu_);
+      if (doorbell_ == nullptr) return;
+      read_buffer_.Clear();
+      if (!doorbell_->Read(
+              [self = Ref()](absl::Status status) {
+                self->OnDoorbellRead(std::move(status));
+              },
+              &read_buffer_, nullptr)) {
+        return;
+      }
+    }
+    WakeEndpoints(absl::OkStatus());
+  }
+}
+
+void SharedMemoryConnection::OnDoorbellRead(absl::Status status) {
+  if (!status.ok()) {
+    WakeEndpoints(std::move(status));
+    return;
+  }
+  WakeEndpoints(absl::OkStatus());
+  ReadDoorbell();
+}
+
+void SharedMemoryConnection::RingDoorbell() {
+  MutexLock lock(&doorbell_mu_);
+  if (doorbell_ == nullptr) return;
+  if (write_in_flight_) {
+    // Wakeups are idempotent: one more byte after the current write is
+    // enough to cover any number of rings in the meantime.
+    ring_pending_ = true;
+    return;
+  }
+  WriteDoorbellLocked();
+}
+
+void SharedMemoryConnection::WriteDoorbellLocked() {
+  do {
+    write_in_flight_ = true;
+    write_buffer_.Clear();
+    write_buffer_.Append(Slice::FromCopiedString("!"));
+    if (!doorbell_->Write(
+            [self = Ref()](absl::Status status) {
+              self->OnDoorbellWritten(std::move(status));
+            },
+            &write_buffer_, nullptr)) {
+      return;
+    }
+    write_in_flight_ = false;
+  } while (std::exchange(ring_pending_, false));
+}
+
+void SharedMemoryConnection::OnDoorbellWritten(absl::Status status) {
+  MutexLock lock(&doorbell_mu_);
+  write_in_flight_ = false;
+  if (!status.ok() || doorbell_ == nullptr) return;
+  if (std::exchange(ring_pending_, false)) WriteDoorbellLocked();
+}
+
+void SharedMemoryConnection::WakeEndpoints(absl::Status status) {
+  std::vector<SharedMemoryEndpoint::Completion> ready;
+  {
+    MutexLock lock(&endpoints_mu_);
+    for (SharedMemoryEndpoint* endpoint : endpoints_) {
+      if (status.ok()) {
+        endpoint->OnDoorbell(&ready);
+      } else {
+        endpoint->OnShutdown(status, &ready);
+      }
+    }
+  }
+  // Callbacks may destroy endpoints, so run them without holding any locks.
+  for (auto& completion : ready) {
+    completion.first(std::move(completion.second));
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// SharedMemoryEndpoint
+
+SharedMemoryEndpoint::SharedMemoryEndpoint(
+    RefCountedPtr<SharedMemoryConnection> connection, SharedMemoryRing rx,
+    SharedMemoryRing tx)
+    : connection_(std::move(connection)),
+      rx_(std::move(rx)),
+      tx_(std::move(tx)) {}
+
+SharedMemoryEndpoint::~SharedMemoryEndpoint() {
+  absl::AnyInvocable<void(absl::Status)> on_read;
+  absl::AnyInvocable<void(absl::Status)> on_write;
+  {
+    MutexLock lock(&mu_);
+    shutdown_status_ = absl::CancelledError("shared memory endpoint shutdown");
+    on_read = std::move(on_read_);
+    on_write = std::move(on_write_);
+  }
+  rx_.Close();
+  tx_.Close();
+  connection_->RingDoorbell();
+  connection_->RemoveEndpoint(this);
+  if (on_read != nullptr) {
+    FailAsync(std::move(on_read), absl::CancelledError("endpoint shutdown"));
+  }
+  if (on_write != nullptr) {
+    FailAsync(std::move(on_write), absl::CancelledError("endpoint shutdown"));
+  }
+}
+
+void SharedMemoryEndpoint::FailAsync(absl::AnyInvocable<void(absl::Status)> cb,
+                                     absl::Status status) {
+  connection_->event_engine()->Run(
+      [cb = std::move(cb), status = std::move(status)]() mutable {
+        cb(std::move(status));
+      });
+}
+
+bool SharedMemoryEndpoint::PollReadLocked(SliceBuffer* buffer,
+                                          absl::Status* status,
+                                          bool* wake_peer) {
+  while (true) {
+    const size_t available = rx_.ReadableBytes();
+    if (available > 0) {
+      MutableSlice slice = MutableSlice::CreateUninitialized(available);
+      const size_t n = rx_.Read(slice.data(), available);
+      DCHECK_EQ(n, available);
+      buffer->Append(Slice(std::move(slice)));
+      if (rx_.ConsumeSpaceWaiter()) *wake_peer = true;
+      *status = absl::OkStatus();
+      return true;
+    }
+    if (rx_.corrupted()) {
+      *status = absl::InternalError("shared memory peer corrupted the ring");
+      return true;
+    }
+    if (rx_.closed()) {
+      *status = absl::UnavailableError("shared memory peer closed");
+      return true;
+    }
+    // Only park if the ring is still empty once the producer is guaranteed
+    // to see our waiter flag; otherwise go around again.
+    if (rx_.PrepareToWaitForData()) return false;
+  }
+}
+
+bool SharedMemoryEndpoint::PollWriteLocked(SliceBuffer* data,
+                                           absl::Status* status,
+                                           bool* wake_peer) {
+  while (true) {
+    if (tx_.closed()) {
+      *status = absl::UnavailableError("shared memory peer closed");
+      return true;
+    }
+    size_t written = 0;
+    for (size_t i = 0; i < data->Count(); ++i) {
+      const Slice& slice = (*data)[i];
+      const size_t n = tx_.Write(slice.data(), slice.size());
+      written += n;
+      if (n < slice.size()) break;
+    }
+    if (tx_.corrupted()) {
+      *status = absl::InternalError("shared memory peer corrupted the ring");
+      return true;
+    }
+    if (written > 0) {
+      SliceBuffer consumed;
+      data->MoveFirstNBytesIntoSliceBuffer(written, consumed);
+      if (tx_.ConsumeDataWaiter()) *wake_peer = true;
+    }
+    if (data->Length() == 0) {
+      *status = absl::OkStatus();
+      return true;
+    }
+    if (tx_.PrepareToWaitForSpace()) return false;
+  }
+}
+
+bool SharedMemoryEndpoint::Read(absl::AnyInvocable<void(absl::Status)> on_read,
+                                SliceBuffer* buffer, const ReadArgs* /*args*/) {
+  absl::Status status;
+  bool wake_peer = false;
+  bool done;
+  {
+    MutexLock lock(&mu_);
+    CHECK(on_read_ == nullptr);
+    if (!shutdown_status_.ok()) {
+      status = shutdown_status_;
+      done = true;
+    } else {
+      done = PollReadLocked(buffer, &status, &wake_peer);
+      if (!done) {
+        on_read_ = std::move(on_read);
+        read_buffer_ = buffer;
+      }
+    }
+  }
+  if (wake_peer) connection_->RingDoorbell();
+  if (done && !status.ok()) {
+    FailAsync(std::move(on_read), std::move(status));
+    return false;
+  }
+  return done;
+}
+
+bool SharedMemoryEndpoint::Write(
+    absl::AnyInvocable<void(absl::Status)> on_writable, SliceBuffer* data,
+    const WriteArgs* /*args*/) {
+  absl::Status status;
+  bool wake_peer = false;
+  bool done;
+  {
+    MutexLock lock(&mu_);
+    CHECK(on_write_ == nullptr);
+    if (!shutdown_status_.ok()) {
+      status = shutdown_status_;
+      done = true;
+    } else {
+      done = PollWriteLocked(data, &status, &wake_peer);
+      if (!done) {
+        on_write_ = std::move(on_writable);
+        write_buffer_ = data;
+      }
+    }
+  }
+  if (wake_peer) connection_->RingDoorbell();
+  if (done && !status.ok()) {
+    FailAsync(std::move(on_writable), std::move(status));
+    return false;
+  }
+  return done;
+}
+
+void SharedMemoryEndpoint::OnDoorbell(std::vector<Completion>* ready) {
+  bool wake_peer = false;
+  {
+    MutexLock lock(&mu_);
+    absl::Status status;
+    if (on_read_ != nullptr &&
+        PollReadLocked(read_buffer_, &status, &wake_peer)) {
+      ready->emplace_back(std::move(on_read_), std::move(status));
+      on_read_ = nullptr;
+      read_buffer_ = nullptr;
+    }
+    if (on_write_ != nullptr &&
+        PollWriteLocked(write_buffer_, &status, &wake_peer)) {
+      ready->emplace_back(std::move(on_write_), std::move(status));
+      on_write_ = nullptr;
+      write_buffer_ = nullptr;
+    }
+  }
+  if (wake_peer) connection_->RingDoorbell();
+}
+
+void SharedMemoryEndpoint::OnShutdown(absl::Status status,
+                                      std::vector<Completion>* ready) {
+  MutexLock lock(&mu_);
+  if (shutdown_status_.ok()) shutdown_status_ = status;
+  if (on_read_ != nullptr) {
+    // Bytes already in the ring are still deliverable.
+    absl::Status read_status;
+    bool wake_peer = false;
+    if (rx_.ReadableBytes() == 0 ||
+        !PollReadLocked(read_buffer_, &read_status, &wake_peer)) {
+      read_status = status;
+    }
+    ready->emplace_back(std::move(on_read_), std::move(read_status));
+    on_read_ = nullptr;
+    read_buffer_ = nullptr;
+  }
+  if (on_write_ != nullptr) {
+    ready->emplace_back(std::move(on_write_), status);
+    on_write_ = nullptr;
+    write_buffer_ = nullptr;
+  }
+}
+
+}  // namespace shm
+}  // namespace grpc_core
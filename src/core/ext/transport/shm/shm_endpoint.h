@@ -0,0 +1,180 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_ENDPOINT_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_ENDPOINT_H
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/status/status.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/event_engine/slice_buffer.h>
+#include <grpc/support/port_platform.h>
+
+#include "src/core/ext/transport/shm/shm_ring.h"
+#include "src/core/ext/transport/shm/shm_segment.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+
+namespace grpc_core {
+namespace shm {
+
+class SharedMemoryEndpoint;
+
+// State shared by all endpoints that are multiplexed over one shared memory
+// segment: the mapping itself, and a doorbell endpoint connected to the peer.
+//
+// Payload bytes never cross the doorbell: it only carries single byte
+// wakeups, sent when the peer announced (via the ring waiter flags) that it is
+// about to block. Any byte received on the doorbell makes every endpoint on
+// this connection re-check its rings.
+class SharedMemoryConnection final
+    : public RefCounted<SharedMemoryConnection> {
+ public:
+  SharedMemoryConnection(
+      RefCountedPtr<SharedMemorySegment> segment,
+      std::unique_ptr<grpc_event_engine::experimental::EventEngine::Endpoint>
+          doorbell,
+      std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+          event_engine);
+
+  // Create an endpoint that reads from rx and writes to tx. Both rings must
+  // live inside this connection's segment.
+  std::unique_ptr<grpc_event_engine::experimental::EventEngine::Endpoint>
+  CreateEndpoint(SharedMemoryRing rx, SharedMemoryRing tx);
+
+  // Begin watching the doorbell. Call once, after creating the endpoints.
+  void Start();
+
+  // Wake the peer.
+  void RingDoorbell();
+
+  grpc_event_engine::experimental::EventEngine* event_engine() const {
+    return event_engine_.get();
+  }
+  const grpc_event_engine::experimental::EventEngine::ResolvedAddress&
+  peer_address() const {
+    return peer_address_;
+  }
+  const grpc_event_engine::experimental::EventEngine::ResolvedAddress&
+  local_address() const {
+    return local_address_;
+  }
+
+ private:
+  friend class SharedMemoryEndpoint;
+
+  void RemoveEndpoint(SharedMemoryEndpoint* endpoint);
+  void ReadDoorbell();
+  void OnDoorbellRead(absl::Status status);
+  void WriteDoorbellLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(doorbell_mu_);
+  void OnDoorbellWritten(absl::Status status);
+  // Retry (or, with a non-OK status, fail) every pending endpoint operation.
+  void WakeEndpoints(absl::Status status);
+
+  const RefCountedPtr<SharedMemorySegment> segment_;
+  const std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+      event_engine_;
+  const grpc_event_engine::experimental::EventEngine::ResolvedAddress
+      peer_address_;
+  const grpc_event_engine::experimental::EventEngine::ResolvedAddress
+      local_address_;
+
+  Mutex endpoints_mu_;
+  absl::flat_hash_set<SharedMemoryEndpoint*> endpoints_
+      ABSL_GUARDED_BY(endpoints_mu_);
+
+  Mutex doorbell_mu_;
+  std::unique_ptr<grpc_event_engine::experimental::EventEngine::Endpoint>
+      doorbell_ ABSL_GUARDED_BY(doorbell_mu_);
+  bool write_in_flight_ ABSL_GUARDED_BY(doorbell_mu_) = false;
+  bool ring_pending_ ABSL_GUARDED_BY(doorbell_mu_) = false;
+  grpc_event_engine::experimental::SliceBuffer write_buffer_
+      ABSL_GUARDED_BY(doorbell_mu_);
+  // Only touched by the (single) outstanding doorbell read.
+  grpc_event_engine::experimental::SliceBuffer read_buffer_;
+};
+
+// EventEngine endpoint whose bytes travel through a pair of shared memory
+// rings. Reads and writes complete inline whenever the rings allow it, and
+// otherwise park until the peer rings the connection's doorbell.
+class SharedMemoryEndpoint final
+    : public grpc_event_engine::experimental::EventEngine::Endpoint {
+ public:
+  SharedMemoryEndpoint(RefCountedPtr<SharedMemoryConnection> connection,
+                       SharedMemoryRing rx, SharedMemoryRing tx);
+  ~SharedMemoryEndpoint() override;
+
+  bool Read(absl::AnyInvocable<void(absl::Status)> on_read,
+            grpc_event_engine::experimental::SliceBuffer* buffer,
+            const ReadArgs* args) override;
+  bool Write(absl::AnyInvocable<void(absl::Status)> on_writable,
+             grpc_event_engine::experimental::SliceBuffer* data,
+             const WriteArgs* args) override;
+  const grpc_event_engine::experimental::EventEngine::ResolvedAddress&
+  GetPeerAddress() const override {
+    return connection_->peer_address();
+  }
+  const grpc_event_engine::experimental::EventEngine::ResolvedAddress&
+  GetLocalAddress() const override {
+    return connection_->local_address();
+  }
+
+ private:
+  friend class SharedMemoryConnection;
+
+  using Completion =
+      std::pair<absl::AnyInvocable<void(absl::Status)>, absl::Status>;
+
+  // Called by the connection with endpoints_mu_ held: retry pending
+  // operations, appending any that complete to ready.
+  void OnDoorbell(std::vector<Completion>* ready);
+  void OnShutdown(absl::Status status, std::vector<Completion>* ready);
+
+  // Attempt to make progress on a read (write). Returns true if the operation
+  // is finished, with its result in *status; returns false if it must wait
+  // for the doorbell. Sets *wake_peer if the peer must be woken.
+  bool PollReadLocked(grpc_event_engine::experimental::SliceBuffer* buffer,
+                      absl::Status* status, bool* wake_peer)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  bool PollWriteLocked(grpc_event_engine::experimental::SliceBuffer* data,
+                       absl::Status* status, bool* wake_peer)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void FailAsync(absl::AnyInvocable<void(absl::Status)> cb,
+                 absl::Status status);
+
+  const RefCountedPtr<SharedMemoryConnection> connection_;
+  SharedMemoryRing rx_;
+  SharedMemoryRing tx_;
+  Mutex mu_;
+  absl::Status shutdown_status_ ABSL_GUARDED_BY(mu_);
+  absl::AnyInvocable<void(absl::Status)> on_read_ ABSL_GUARDED_BY(mu_);
+  grpc_event_engine::experimental::SliceBuffer* read_buffer_
+      ABSL_GUARDED_BY(mu_) = nullptr;
+  absl::AnyInvocable<void(absl::Status)> on_write_ ABSL_GUARDED_BY(mu_);
+  grpc_event_engine::experimental::SliceBuffer* write_buffer_
+      ABSL_GUARDED_BY(mu_) = nullptr;
+};
+
+}  // namespace shm
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_ENDPOINT_H
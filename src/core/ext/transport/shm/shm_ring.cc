@@ -0,0 +1,161 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/shm/shm_ring.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <new>
+
+#include "absl/log/check.h"
+
+#include <grpc/support/port_platform.h>
+
+namespace grpc_core {
+namespace shm {
+
+static_assert(sizeof(uint64_t) == sizeof(long long) &&
+                  ATOMIC_LLONG_LOCK_FREE == 2,
+              "shared memory rings require address-free 64-bit atomics");
+static_assert(sizeof(uint32_t) == sizeof(int) && ATOMIC_INT_LOCK_FREE == 2,
+              "shared memory rings require address-free 32-bit atomics");
+
+SharedMemoryRing SharedMemoryRing::Create(void* memory, size_t capacity) {
+  CHECK_GE(capacity, kMinCapacity);
+  CHECK_EQ(capacity & (capacity - 1), 0u);
+  Header* header = new (memory) Header;
+  header->read_pos.store(0, std::memory_order_relaxed);
+  header->write_pos.store(0, std::memory_order_relaxed);
+  header->data_waiter.store(0, std::memory_order_relaxed);
+  header->space_waiter.store(0, std::memory_order_relaxed);
+  header->closed.store(0, std::memory_order_relaxed);
+  header->capacity = capacity;
+  header->magic = kMagic;
+  std::atomic_thread_fence(std::memory_order_release);
+  return SharedMemoryRing(header, reinterpret_cast<uint8_t*>(header + 1),
+                          capacity);
+}
+
+SharedMemoryRing SharedMemoryRing::Attach(void* memory, size_t capacity) {
+  std::atomic_thread_fence(std::memory_order_acquire);
+  Header* header = static_cast<Header*>(memory);
+  if (header->magic != kMagic || header->capacity != capacity) {
+    return SharedMemoryRing();
+  }
+  SharedMemoryRing ring(header, reinterpret_cast<uint8_t*>(header + 1),
+                        capacity);
+  // The peer may already have used the ring by the time this side attaches.
+  const uint64_t read_pos = header->read_pos.load(std::memory_order_acquire);
+  const uint64_t write_pos = header->write_pos.load(std::memory_order_acquire);
+  if (write_pos < read_pos || write_pos - read_pos > capacity) {
+    return SharedMemoryRing();
+  }
+  ring.read_pos_ = read_pos;
+  ring.write_pos_ = write_pos;
+  return ring;
+}
+
+bool SharedMemoryRing::LoadWritePos(std::memory_order order) {
+  if (corrupted_) return false;
+  const uint64_t write_pos = header_->write_pos.load(order);
+  if (write_pos < write_pos_ || write_pos - read_pos_ > capacity_) {
+    corrupted_ = true;
+    return false;
+  }
+  write_pos_ = write_pos;
+  return true;
+}
+
+bool SharedMemoryRing::LoadReadPos(std::memory_order order) {
+  if (corrupted_) return false;
+  const uint64_t read_pos = header_->read_pos.load(order);
+  if (read_pos < read_pos_ || read_pos > write_pos_) {
+    corrupted_ = true;
+    return false;
+  }
+  read_pos_ = read_pos;
+  return true;
+}
+
+size_t SharedMemoryRing::ReadableBytes() {
+  if (!LoadWritePos(std::memory_order_acquire)) return 0;
+  return static_cast<size_t>(write_pos_ - read_pos_);
+}
+
+size_t SharedMemoryRing::WritableBytes() {
+  if (!LoadReadPos(std::memory_order_acquire)) return 0;
+  return capacity_ - static_cast<size_t>(write_pos_ - read_pos_);
+}
+
+size_t SharedMemoryRing::Write(const uint8_t* data, size_t length) {
+  // Only the producer advances write_pos, so our copy of it is the reference.
+  const size_t n = std::min(WritableBytes(), length);
+  if (n == 0) return 0;
+  const size_t offset = static_cast<size_t>(write_pos_ & (capacity_ - 1));
+  const size_t first = std::min(n, capacity_ - offset);
+  memcpy(data_ + offset, data, first);
+  memcpy(data_, data + first, n - first);
+  write_pos_ += n;
+  header_->write_pos.store(write_pos_, std::memory_order_seq_cst);
+  return n;
+}
+
+size_t SharedMemoryRing::Read(uint8_t* data, size_t length) {
+  // Only the consumer advances read_pos, so our copy of it is the reference.
+  const size_t n = std::min(ReadableBytes(), length);
+  if (n == 0) return 0;
+  const size_t offset = static_cast<size_t>(read_pos_ & (capacity_ - 1));
+  const size_t first = std::min(n, capacity_ - offset);
+  memcpy(data, data_ + offset, first);
+  memcpy(data + first, data_, n - first);
+  read_pos_ += n;
+  header_->read_pos.store(read_pos_, std::memory_order_seq_cst);
+  return n;
+}
+
+bool SharedMemoryRing::PrepareToWaitForData() {
+  header_->data_waiter.store(1, std::memory_order_seq_cst);
+  return LoadWritePos(std::memory_order_seq_cst) && write_pos_ == read_pos_;
+}
+
+bool SharedMemoryRing::ConsumeDataWaiter() {
+  if (header_->data_waiter.load(std::memory_order_seq_cst) == 0) return false;
+  return header_->data_waiter.exchange(0, std::memory_order_seq_cst) != 0;
+}
+
+bool SharedMemoryRing::PrepareToWaitForSpace() {
+  header_->space_waiter.store(1, std::memory_order_seq_cst);
+  return LoadReadPos(std::memory_order_seq_cst) &&
+         write_pos_ - read_pos_ == capacity_;
+}
+
+bool SharedMemoryRing::ConsumeSpaceWaiter() {
+  if (header_->space_waiter.load(std::memory_order_seq_cst) == 0) {
+    return false;
+  }
+  return header_->space_waiter.exchange(0, std::memory_order_seq_cst) != 0;
+}
+
+void SharedMemoryRing::Close() {
+  header_->closed.store(1, std::memory_order_release);
+}
+
+bool SharedMemoryRing::closed() const {
+  return header_->closed.load(std::memory_order_acquire) != 0;
+}
+
+}  // namespace shm
+}  // namespace grpc_core
@@ -0,0 +1,138 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_RING_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_RING_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+
+#include <grpc/support/port_platform.h>
+
+namespace grpc_core {
+namespace shm {
+
+// Single-producer single-consumer byte ring that lives in memory shared
+// between two peers (possibly in different processes).
+//
+// The ring does not own its memory: it is a view over a region of
+// RequiredBytes(capacity) bytes that starts with a control header followed by
+// the data area. Read and write positions are free running 64-bit counters, so
+// the ring never needs a separate "full" flag.
+//
+// The peer can write the header, so the positions it publishes are never
+// trusted: each side keeps its own copy of the position it advances, and checks
+// that the peer's position only moves forward and stays within capacity of its
+// own. Once a check fails the ring is corrupted(): it moves no more bytes, and
+// its owner is expected to fail the connection.
+//
+// Besides moving bytes, the header carries two waiter flags that let a peer
+// announce it is about to block (waiting for data, or for space). The other
+// side checks the flag after publishing progress and, if set, must wake the
+// waiter through some out of band doorbell. Both sides use sequentially
+// consistent operations on the flag/position pairs so a wakeup cannot be lost.
+class SharedMemoryRing {
+ public:
+  // Capacity must be a power of two.
+  static constexpr size_t kMinCapacity = 4096;
+
+  static size_t RequiredBytes(size_t capacity) {
+    return sizeof(Header) + capacity;
+  }
+
+  SharedMemoryRing() = default;
+  // Initialize a fresh ring over memory. Exactly one peer must call this,
+  // before the other peer attaches.
+  static SharedMemoryRing Create(void* memory, size_t capacity);
+  // Attach to a ring previously initialized by Create(), possibly already in
+  // use by the peer. Returns an invalid ring (valid() == false) if the header
+  // does not describe a consistent ring of the expected capacity.
+  static SharedMemoryRing Attach(void* memory, size_t capacity);
+
+  bool valid() const { return header_ != nullptr; }
+  size_t capacity() const { return capacity_; }
+
+  // Producer side: copy up to length bytes into the ring, returns the number
+  // of bytes copied (possibly zero if the ring is full or corrupted).
+  size_t Write(const uint8_t* data, size_t length);
+  // Consumer side: copy up to length bytes out of the ring, returns the
+  // number of bytes copied (possibly zero if the ring is empty or corrupted).
+  size_t Read(uint8_t* data, size_t length);
+
+  // Consumer side: the number of bytes that Read() can copy.
+  size_t ReadableBytes();
+  // Producer side: the number of bytes that Write() can copy.
+  size_t WritableBytes();
+
+  // True once the peer has moved its position backwards, or further than the
+  // capacity allows.
+  bool corrupted() const { return corrupted_; }
+
+  // Consumer side: announce that we're about to wait for data. Returns true if
+  // the ring is still empty after the announcement, in which case the
+  // producer is guaranteed to see the announcement after its next Write().
+  bool PrepareToWaitForData();
+  // Producer side: returns true (and clears the flag) if the consumer was
+  // waiting for data and needs to be woken.
+  bool ConsumeDataWaiter();
+  // Producer side: announce that we're about to wait for space. Returns true
+  // if the ring is still full after the announcement.
+  bool PrepareToWaitForSpace();
+  // Consumer side: returns true (and clears the flag) if the producer was
+  // waiting for space and needs to be woken.
+  bool ConsumeSpaceWaiter();
+
+  // Mark the ring closed: either side may call this, after which the peer
+  // will see closed() == true. Buffered bytes remain readable.
+  void Close();
+  bool closed() const;
+
+ private:
+  static constexpr uint32_t kMagic = 0x67524d53;  // "gRMS"
+
+  struct Header {
+    alignas(64) std::atomic<uint64_t> read_pos;
+    alignas(64) std::atomic<uint64_t> write_pos;
+    alignas(64) std::atomic<uint32_t> data_waiter;
+    std::atomic<uint32_t> space_waiter;
+    std::atomic<uint32_t> closed;
+    uint32_t magic;
+    uint64_t capacity;
+  };
+
+  SharedMemoryRing(Header* header, uint8_t* data, size_t capacity)
+      : header_(header), data_(data), capacity_(capacity) {}
+
+  // Load the position advanced by the peer, and check it against the last
+  // value seen and against our own position. Returns false (and marks the
+  // ring corrupted) if the check fails.
+  bool LoadWritePos(std::memory_order order);
+  bool LoadReadPos(std::memory_order order);
+
+  Header* header_ = nullptr;
+  uint8_t* data_ = nullptr;
+  size_t capacity_ = 0;
+  // Positions as last seen (for the peer's) or advanced (for our own) by this
+  // side. Both start at zero, as Create() leaves them.
+  uint64_t read_pos_ = 0;
+  uint64_t write_pos_ = 0;
+  bool corrupted_ = false;
+};
+
+}  // namespace shm
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_RING_H
@@ -0,0 +1,240 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/shm/shm_segment.h"
+
+#include <grpc/support/port_platform.h>
+
+#ifdef GPR_SUPPORT_CHANNELS_FROM_FD
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifdef GPR_LINUX
+#include <sys/syscall.h>
+#endif
+
+#include <cstring>
+
+#include "absl/random/random.h"
+#include "absl/strings/str_cat.h"
+
+#include "src/core/lib/gprpp/strerror.h"
+
+namespace grpc_core {
+namespace shm {
+
+namespace {
+
+absl::Status ErrnoStatus(absl::string_view what) {
+  return absl::UnavailableError(absl::StrCat(what, ": ", StrError(errno)));
+}
+
+int CreateUnlinkedFd() {
+#if defined(GPR_LINUX) && defined(SYS_memfd_create)
+  int fd = static_cast<int>(
+      syscall(SYS_memfd_create, "grpc-shm-transport", 0x0001 /* CLOEXEC */));
+  if (fd >= 0) return fd;
+#endif
+  // Fall back to a POSIX shared memory object that is unlinked right away, so
+  // that only descriptor holders can reach it.
+  absl::BitGen bitgen;
+  for (int attempt = 0; attempt < 16; ++attempt) {
+    std::string name = absl::StrCat("/grpc-shm-", getpid(), "-",
+                                    absl::Uniform<uint64_t>(bitgen));
+    int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd >= 0) {
+      shm_unlink(name.c_str());
+      return fd;
+    }
+    if (errno != EEXIST) break;
+  }
+  return -1;
+}
+
+}  // namespace
+
+absl::StatusOr<RefCountedPtr<SharedMemorySegment>>
+SharedMemorySegment::CreateAnonymous(size_t size) {
+  void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (data == MAP_FAILED) return ErrnoStatus("mmap");
+  return MakeRefCounted<SharedMemorySegment>(data, size, -1);
+}
+
+absl::StatusOr<RefCountedPtr<SharedMemorySegment>>
+SharedMemorySegment::CreateShareable(size_t size) {
+  int fd = CreateUnlinkedFd();
+  if (fd < 0) return ErrnoStatus("create shared memory file");
+  if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+    auto status = ErrnoStatus("ftruncate");
+    close(fd);
+    return status;
+  }
+  return MapFd(fd, size);
+}
+
+absl::StatusOr<RefCountedPtr<SharedMemorySegment>> SharedMemorySegment::MapFd(
+    int fd, size_t size) {
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    auto status = ErrnoStatus("fstat");
+    close(fd);
+    return status;
+  }
+  if (static_cast<size_t>(st.st_size) < size) {
+    close(fd);
+    return absl::InvalidArgumentError(
+        "shared memory file is smaller than the requested mapping");
+  }
+  void* data =
+      mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (data == MAP_FAILED) {
+    auto status = ErrnoStatus("mmap");
+    close(fd);
+    return status;
+  }
+  return MakeRefCounted<SharedMemorySegment>(data, size, fd);
+}
+
+SharedMemorySegment::~SharedMemorySegment() {
+  munmap(data_, size_);
+  if (fd_ >= 0) close(fd_);
+}
+
+absl::Status SendSharedMemorySegment(int socket_fd,
+                                     const SharedMemorySegment& segment,
+                                     uint64_t header) {
+  if (segment.fd() < 0) {
+    return absl::InvalidArgumentError(
+        "anonymous shared memory cannot be sent to a peer");
+  }
+  iovec iov;
+  iov.iov_base = &header;
+  iov.iov_len = sizeof(header);
+  alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))];
+  memset(control, 0, sizeof(control));
+  msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof(control);
+  cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+  cmsg->cmsg_level = SOL_SOCKET;
+  cmsg->cmsg_type = SCM_RIGHTS;
+  cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+  const int fd = segment.fd();
+  memcpy(CMSG_DATA(cmsg), &fd, sizeof(fd));
+  // The socket has not carried anything yet, so its send buffer has room for
+  // the header.
+  ssize_t sent;
+  do {
+    sent = sendmsg(socket_fd, &msg, MSG_DONTWAIT);
+  } while (sent < 0 && errno == EINTR);
+  if (sent != static_cast<ssize_t>(sizeof(header))) {
+    return ErrnoStatus("sendmsg");
+  }
+  return absl::OkStatus();
+}
+
+absl::StatusOr<absl::optional<ReceivedSharedMemorySegment>>
+TryReceiveSharedMemorySegment(int socket_fd,
+                              size_t (*size_for_header)(uint64_t header)) {
+  uint64_t header = 0;
+  iovec iov;
+  iov.iov_base = &header;
+  iov.iov_len = sizeof(header);
+  alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))];
+  msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof(control);
+  ssize_t r;
+  do {
+    r = recvmsg(socket_fd, &msg, MSG_DONTWAIT);
+  } while (r < 0 && errno == EINTR);
+  if (r < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+    return absl::nullopt;
+  }
+  if (r < 0) return ErrnoStatus("recvmsg");
+  if (r == 0) return absl::UnavailableError("shared memory peer hung up");
+  cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+  if (cmsg == nullptr || cmsg->cmsg_level != SOL_SOCKET ||
+      cmsg->cmsg_type != SCM_RIGHTS) {
+    return absl::UnavailableError("peer did not send a shared memory segment");
+  }
+  int fd;
+  memcpy(&fd, CMSG_DATA(cmsg), sizeof(fd));
+  // The header is sent along with the descriptor in a single message, so it
+  // is never split.
+  if (r != static_cast<ssize_t>(sizeof(header))) {
+    close(fd);
+    return absl::UnavailableError("short read during shared memory handshake");
+  }
+  const size_t size = size_for_header(header);
+  if (size == 0) {
+    close(fd);
+    return absl::InvalidArgumentError("unsupported shared memory layout");
+  }
+  auto segment = SharedMemorySegment::MapFd(fd, size);
+  if (!segment.ok()) return segment.status();
+  return ReceivedSharedMemorySegment{std::move(*segment), header};
+}
+
+}  // namespace shm
+}  // namespace grpc_core
+
+#else  // !GPR_SUPPORT_CHANNELS_FROM_FD
+
+namespace grpc_core {
+namespace shm {
+
+absl::StatusOr<RefCountedPtr<SharedMemorySegment>>
+SharedMemorySegment::CreateAnonymous(size_t) {
+  return absl::UnimplementedError("shared memory transport not supported");
+}
+
+absl::StatusOr<RefCountedPtr<SharedMemorySegment>>
+SharedMemorySegment::CreateShareable(size_t) {
+  return absl::UnimplementedError("shared memory transport not supported");
+}
+
+absl::StatusOr<RefCountedPtr<SharedMemorySegment>> SharedMemorySegment::MapFd(
+    int, size_t) {
+  return absl::UnimplementedError("shared memory transport not supported");
+}
+
+SharedMemorySegment::~SharedMemorySegment() {}
+
+absl::Status SendSharedMemorySegment(int, const SharedMemorySegment&,
+                                     uint64_t) {
+  return absl::UnimplementedError("shared memory transport not supported");
+}
+
+absl::StatusOr<absl::optional<ReceivedSharedMemorySegment>>
+TryReceiveSharedMemorySegment(int, size_t (*)(uint64_t)) {
+  return absl::UnimplementedError("shared memory transport not supported");
+}
+
+}  // namespace shm
+}  // namespace grpc_core
+
+#endif  // GPR_SUPPORT_CHANNELS_FROM_FD
@@ -0,0 +1,89 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_SEGMENT_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_SEGMENT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/types/optional.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+
+namespace grpc_core {
+namespace shm {
+
+// A region of memory mapped MAP_SHARED, optionally backed by a file
+// descriptor that can be handed to another process.
+class SharedMemorySegment final : public RefCounted<SharedMemorySegment> {
+ public:
+  // Anonymous mapping: shared only with this process (and children forked
+  // after creation).
+  static absl::StatusOr<RefCountedPtr<SharedMemorySegment>> CreateAnonymous(
+      size_t size);
+  // Mapping backed by an unlinked file descriptor (memfd on Linux), so that
+  // it can be passed to a peer over a Unix domain socket.
+  static absl::StatusOr<RefCountedPtr<SharedMemorySegment>> CreateShareable(
+      size_t size);
+  // Map a file descriptor received from a peer. Takes ownership of fd.
+  static absl::StatusOr<RefCountedPtr<SharedMemorySegment>> MapFd(int fd,
+                                                                  size_t size);
+
+  SharedMemorySegment(void* data, size_t size, int fd)
+      : data_(data), size_(size), fd_(fd) {}
+  ~SharedMemorySegment() override;
+
+  SharedMemorySegment(const SharedMemorySegment&) = delete;
+  SharedMemorySegment& operator=(const SharedMemorySegment&) = delete;
+
+  uint8_t* data() const { return static_cast<uint8_t*>(data_); }
+  size_t size() const { return size_; }
+  // -1 for anonymous segments.
+  int fd() const { return fd_; }
+
+ private:
+  void* const data_;
+  const size_t size_;
+  const int fd_;
+};
+
+// Non-blocking helpers used to hand a segment to a peer over a connected Unix
+// domain socket before the socket is given to the EventEngine. The sender
+// passes the segment's descriptor (SCM_RIGHTS) along with a small, opaque
+// header. Nothing is sent back: the sender can use the segment right away, and
+// whatever it writes to the socket afterwards is read after the header.
+absl::Status SendSharedMemorySegment(int socket_fd,
+                                     const SharedMemorySegment& segment,
+                                     uint64_t header);
+struct ReceivedSharedMemorySegment {
+  RefCountedPtr<SharedMemorySegment> segment;
+  uint64_t header;
+};
+// size_for_header maps the received header to the size of the mapping, or
+// returns 0 if the header is unacceptable. Returns absl::nullopt if the peer
+// has not sent the segment yet.
+absl::StatusOr<absl::optional<ReceivedSharedMemorySegment>>
+TryReceiveSharedMemorySegment(int socket_fd,
+                              size_t (*size_for_header)(uint64_t header));
+
+}  // namespace shm
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_SEGMENT_H
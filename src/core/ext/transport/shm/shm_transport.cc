@@ -0,0 +1,390 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/shm/shm_transport.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+
+#include <grpc/grpc.h>
+#include <grpc/support/log.h>
+#include <grpc/support/port_platform.h>
+
+#ifdef GPR_SUPPORT_CHANNELS_FROM_FD
+#include <unistd.h>
+#endif
+
+#include "src/core/ext/transport/chaotic_good/client_transport.h"
+#include "src/core/ext/transport/chaotic_good/server_transport.h"
+#include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
+#include "src/core/ext/transport/chttp2/transport/hpack_parser.h"
+#include "src/core/ext/transport/shm/shm_endpoint.h"
+#include "src/core/ext/transport/shm/shm_ring.h"
+#include "src/core/ext/transport/shm/shm_segment.h"
+#include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/event_engine/channel_args_endpoint_config.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/event_engine/extensions/supports_fd.h"
+#include "src/core/lib/event_engine/query_extensions.h"
+#include "src/core/lib/gprpp/status_helper.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "src/core/lib/surface/api_trace.h"
+#include "src/core/lib/surface/channel.h"
+#include "src/core/lib/surface/channel_create.h"
+#include "src/core/lib/transport/promise_endpoint.h"
+#include "src/core/server/server.h"
+
+namespace grpc_core {
+
+namespace {
+
+using grpc_event_engine::experimental::ChannelArgsEndpointConfig;
+using grpc_event_engine::experimental::EventEngine;
+using grpc_event_engine::experimental::EventEngineSupportsFdExtension;
+using grpc_event_engine::experimental::QueryExtension;
+using shm::SharedMemoryConnection;
+using shm::SharedMemoryRing;
+using shm::SharedMemorySegment;
+
+constexpr size_t kDefaultRingSize = 1024 * 1024;
+constexpr size_t kMaxRingSize = 64 * 1024 * 1024;
+constexpr Duration kHandshakeTimeout = Duration::Seconds(5);
+// How often the server side checks whether the client has sent its mapping:
+// starting at the first delay, doubled up to the maximum after each check.
+constexpr Duration kHandshakeInitialPollDelay = Duration::Milliseconds(1);
+constexpr Duration kHandshakeMaxPollDelay = Duration::Milliseconds(100);
+
+// Rings, in the order they're laid out in the segment.
+enum RingIndex : size_t {
+  kClientToServerControl = 0,
+  kServerToClientControl,
+  kClientToServerData,
+  kServerToClientData,
+  kNumRings,
+};
+
+bool IsValidRingSize(uint64_t size) {
+  return size >= SharedMemoryRing::kMinCapacity && size <= kMaxRingSize &&
+         (size & (size - 1)) == 0;
+}
+
+size_t RingSizeFromArgs(const ChannelArgs& args) {
+  const int requested = args.GetInt(GRPC_ARG_SHM_RING_SIZE)
+                            .value_or(static_cast<int>(kDefaultRingSize));
+  size_t size = SharedMemoryRing::kMinCapacity;
+  while (size < kMaxRingSize && size < static_cast<size_t>(requested)) {
+    size <<= 1;
+  }
+  return size;
+}
+
+size_t SegmentSize(size_t ring_size) {
+  return kNumRings * SharedMemoryRing::RequiredBytes(ring_size);
+}
+
+// Segment size for the ring size announced by a client, or 0 if we won't
+// accept it.
+size_t SegmentSizeForHandshakeHeader(uint64_t ring_size) {
+  if (!IsValidRingSize(ring_size)) return 0;
+  return SegmentSize(ring_size);
+}
+
+void* RingMemory(const SharedMemorySegment& segment, size_t ring_size,
+                 RingIndex index) {
+  return segment.data() + index * SharedMemoryRing::RequiredBytes(ring_size);
+}
+
+void InitializeRings(const SharedMemorySegment& segment, size_t ring_size) {
+  for (size_t i = 0; i < kNumRings; ++i) {
+    SharedMemoryRing::Create(
+        RingMemory(segment, ring_size, static_cast<RingIndex>(i)), ring_size);
+  }
+}
+
+struct Endpoints {
+  PromiseEndpoint control;
+  PromiseEndpoint data;
+};
+
+absl::StatusOr<Endpoints> MakeEndpoints(
+    RefCountedPtr<SharedMemorySegment> segment, size_t ring_size,
+    bool is_client, std::unique_ptr<EventEngine::Endpoint> doorbell,
+    std::shared_ptr<EventEngine> event_engine) {
+  SharedMemoryRing rings[kNumRings];
+  for (size_t i = 0; i < kNumRings; ++i) {
+    rings[i] = SharedMemoryRing::Attach(
+        RingMemory(*segment, ring_size, static_cast<RingIndex>(i)),
+        ring_size);
+    if (!rings[i].valid()) {
+      return absl::InvalidArgumentError("corrupt shared memory segment");
+    }
+  }
+  auto connection = MakeRefCounted<SharedMemoryConnection>(
+      std::move(segment), std::move(doorbell), std::move(event_engine));
+  auto control =
+      is_client ? connection->CreateEndpoint(rings[kServerToClientControl],
+                                             rings[kClientToServerControl])
+                : connection->CreateEndpoint(rings[kClientToServerControl],
+                                             rings[kServerToClientControl]);
+  auto data = is_client ? connection->CreateEndpoint(rings[kServerToClientData],
+                                                     rings[kClientToServerData])
+                        : connection->CreateEndpoint(rings[kClientToServerData],
+                                                     rings[kServerToClientData]);
+  connection->Start();
+  return Endpoints{PromiseEndpoint(std::move(control), SliceBuffer()),
+                   PromiseEndpoint(std::move(data), SliceBuffer())};
+}
+
+ChannelArgs WithResourceQuota(const ChannelArgs& args) {
+  if (args.GetObject<ResourceQuota>() != nullptr) return args;
+  return args.SetObject(ResourceQuota::Default());
+}
+
+std::shared_ptr<EventEngine> EventEngineFromArgs(const ChannelArgs& args) {
+  auto event_engine = args.GetObjectRef<EventEngine>();
+  if (event_engine != nullptr) return event_engine;
+  return grpc_event_engine::experimental::GetDefaultEventEngine();
+}
+
+OrphanablePtr<Transport> MakeClientTransport(
+    Endpoints endpoints, const ChannelArgs& args,
+    std::shared_ptr<EventEngine> event_engine) {
+  return MakeOrphanable<chaotic_good::ChaoticGoodClientTransport>(
+      std::move(endpoints.control), std::move(endpoints.data), args,
+      std::move(event_engine), HPackParser(), HPackCompressor());
+}
+
+OrphanablePtr<Transport> MakeServerTransport(
+    Endpoints endpoints, const ChannelArgs& args,
+    std::shared_ptr<EventEngine> event_engine) {
+  return MakeOrphanable<chaotic_good::ChaoticGoodServerTransport>(
+      args, std::move(endpoints.control), std::move(endpoints.data),
+      std::move(event_engine), HPackParser(), HPackCompressor());
+}
+
+void CloseFd(int fd) {
+#ifdef GPR_SUPPORT_CHANNELS_FROM_FD
+  close(fd);
+#else
+  (void)fd;
+#endif
+}
+
+absl::StatusOr<std::unique_ptr<EventEngine::Endpoint>> DoorbellFromFd(
+    int fd, const ChannelArgs& args, EventEngine* event_engine) {
+  auto* supports_fd =
+      QueryExtension<EventEngineSupportsFdExtension>(event_engine);
+  if (supports_fd == nullptr) {
+    return absl::UnimplementedError(
+        "shared memory transport requires an EventEngine that can adopt file "
+        "descriptors");
+  }
+  return supports_fd->CreatePosixEndpointFromFd(
+      fd, ChannelArgsEndpointConfig(args),
+      args.GetObject<ResourceQuota>()->memory_quota()->CreateMemoryAllocator(
+          absl::StrCat("shm_doorbell:", fd)));
+}
+
+// Server side of the handshake over a socket that is not watched by anything
+// yet: checks the socket without blocking, and again after a growing delay
+// until the client's mapping arrives or the handshake times out.
+class ServerHandshake {
+ public:
+  ServerHandshake(
+      int fd, ChannelArgs args, std::shared_ptr<EventEngine> event_engine,
+      absl::AnyInvocable<void(absl::StatusOr<OrphanablePtr<Transport>>)>
+          on_done)
+      : fd_(fd),
+        args_(std::move(args)),
+        event_engine_(std::move(event_engine)),
+        on_done_(std::move(on_done)),
+        deadline_(Timestamp::Now() + kHandshakeTimeout) {}
+
+  static void Poll(std::unique_ptr<ServerHandshake> self) {
+    auto received =
+        shm::TryReceiveSharedMemorySegment(self->fd_,
+                                           SegmentSizeForHandshakeHeader);
+    if (!received.ok()) {
+      self->on_done_(received.status());
+      return;
+    }
+    if (!received->has_value()) {
+      if (Timestamp::Now() >= self->deadline_) {
+        self->on_done_(
+            absl::DeadlineExceededError("shared memory handshake timed out"));
+        return;
+      }
+      const Duration delay = self->delay_;
+      self->delay_ = std::min(self->delay_ * 2, kHandshakeMaxPollDelay);
+      EventEngine* event_engine = self->event_engine_.get();
+      event_engine->RunAfter(delay, [self = std::move(self)]() mutable {
+        ApplicationCallbackExecCtx app_exec_ctx;
+        ExecCtx exec_ctx;
+        Poll(std::move(self));
+      });
+      return;
+    }
+    self->on_done_(self->Finish(std::move(**received)));
+  }
+
+ private:
+  absl::StatusOr<OrphanablePtr<Transport>> Finish(
+      shm::ReceivedSharedMemorySegment received) {
+    auto doorbell = DoorbellFromFd(fd_, args_, event_engine_.get());
+    if (!doorbell.ok()) return doorbell.status();
+    auto endpoints = MakeEndpoints(std::move(received.segment),
+                                   static_cast<size_t>(received.header),
+                                   /*is_client=*/false, std::move(*doorbell),
+                                   event_engine_);
+    if (!endpoints.ok()) return endpoints.status();
+    return MakeServerTransport(std::move(*endpoints), args_, event_engine_);
+  }
+
+  const int fd_;
+  const ChannelArgs args_;
+  const std::shared_ptr<EventEngine> event_engine_;
+  absl::AnyInvocable<void(absl::StatusOr<OrphanablePtr<Transport>>)> on_done_;
+  const Timestamp deadline_;
+  Duration delay_ = kHandshakeInitialPollDelay;
+};
+
+}  // namespace
+
+absl::StatusOr<std::pair<OrphanablePtr<Transport>, OrphanablePtr<Transport>>>
+MakeSharedMemoryTransportPair(
+    std::unique_ptr<EventEngine::Endpoint> client_doorbell,
+    std::unique_ptr<EventEngine::Endpoint> server_doorbell,
+    const ChannelArgs& args) {
+  const ChannelArgs channel_args = WithResourceQuota(args);
+  auto event_engine = EventEngineFromArgs(channel_args);
+  const size_t ring_size = RingSizeFromArgs(channel_args);
+  auto segment = SharedMemorySegment::CreateAnonymous(SegmentSize(ring_size));
+  if (!segment.ok()) return segment.status();
+  InitializeRings(**segment, ring_size);
+  auto client_endpoints =
+      MakeEndpoints(*segment, ring_size, /*is_client=*/true,
+                    std::move(client_doorbell), event_engine);
+  if (!client_endpoints.ok()) return client_endpoints.status();
+  auto server_endpoints =
+      MakeEndpoints(std::move(*segment), ring_size, /*is_client=*/false,
+                    std::move(server_doorbell), event_engine);
+  if (!server_endpoints.ok()) return server_endpoints.status();
+  return std::make_pair(
+      MakeClientTransport(std::move(*client_endpoints), channel_args,
+                          event_engine),
+      MakeServerTransport(std::move(*server_endpoints), channel_args,
+                          event_engine));
+}
+
+absl::StatusOr<OrphanablePtr<Transport>> MakeSharedMemoryClientTransport(
+    int fd, const ChannelArgs& args) {
+  const ChannelArgs channel_args = WithResourceQuota(args);
+  auto event_engine = EventEngineFromArgs(channel_args);
+  const size_t ring_size = RingSizeFromArgs(channel_args);
+  auto segment = SharedMemorySegment::CreateShareable(SegmentSize(ring_size));
+  if (!segment.ok()) return segment.status();
+  InitializeRings(**segment, ring_size);
+  auto status = shm::SendSharedMemorySegment(fd, **segment, ring_size);
+  if (!status.ok()) return status;
+  auto doorbell = DoorbellFromFd(fd, channel_args, event_engine.get());
+  if (!doorbell.ok()) return doorbell.status();
+  auto endpoints =
+      MakeEndpoints(std::move(*segment), ring_size, /*is_client=*/true,
+                    std::move(*doorbell), event_engine);
+  if (!endpoints.ok()) return endpoints.status();
+  return MakeClientTransport(std::move(*endpoints), channel_args,
+                             std::move(event_engine));
+}
+
+void MakeSharedMemoryServerTransport(
+    int fd, const ChannelArgs& args,
+    absl::AnyInvocable<void(absl::StatusOr<OrphanablePtr<Transport>>)>
+        on_done) {
+  const ChannelArgs channel_args = WithResourceQuota(args);
+  auto event_engine = EventEngineFromArgs(channel_args);
+  ServerHandshake::Poll(std::make_unique<ServerHandshake>(
+      fd, channel_args, std::move(event_engine), std::move(on_done)));
+}
+
+}  // namespace grpc_core
+
+grpc_channel* grpc_shm_channel_create_from_fd(const char* target, int fd,
+                                              const grpc_channel_args* args) {
+  grpc_core::ApplicationCallbackExecCtx app_exec_ctx;
+  grpc_core::ExecCtx exec_ctx;
+  GRPC_API_TRACE("grpc_shm_channel_create_from_fd(target=%p, fd=%d, args=%p)",
+                 3, (target, fd, args));
+  auto channel_args = grpc_core::CoreConfiguration::Get()
+                          .channel_args_preconditioning()
+                          .PreconditionChannelArgs(args)
+                          .SetIfUnset(GRPC_ARG_DEFAULT_AUTHORITY, "localhost");
+  auto transport = grpc_core::MakeSharedMemoryClientTransport(fd, channel_args);
+  if (!transport.ok()) {
+    gpr_log(GPR_ERROR, "Failed to create shared memory transport: %s",
+            transport.status().ToString().c_str());
+    grpc_core::CloseFd(fd);
+    return grpc_lame_client_channel_create(
+        target, GRPC_STATUS_UNAVAILABLE,
+        "Failed to create shared memory transport");
+  }
+  auto channel =
+      grpc_core::ChannelCreate(target, channel_args, GRPC_CLIENT_DIRECT_CHANNEL,
+                               transport->release());
+  if (!channel.ok()) {
+    return grpc_lame_client_channel_create(
+        target, GRPC_STATUS_INTERNAL, "Failed to create client channel");
+  }
+  return channel->release()->c_ptr();
+}
+
+void grpc_server_add_shm_channel_from_fd(grpc_server* server, int fd) {
+  grpc_core::ApplicationCallbackExecCtx app_exec_ctx;
+  grpc_core::ExecCtx exec_ctx;
+  GRPC_API_TRACE("grpc_server_add_shm_channel_from_fd(server=%p, fd=%d)", 2,
+                 (server, fd));
+  grpc_core::Server* core_server = grpc_core::Server::FromC(server);
+  grpc_core::ChannelArgs server_args = core_server->channel_args();
+  grpc_core::MakeSharedMemoryServerTransport(
+      fd, server_args,
+      [server = core_server->RefForTransportSetup(), server_args, fd](
+          absl::StatusOr<grpc_core::OrphanablePtr<grpc_core::Transport>>
+              transport) {
+        if (!transport.ok()) {
+          gpr_log(GPR_ERROR, "Failed to create shared memory transport: %s",
+                  transport.status().ToString().c_str());
+          grpc_core::CloseFd(fd);
+          return;
+        }
+        // A server that was shut down in the meantime disconnects the
+        // transport right away.
+        grpc_error_handle error = server->SetupTransport(
+            transport->get(), nullptr, server_args, nullptr);
+        if (!error.ok()) {
+          gpr_log(GPR_ERROR, "Failed to create channel: %s",
+                  grpc_core::StatusToString(error).c_str());
+          return;
+        }
+        std::ignore = transport->release();  // consumed by SetupTransport
+      });
+}
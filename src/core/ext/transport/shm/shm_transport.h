@@ -0,0 +1,86 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_TRANSPORT_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_TRANSPORT_H
+
+#include <memory>
+#include <utility>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/status/statusor.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/grpc.h>
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/transport/transport.h"
+
+// Size in bytes of each shared memory ring (one per direction for each of the
+// control and data streams). Rounded up to a power of two.
+#define GRPC_ARG_SHM_RING_SIZE "grpc.experimental.shm_ring_size"
+
+namespace grpc_core {
+
+// Shared memory transport for peers on the same host.
+//
+// Frames are the chaotic_good frames, carried by four single-producer
+// single-consumer rings (control and data, in each direction) inside one
+// shared mapping, so that payloads are copied once into the ring and once out
+// of it without entering the kernel. The two sides are additionally joined by
+// a stream socket that is used to pass the mapping during the handshake and
+// afterwards only to carry wakeups when a reader or writer has to block.
+
+// Creates both halves of a shared memory connection inside this process.
+// client_doorbell and server_doorbell must be the two ends of one connected
+// stream (for example a socketpair wrapped by the EventEngine).
+absl::StatusOr<std::pair<OrphanablePtr<Transport>, OrphanablePtr<Transport>>>
+MakeSharedMemoryTransportPair(
+    std::unique_ptr<grpc_event_engine::experimental::EventEngine::Endpoint>
+        client_doorbell,
+    std::unique_ptr<grpc_event_engine::experimental::EventEngine::Endpoint>
+        server_doorbell,
+    const ChannelArgs& args);
+
+// Cross process setup over a connected Unix domain socket. The client side
+// allocates the mapping and sends it to the server. Neither side blocks: the
+// client transport is returned right away, and the server side waits on the
+// EventEngine (for at most a few seconds) for the client's mapping to arrive
+// before calling on_done. The two sides can therefore be set up in any order,
+// from any thread. On success, ownership of fd passes to the transport;
+// otherwise the caller keeps it.
+absl::StatusOr<OrphanablePtr<Transport>> MakeSharedMemoryClientTransport(
+    int fd, const ChannelArgs& args);
+void MakeSharedMemoryServerTransport(
+    int fd, const ChannelArgs& args,
+    absl::AnyInvocable<void(absl::StatusOr<OrphanablePtr<Transport>>)>
+        on_done);
+
+}  // namespace grpc_core
+
+// Create a client channel over a shared memory transport to a server that
+// owns the other end of the connected Unix domain socket fd.
+grpc_channel* grpc_shm_channel_create_from_fd(const char* target, int fd,
+                                              const grpc_channel_args* args);
+
+// Add a shared memory connection to server, using the server end of a
+// connected Unix domain socket. Returns without waiting for the client: the
+// connection is added once the client end has been passed to
+// grpc_shm_channel_create_from_fd, which may happen before or after this call.
+// The socket is closed if that does not happen within a few seconds.
+void grpc_server_add_shm_channel_from_fd(grpc_server* server, int fd);
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_TRANSPORT_H
@@ -0,0 +1,93 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/handshaker/security/handshake_executor.h"
+
+#include <utility>
+
+#include "absl/log/check.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+
+namespace grpc_core {
+
+HandshakeExecutor::HandshakeExecutor(
+    int max_concurrent_steps, ConnectionQuotaRefPtr connection_quota,
+    std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine)
+    : max_concurrent_steps_(max_concurrent_steps),
+      connection_quota_(std::move(connection_quota)),
+      event_engine_(std::move(event_engine)) {
+  CHECK_GT(max_concurrent_steps_, 0);
+}
+
+HandshakeExecutor::~HandshakeExecutor() {
+  // Queued steps hold on to their handshakers, which hold on to us.
+  CHECK(queue_.empty());
+}
+
+bool HandshakeExecutor::Run(absl::AnyInvocable<void()> step) {
+  QueuedStep queued{std::move(step), std::chrono::steady_clock::now()};
+  {
+    MutexLock lock(&mu_);
+    if (running_steps_ >= max_concurrent_steps_) {
+      if (!connection_quota_->AllowQueuedHandshake()) {
+        global_stats().IncrementHandshakesShed();
+        return false;
+      }
+      queue_.push_back(std::move(queued));
+      return true;
+    }
+    ++running_steps_;
+  }
+  event_engine_->Run([self = Ref(), queued = std::move(queued)]() mutable {
+    self->RunSteps(std::move(queued));
+  });
+  return true;
+}
+
+void HandshakeExecutor::RunSteps(QueuedStep queued) {
+  while (true) {
+    const auto start = std::chrono::steady_clock::now();
+    global_stats().IncrementHandshakeQueueTimeUs(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            start - queued.enqueue_time)
+            .count());
+    {
+      ApplicationCallbackExecCtx callback_exec_ctx;
+      ExecCtx exec_ctx;
+      queued.step();
+      queued.step = nullptr;
+      global_stats().IncrementHandshakeCryptoTimeUs(
+          std::chrono::duration_cast<std::chrono::microseconds>(
+              std::chrono::steady_clock::now() - start)
+              .count());
+    }
+    // Keep this thread for the next queued step rather than handing the
+    // running slot back and forth through the EventEngine.
+    MutexLock lock(&mu_);
+    if (queue_.empty()) {
+      --running_steps_;
+      return;
+    }
+    queued = std::move(queue_.front());
+    queue_.pop_front();
+    connection_quota_->ReleaseQueuedHandshakes(1);
+  }
+}
+
+}  // namespace grpc_core
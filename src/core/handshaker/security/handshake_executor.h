@@ -0,0 +1,93 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_HANDSHAKER_SECURITY_HANDSHAKE_EXECUTOR_H
+#define GRPC_SRC_CORE_HANDSHAKER_SECURITY_HANDSHAKE_EXECUTOR_H
+
+#include <chrono>
+#include <deque>
+#include <memory>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/strings/string_view.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/resource_quota/connection_quota.h"
+
+namespace grpc_core {
+
+// Runs the CPU heavy steps of security handshakes (TSI handshaker next calls,
+// which include the certificate signing and verification) away from the
+// endpoint callback threads, with at most a fixed number of them running at
+// once. Steps that cannot run right away wait in a FIFO queue whose depth is
+// bounded by the server's ConnectionQuota; once it is full, new steps are
+// shed, so that a reconnect storm cannot starve established connections.
+//
+// The time steps spend waiting and running is recorded in the
+// handshake_queue_time_us and handshake_crypto_time_us histograms. A step ends
+// when the TSI handshaker's next call returns: for handshakers that complete
+// asynchronously (such as ALTS, which talks to a handshaker service), the
+// crypto time only covers submitting the step, not its completion.
+class HandshakeExecutor : public RefCounted<HandshakeExecutor> {
+ public:
+  HandshakeExecutor(
+      int max_concurrent_steps, ConnectionQuotaRefPtr connection_quota,
+      std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+          event_engine);
+  ~HandshakeExecutor() override;
+
+  HandshakeExecutor(const HandshakeExecutor&) = delete;
+  HandshakeExecutor& operator=(const HandshakeExecutor&) = delete;
+
+  static absl::string_view ChannelArgName() {
+    return "grpc.internal.handshake_executor";
+  }
+  static int ChannelArgsCompare(const HandshakeExecutor* a,
+                                const HandshakeExecutor* b) {
+    return QsortCompare(a, b);
+  }
+
+  // Runs \a step on the EventEngine as soon as fewer than the maximum number
+  // of steps are running. Returns false, without running \a step, if it would
+  // have to wait while the handshake queue is full.
+  bool Run(absl::AnyInvocable<void()> step);
+
+ private:
+  struct QueuedStep {
+    absl::AnyInvocable<void()> step;
+    std::chrono::steady_clock::time_point enqueue_time;
+  };
+
+  // Runs \a step and then the queued steps, until the queue is empty.
+  void RunSteps(QueuedStep step);
+
+  const int max_concurrent_steps_;
+  const ConnectionQuotaRefPtr connection_quota_;
+  const std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+      event_engine_;
+  Mutex mu_;
+  int running_steps_ ABSL_GUARDED_BY(mu_) = 0;
+  std::deque<QueuedStep> queue_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_HANDSHAKER_SECURITY_HANDSHAKE_EXECUTOR_H
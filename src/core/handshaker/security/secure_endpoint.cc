@@ -139,6 +139,10 @@ struct secure_endpoint {
   grpc_core::MemoryAllocator::Reservation self_reservation;
   std::atomic<bool> has_posted_reclaimer;
   int min_progress_size;
+  // Directions whose TLS records are handled by the kernel. Data in these
+  // directions bypasses the protector.
+  bool kernel_tls_tx = false;
+  bool kernel_tls_rx = false;
   grpc_slice_buffer protector_staging_buffer;
   gpr_refcount ref;
 };
@@ -350,8 +354,12 @@ static void on_read(void* user_data, grpc_error_handle error) {
 
 static void endpoint_read(grpc_endpoint* secure_ep, grpc_slice_buffer* slices,
                           grpc_closure* cb, bool urgent,
-                          int /*min_progress_size*/) {
+                          int min_progress_size) {
   secure_endpoint* ep = reinterpret_cast<secure_endpoint*>(secure_ep);
+  if (ep->kernel_tls_rx) {
+    grpc_endpoint_read(ep->wrapped_ep, slices, cb, urgent, min_progress_size);
+    return;
+  }
   ep->read_cb = cb;
   ep->read_buffer = slices;
   grpc_slice_buffer_reset_and_unref(ep->read_buffer);
@@ -385,6 +393,11 @@ static void endpoint_write(grpc_endpoint* secure_ep, grpc_slice_buffer* slices,
   tsi_result result = TSI_OK;
   secure_endpoint* ep = reinterpret_cast<secure_endpoint*>(secure_ep);
 
+  if (ep->kernel_tls_tx) {
+    grpc_endpoint_write(ep->wrapped_ep, slices, cb, arg, max_frame_size);
+    return;
+  }
+
   {
     grpc_core::MutexLock l(&ep->write_mu);
     uint8_t* cur = GRPC_SLICE_START_PTR(ep->write_staging_buffer);
@@ -563,3 +576,11 @@ grpc_endpoint* grpc_secure_endpoint_create(
                           leftover_slices, channel_args, leftover_nslices);
   return &ep->base;
 }
+
+void grpc_secure_endpoint_set_kernel_tls(grpc_endpoint* secure_ep, bool tx,
+                                         bool rx) {
+  secure_endpoint* ep = reinterpret_cast<secure_endpoint*>(secure_ep);
+  CHECK(!rx || ep->leftover_bytes.count == 0);
+  ep->kernel_tls_tx = tx;
+  ep->kernel_tls_rx = rx;
+}
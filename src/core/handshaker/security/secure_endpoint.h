@@ -39,4 +39,12 @@ grpc_endpoint* grpc_secure_endpoint_create(
     grpc_endpoint* to_wrap, grpc_slice* leftover_slices,
     const grpc_channel_args* channel_args, size_t leftover_nslices);
 
+// Marks the directions of secure_ep whose TLS records are handled by the
+// kernel (see tsi_handshaker_result_enable_kernel_tls()). Reads and writes in
+// those directions are passed to the wrapped endpoint unchanged. Must be
+// called before the first read or write, and rx requires that there were no
+// leftover slices.
+void grpc_secure_endpoint_set_kernel_tls(grpc_endpoint* secure_ep, bool tx,
+                                         bool rx);
+
 #endif  // GRPC_SRC_CORE_HANDSHAKER_SECURITY_SECURE_ENDPOINT_H
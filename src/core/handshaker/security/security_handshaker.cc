@@ -47,12 +47,14 @@
 #include "src/core/handshaker/handshaker.h"
 #include "src/core/handshaker/handshaker_factory.h"
 #include "src/core/handshaker/handshaker_registry.h"
+#include "src/core/handshaker/security/handshake_executor.h"
 #include "src/core/handshaker/security/secure_endpoint.h"
 #include "src/core/handshaker/security/tsi_error.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/config/core_configuration.h"
 #include "src/core/lib/debug/stats.h"
 #include "src/core/lib/debug/stats_data.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/sync.h"
@@ -89,6 +91,8 @@ class SecurityHandshaker : public Handshaker {
  private:
   grpc_error_handle DoHandshakerNextLocked(const unsigned char* bytes_received,
                                            size_t bytes_received_size);
+  grpc_error_handle CallHandshakerNextLocked(
+      const unsigned char* bytes_received, size_t bytes_received_size);
 
   grpc_error_handle OnHandshakeNextDoneLocked(
       tsi_result result, const unsigned char* bytes_to_send,
@@ -114,6 +118,8 @@ class SecurityHandshaker : public Handshaker {
   // State set at creation time.
   tsi_handshaker* handshaker_;
   RefCountedPtr<grpc_security_connector> connector_;
+  // If set, handshaker next calls run on this executor.
+  RefCountedPtr<HandshakeExecutor> executor_;
 
   Mutex mu_;
 
@@ -143,6 +149,7 @@ SecurityHandshaker::SecurityHandshaker(tsi_handshaker* handshaker,
                                        const ChannelArgs& args)
     : handshaker_(handshaker),
       connector_(connector->Ref(DEBUG_LOCATION, "handshake")),
+      executor_(args.GetObjectRef<HandshakeExecutor>()),
       handshake_buffer_size_(GRPC_INITIAL_HANDSHAKE_BUFFER_SIZE),
       handshake_buffer_(
           static_cast<uint8_t*>(gpr_malloc(handshake_buffer_size_))),
@@ -277,6 +284,22 @@ void SecurityHandshaker::OnPeerCheckedInner(grpc_error_handle error) {
         result));
     return;
   }
+  // Try to hand the TLS record layer to the kernel. This has to happen before
+  // the frame protector takes over the handshaker result's state.
+  bool kernel_tls_tx = false;
+  bool kernel_tls_rx = false;
+  if (IsTlsKernelOffloadEnabled() &&
+      frame_protector_type != TSI_FRAME_PROTECTOR_NONE) {
+    int fd = grpc_endpoint_get_fd(args_->endpoint);
+    if (fd >= 0) {
+      // The kernel's software TLS implementation rejects MSG_ZEROCOPY sends.
+      kernel_tls_tx = !args_->args.GetBool(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED)
+                           .value_or(false);
+      kernel_tls_rx = true;
+      tsi_handshaker_result_enable_kernel_tls(handshaker_result_, fd,
+                                              &kernel_tls_tx, &kernel_tls_rx);
+    }
+  }
   tsi_zero_copy_grpc_protector* zero_copy_protector = nullptr;
   tsi_frame_protector* protector = nullptr;
   switch (frame_protector_type) {
@@ -324,6 +347,10 @@ void SecurityHandshaker::OnPeerCheckedInner(grpc_error_handle error) {
           protector, zero_copy_protector, args_->endpoint, nullptr,
           args_->args.ToC().get(), 0);
     }
+    if (kernel_tls_tx || kernel_tls_rx) {
+      grpc_secure_endpoint_set_kernel_tls(args_->endpoint, kernel_tls_tx,
+                                          kernel_tls_rx);
+    }
   } else if (unused_bytes_size > 0) {
     // Not wrapping the endpoint, so just pass along unused bytes.
     grpc_slice slice = grpc_slice_from_copied_buffer(
@@ -455,6 +482,35 @@ void SecurityHandshaker::OnHandshakeNextDoneGrpcWrapper(
 
 grpc_error_handle SecurityHandshaker::DoHandshakerNextLocked(
     const unsigned char* bytes_received, size_t bytes_received_size) {
+  if (executor_ == nullptr) {
+    return CallHandshakerNextLocked(bytes_received, bytes_received_size);
+  }
+  // The ref that the caller releases on success is handed over to the step.
+  // bytes_received points into handshake_buffer_, which is not touched again
+  // until the step has run.
+  bool admitted = executor_->Run([this, bytes_received, bytes_received_size]() {
+    RefCountedPtr<SecurityHandshaker> h(this);
+    MutexLock lock(&mu_);
+    grpc_error_handle error =
+        is_shutdown_
+            ? GRPC_ERROR_CREATE("Handshaker shutdown")
+            : CallHandshakerNextLocked(bytes_received, bytes_received_size);
+    if (!error.ok()) {
+      HandshakeFailedLocked(error);
+    } else {
+      h.release();  // Avoid unref
+    }
+  });
+  if (!admitted) {
+    return GRPC_ERROR_CREATE(
+        "Handshake shed because too many handshakes are waiting for the "
+        "handshake executor");
+  }
+  return absl::OkStatus();
+}
+
+grpc_error_handle SecurityHandshaker::CallHandshakerNextLocked(
+    const unsigned char* bytes_received, size_t bytes_received_size) {
   // Invoke TSI handshaker.
   const unsigned char* bytes_to_send = nullptr;
   size_t bytes_to_send_size = 0;
@@ -64,6 +64,12 @@ ABSL_FLAG(absl::optional<std::string>, grpc_poll_strategy, {},
           "Declares which polling engines to try when starting gRPC. This is a "
           "comma-separated list of engines, which are tried in priority order "
           "first -> last.");
+ABSL_FLAG(absl::optional<int32_t>, grpc_epoll_busy_poll_us, {},
+          "Microseconds for which the epoll1 pollers spin on epoll_wait before "
+          "blocking. 0 disables busy polling.");
+ABSL_FLAG(absl::optional<int32_t>, grpc_epoll_busy_poll_max_threads, {},
+          "Maximum number of poller threads that may busy poll at the same "
+          "time on each core.");
 ABSL_FLAG(absl::optional<bool>, grpc_abort_on_leaks, {},
           "A debugging aid to cause a call to abort() when gRPC objects are "
           "leaked past grpc_shutdown()");
@@ -85,6 +91,13 @@ ConfigVars::ConfigVars(const Overrides& overrides)
           LoadConfig(FLAGS_grpc_client_channel_backup_poll_interval_ms,
                      "GRPC_CLIENT_CHANNEL_BACKUP_POLL_INTERVAL_MS",
                      overrides.client_channel_backup_poll_interval_ms, 5000)),
+      epoll_busy_poll_us_(LoadConfig(FLAGS_grpc_epoll_busy_poll_us,
+                                     "GRPC_EPOLL_BUSY_POLL_US",
+                                     overrides.epoll_busy_poll_us, 0)),
+      epoll_busy_poll_max_threads_(LoadConfig(
+          FLAGS_grpc_epoll_busy_poll_max_threads,
+          "GRPC_EPOLL_BUSY_POLL_MAX_THREADS",
+          overrides.epoll_busy_poll_max_threads, 1)),
       enable_fork_support_(LoadConfig(
           FLAGS_grpc_enable_fork_support, "GRPC_ENABLE_FORK_SUPPORT",
           overrides.enable_fork_support, GRPC_ENABLE_FORK_SUPPORT_DEFAULT)),
@@ -142,6 +155,8 @@ std::string ConfigVars::ToString() const {
       absl::CEscape(StacktraceMinloglevel()), "\"",
       ", enable_fork_support: ", EnableForkSupport() ? "true" : "false",
       ", poll_strategy: ", "\"", absl::CEscape(PollStrategy()), "\"",
+      ", epoll_busy_poll_us: ", EpollBusyPollUs(),
+      ", epoll_busy_poll_max_threads: ", EpollBusyPollMaxThreads(),
       ", abort_on_leaks: ", AbortOnLeaks() ? "true" : "false",
       ", system_ssl_roots_dir: ", "\"", absl::CEscape(SystemSslRootsDir()),
       "\"", ", default_ssl_roots_file_path: ", "\"",
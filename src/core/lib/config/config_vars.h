@@ -35,6 +35,8 @@ class GPR_DLL ConfigVars {
  public:
   struct Overrides {
     absl::optional<int32_t> client_channel_backup_poll_interval_ms;
+    absl::optional<int32_t> epoll_busy_poll_us;
+    absl::optional<int32_t> epoll_busy_poll_max_threads;
     absl::optional<bool> enable_fork_support;
     absl::optional<bool> abort_on_leaks;
     absl::optional<bool> not_use_system_ssl_roots;
@@ -92,6 +94,14 @@ class GPR_DLL ConfigVars {
   // comma-separated list of engines, which are tried in priority order first ->
   // last.
   absl::string_view PollStrategy() const { return poll_strategy_; }
+  // Microseconds for which the epoll1 pollers spin on epoll_wait before
+  // blocking. 0 disables busy polling.
+  int32_t EpollBusyPollUs() const { return epoll_busy_poll_us_; }
+  // Maximum number of poller threads that may busy poll at the same time on
+  // each core.
+  int32_t EpollBusyPollMaxThreads() const {
+    return epoll_busy_poll_max_threads_;
+  }
   // A debugging aid to cause a call to abort() when gRPC objects are leaked
   // past grpc_shutdown()
   bool AbortOnLeaks() const { return abort_on_leaks_; }
@@ -111,6 +121,8 @@ class GPR_DLL ConfigVars {
   static const ConfigVars& Load();
   static std::atomic<ConfigVars*> config_vars_;
   int32_t client_channel_backup_poll_interval_ms_;
+  int32_t epoll_busy_poll_us_;
+  int32_t epoll_busy_poll_max_threads_;
   bool enable_fork_support_;
   bool abort_on_leaks_;
   bool not_use_system_ssl_roots_;
@@ -140,6 +140,12 @@ const absl::string_view
         "enobufs_count",
         "uncommon_io_error_count",
         "msg_errqueue_error_count",
+        "handshakes_shed",
+        "tls_server_handshakes",
+        "tls_server_resumed_handshakes",
+        "tls_client_handshakes",
+        "tls_client_resumed_handshakes",
+        "tls_session_ticket_key_misses",
 };
 const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     Counter::COUNT)] = {
@@ -181,6 +187,14 @@ const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     "Number of ENOBUFS errors",
     "Number of uncommon io errors",
     "Number of uncommon errors returned by MSG_ERRQUEUE",
+    "Number of security handshakes shed because the handshake executor queue "
+    "was full",
+    "Number of TLS handshakes completed by servers",
+    "Number of TLS handshakes completed by servers that resumed a session",
+    "Number of TLS handshakes completed by clients",
+    "Number of TLS handshakes completed by clients that resumed a session",
+    "Number of TLS session tickets that a server could not decrypt because "
+    "their key is not in its session ticket key ring",
 };
 const absl::string_view
     GlobalStats::histogram_name[static_cast<int>(Histogram::COUNT)] = {
@@ -212,6 +226,8 @@ const absl::string_view
         "chaotic_good_tcp_read_offer_control",
         "chaotic_good_tcp_write_size_data",
         "chaotic_good_tcp_write_size_control",
+        "handshake_queue_time_us",
+        "handshake_crypto_time_us",
 };
 const absl::string_view GlobalStats::histogram_doc[static_cast<int>(
     Histogram::COUNT)] = {
@@ -244,6 +260,10 @@ const absl::string_view GlobalStats::histogram_doc[static_cast<int>(
     "Number of bytes offered to each syscall_read in the control channel",
     "Number of bytes offered to each syscall_write in the data channel",
     "Number of bytes offered to each syscall_write in the control channel",
+    "Number of microseconds each security handshake step waited for the "
+    "handshake executor",
+    "Number of microseconds each security handshake step ran for on the "
+    "handshake executor",
 };
 namespace {
 const int kStatsTable0[21] = {0,    1,    2,    4,     8,     15,    27,
@@ -437,7 +457,13 @@ GlobalStats::GlobalStats()
       enotconn_count{0},
       enobufs_count{0},
       uncommon_io_error_count{0},
-      msg_errqueue_error_count{0} {}
+      msg_errqueue_error_count{0},
+      handshakes_shed{0},
+      tls_server_handshakes{0},
+      tls_server_resumed_handshakes{0},
+      tls_client_handshakes{0},
+      tls_client_resumed_handshakes{0},
+      tls_session_ticket_key_misses{0} {}
 HistogramView GlobalStats::histogram(Histogram which) const {
   switch (which) {
     default:
@@ -527,6 +553,12 @@ HistogramView GlobalStats::histogram(Histogram which) const {
     case Histogram::kChaoticGoodTcpWriteSizeControl:
       return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable6, 20,
                            chaotic_good_tcp_write_size_control.buckets()};
+    case Histogram::kHandshakeQueueTimeUs:
+      return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable6, 20,
+                           handshake_queue_time_us.buckets()};
+    case Histogram::kHandshakeCryptoTimeUs:
+      return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable6, 20,
+                           handshake_crypto_time_us.buckets()};
   }
 }
 std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
@@ -590,6 +622,18 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.uncommon_io_error_count.load(std::memory_order_relaxed);
     result->msg_errqueue_error_count +=
         data.msg_errqueue_error_count.load(std::memory_order_relaxed);
+    result->handshakes_shed +=
+        data.handshakes_shed.load(std::memory_order_relaxed);
+    result->tls_server_handshakes +=
+        data.tls_server_handshakes.load(std::memory_order_relaxed);
+    result->tls_server_resumed_handshakes +=
+        data.tls_server_resumed_handshakes.load(std::memory_order_relaxed);
+    result->tls_client_handshakes +=
+        data.tls_client_handshakes.load(std::memory_order_relaxed);
+    result->tls_client_resumed_handshakes +=
+        data.tls_client_resumed_handshakes.load(std::memory_order_relaxed);
+    result->tls_session_ticket_key_misses +=
+        data.tls_session_ticket_key_misses.load(std::memory_order_relaxed);
     data.call_initial_size.Collect(&result->call_initial_size);
     data.tcp_write_size.Collect(&result->tcp_write_size);
     data.tcp_write_iov_size.Collect(&result->tcp_write_iov_size);
@@ -636,6 +680,8 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         &result->chaotic_good_tcp_write_size_data);
     data.chaotic_good_tcp_write_size_control.Collect(
         &result->chaotic_good_tcp_write_size_control);
+    data.handshake_queue_time_us.Collect(&result->handshake_queue_time_us);
+    data.handshake_crypto_time_us.Collect(&result->handshake_crypto_time_us);
   }
   return result;
 }
@@ -685,6 +731,17 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
       uncommon_io_error_count - other.uncommon_io_error_count;
   result->msg_errqueue_error_count =
       msg_errqueue_error_count - other.msg_errqueue_error_count;
+  result->handshakes_shed = handshakes_shed - other.handshakes_shed;
+  result->tls_server_handshakes =
+      tls_server_handshakes - other.tls_server_handshakes;
+  result->tls_server_resumed_handshakes =
+      tls_server_resumed_handshakes - other.tls_server_resumed_handshakes;
+  result->tls_client_handshakes =
+      tls_client_handshakes - other.tls_client_handshakes;
+  result->tls_client_resumed_handshakes =
+      tls_client_resumed_handshakes - other.tls_client_resumed_handshakes;
+  result->tls_session_ticket_key_misses =
+      tls_session_ticket_key_misses - other.tls_session_ticket_key_misses;
   result->call_initial_size = call_initial_size - other.call_initial_size;
   result->tcp_write_size = tcp_write_size - other.tcp_write_size;
   result->tcp_write_iov_size = tcp_write_iov_size - other.tcp_write_iov_size;
@@ -747,6 +804,10 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
   result->chaotic_good_tcp_write_size_control =
       chaotic_good_tcp_write_size_control -
       other.chaotic_good_tcp_write_size_control;
+  result->handshake_queue_time_us =
+      handshake_queue_time_us - other.handshake_queue_time_us;
+  result->handshake_crypto_time_us =
+      handshake_crypto_time_us - other.handshake_crypto_time_us;
   return result;
 }
 }  // namespace grpc_core
@@ -202,6 +202,12 @@ struct GlobalStats {
     kEnobufsCount,
     kUncommonIoErrorCount,
     kMsgErrqueueErrorCount,
+    kHandshakesShed,
+    kTlsServerHandshakes,
+    kTlsServerResumedHandshakes,
+    kTlsClientHandshakes,
+    kTlsClientResumedHandshakes,
+    kTlsSessionTicketKeyMisses,
     COUNT
   };
   enum class Histogram {
@@ -233,6 +239,8 @@ struct GlobalStats {
     kChaoticGoodTcpReadOfferControl,
     kChaoticGoodTcpWriteSizeData,
     kChaoticGoodTcpWriteSizeControl,
+    kHandshakeQueueTimeUs,
+    kHandshakeCryptoTimeUs,
     COUNT
   };
   GlobalStats();
@@ -276,6 +284,12 @@ struct GlobalStats {
       uint64_t enobufs_count;
       uint64_t uncommon_io_error_count;
       uint64_t msg_errqueue_error_count;
+      uint64_t handshakes_shed;
+      uint64_t tls_server_handshakes;
+      uint64_t tls_server_resumed_handshakes;
+      uint64_t tls_client_handshakes;
+      uint64_t tls_client_resumed_handshakes;
+      uint64_t tls_session_ticket_key_misses;
     };
     uint64_t counters[static_cast<int>(Counter::COUNT)];
   };
@@ -307,6 +321,8 @@ struct GlobalStats {
   Histogram_16777216_20 chaotic_good_tcp_read_offer_control;
   Histogram_16777216_20 chaotic_good_tcp_write_size_data;
   Histogram_16777216_20 chaotic_good_tcp_write_size_control;
+  Histogram_16777216_20 handshake_queue_time_us;
+  Histogram_16777216_20 handshake_crypto_time_us;
   HistogramView histogram(Histogram which) const;
   std::unique_ptr<GlobalStats> Diff(const GlobalStats& other) const;
 };
@@ -423,6 +439,29 @@ class GlobalStatsCollector {
     data_.this_cpu().msg_errqueue_error_count.fetch_add(
         1, std::memory_order_relaxed);
   }
+  void IncrementHandshakesShed() {
+    data_.this_cpu().handshakes_shed.fetch_add(1, std::memory_order_relaxed);
+  }
+  void IncrementTlsServerHandshakes() {
+    data_.this_cpu().tls_server_handshakes.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementTlsServerResumedHandshakes() {
+    data_.this_cpu().tls_server_resumed_handshakes.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementTlsClientHandshakes() {
+    data_.this_cpu().tls_client_handshakes.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementTlsClientResumedHandshakes() {
+    data_.this_cpu().tls_client_resumed_handshakes.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementTlsSessionTicketKeyMisses() {
+    data_.this_cpu().tls_session_ticket_key_misses.fetch_add(
+        1, std::memory_order_relaxed);
+  }
   void IncrementCallInitialSize(int value) {
     data_.this_cpu().call_initial_size.Increment(value);
   }
@@ -508,6 +547,12 @@ class GlobalStatsCollector {
   void IncrementChaoticGoodTcpWriteSizeControl(int value) {
     data_.this_cpu().chaotic_good_tcp_write_size_control.Increment(value);
   }
+  void IncrementHandshakeQueueTimeUs(int value) {
+    data_.this_cpu().handshake_queue_time_us.Increment(value);
+  }
+  void IncrementHandshakeCryptoTimeUs(int value) {
+    data_.this_cpu().handshake_crypto_time_us.Increment(value);
+  }
 
  private:
   struct Data {
@@ -543,6 +588,12 @@ class GlobalStatsCollector {
     std::atomic<uint64_t> enobufs_count{0};
     std::atomic<uint64_t> uncommon_io_error_count{0};
     std::atomic<uint64_t> msg_errqueue_error_count{0};
+    std::atomic<uint64_t> handshakes_shed{0};
+    std::atomic<uint64_t> tls_server_handshakes{0};
+    std::atomic<uint64_t> tls_server_resumed_handshakes{0};
+    std::atomic<uint64_t> tls_client_handshakes{0};
+    std::atomic<uint64_t> tls_client_resumed_handshakes{0};
+    std::atomic<uint64_t> tls_session_ticket_key_misses{0};
     HistogramCollector_65536_26 call_initial_size;
     HistogramCollector_16777216_20 tcp_write_size;
     HistogramCollector_80_10 tcp_write_iov_size;
@@ -571,6 +622,8 @@ class GlobalStatsCollector {
     HistogramCollector_16777216_20 chaotic_good_tcp_read_offer_control;
     HistogramCollector_16777216_20 chaotic_good_tcp_write_size_data;
     HistogramCollector_16777216_20 chaotic_good_tcp_write_size_control;
+    HistogramCollector_16777216_20 handshake_queue_time_us;
+    HistogramCollector_16777216_20 handshake_crypto_time_us;
   };
   PerCpu<Data> data_{PerCpuOptions().SetCpusPerShard(4).SetMaxShards(32)};
 };
@@ -0,0 +1,222 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/coarse_timer_queue.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <utility>
+
+#include "absl/log/check.h"
+
+#include <grpc/support/cpu.h>
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/no_destruct.h"
+#include "src/core/lib/gprpp/time.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+
+struct Registry {
+  grpc_core::Mutex mu;
+  absl::flat_hash_map<EventEngine*, CoarseTimerQueue*> queues
+      ABSL_GUARDED_BY(mu);
+};
+
+grpc_core::NoDestruct<Registry> g_registry;
+
+std::atomic<size_t> g_next_thread_shard{0};
+thread_local size_t g_thread_shard = std::numeric_limits<size_t>::max();
+
+}  // namespace
+
+grpc_core::RefCountedPtr<CoarseTimerQueue> CoarseTimerQueue::Get(
+    std::shared_ptr<EventEngine> event_engine) {
+  grpc_core::MutexLock lock(&g_registry->mu);
+  CoarseTimerQueue*& queue = g_registry->queues[event_engine.get()];
+  // The queue may be on its way out, in which case it gets replaced here and
+  // its destructor leaves the new entry alone.
+  if (queue != nullptr) {
+    auto existing = queue->RefIfNonZero();
+    if (existing != nullptr) return existing;
+  }
+  auto fresh =
+      grpc_core::MakeRefCounted<CoarseTimerQueue>(std::move(event_engine));
+  queue = fresh.get();
+  return fresh;
+}
+
+CoarseTimerQueue::CoarseTimerQueue(std::shared_ptr<EventEngine> event_engine)
+    : event_engine_(std::move(event_engine)),
+      num_shards_(grpc_core::Clamp(gpr_cpu_num_cores(), 1u, 32u)),
+      shards_(new Shard[num_shards_]) {}
+
+CoarseTimerQueue::~CoarseTimerQueue() {
+  // Every armed bucket holds a ref to the queue, so there is nothing left to
+  // cancel here.
+  for (size_t i = 0; i < num_shards_; i++) {
+    grpc_core::MutexLock lock(&shards_[i].mu);
+    CHECK(shards_[i].buckets.empty());
+  }
+  grpc_core::MutexLock lock(&g_registry->mu);
+  auto it = g_registry->queues.find(event_engine_.get());
+  if (it != g_registry->queues.end() && it->second == this) {
+    g_registry->queues.erase(it);
+  }
+}
+
+EventEngine::TaskHandle CoarseTimerQueue::RunAfter(
+    EventEngine::Duration when, EventEngine::Closure* closure) {
+  return Schedule(when, closure, nullptr);
+}
+
+EventEngine::TaskHandle CoarseTimerQueue::RunAfter(
+    EventEngine::Duration when, absl::AnyInvocable<void()> closure) {
+  return Schedule(when, nullptr, std::move(closure));
+}
+
+CoarseTimerQueue::Shard* CoarseTimerQueue::ThreadShard() {
+  if (g_thread_shard == std::numeric_limits<size_t>::max()) {
+    g_thread_shard =
+        g_next_thread_shard.fetch_add(1, std::memory_order_relaxed);
+  }
+  return &shards_[g_thread_shard % num_shards_];
+}
+
+CoarseTimerQueue::Entry* CoarseTimerQueue::AllocEntry(Shard* shard) {
+  if (shard->free_list == nullptr) {
+    shard->slabs.emplace_back(new Entry[kEntriesPerSlab]);
+    Entry* slab = shard->slabs.back().get();
+    for (size_t i = 0; i < kEntriesPerSlab; i++) {
+      slab[i].shard = shard;
+      slab[i].next_free = i + 1 < kEntriesPerSlab ? &slab[i + 1] : nullptr;
+    }
+    shard->free_list = slab;
+  }
+  Entry* entry = shard->free_list;
+  shard->free_list = entry->next_free;
+  entry->seq = shard->next_seq++;
+  return entry;
+}
+
+void CoarseTimerQueue::FreeEntry(Shard* shard, Entry* entry) {
+  entry->seq = 0;
+  entry->bucket = nullptr;
+  entry->closure = nullptr;
+  entry->callback = nullptr;
+  entry->next_free = shard->free_list;
+  shard->free_list = entry;
+}
+
+EventEngine::TaskHandle CoarseTimerQueue::Schedule(
+    EventEngine::Duration when, EventEngine::Closure* closure,
+    absl::AnyInvocable<void()> callback) {
+  // Round up so that the closure never runs early.
+  auto when_ms_duration =
+      std::chrono::duration_cast<std::chrono::milliseconds>(when);
+  if (when_ms_duration < when) ++when_ms_duration;
+  const int64_t when_ms = std::max<int64_t>(0, when_ms_duration.count());
+  const int64_t now =
+      grpc_core::Timestamp::Now().milliseconds_after_process_epoch();
+  const int64_t deadline = grpc_core::SaturatingAdd(now, when_ms);
+  Shard* shard = ThreadShard();
+  grpc_core::MutexLock lock(&shard->mu);
+  Entry* entry = AllocEntry(shard);
+  entry->closure = closure;
+  entry->callback = std::move(callback);
+  std::unique_ptr<Bucket>& bucket = shard->buckets[deadline];
+  if (bucket == nullptr) {
+    bucket = std::make_unique<Bucket>();
+    bucket->deadline = deadline;
+    bucket->timer = event_engine_->RunAfter(
+        std::chrono::milliseconds(deadline - now),
+        [self = Ref(), shard, b = bucket.get()]() {
+          self->FireBucket(shard, b);
+        });
+  }
+  entry->bucket = bucket.get();
+  bucket->entries.push_back(entry);
+  ++bucket->live;
+  return {reinterpret_cast<intptr_t>(entry),
+          static_cast<intptr_t>(entry->seq)};
+}
+
+bool CoarseTimerQueue::Cancel(EventEngine::TaskHandle handle) {
+  if (handle == EventEngine::TaskHandle::kInvalid) return false;
+  Entry* entry = reinterpret_cast<Entry*>(handle.keys[0]);
+  // Entries are never returned to the allocator while the queue is alive, so
+  // their shard can be read without holding any lock.
+  Shard* shard = entry->shard;
+  Bucket* bucket;
+  {
+    grpc_core::MutexLock lock(&shard->mu);
+    if (entry->seq != static_cast<uint64_t>(handle.keys[1])) return false;
+    entry->seq = 0;
+    bucket = entry->bucket;
+    if (--bucket->live > 0) return true;
+    // Nothing live is left in the bucket: detach it, so that timers armed
+    // from now on go to a new bucket, and cancel its EventEngine timer
+    // without holding the shard lock.
+    auto it = shard->buckets.find(bucket->deadline);
+    CHECK(it != shard->buckets.end() && it->second.get() == bucket);
+    it->second.release();
+    shard->buckets.erase(it);
+  }
+  // The caller holds a ref to the queue, so dropping the bucket's closure
+  // here cannot destroy it.
+  if (event_engine_->Cancel(bucket->timer)) {
+    grpc_core::MutexLock lock(&shard->mu);
+    for (Entry* dead : bucket->entries) FreeEntry(shard, dead);
+    delete bucket;
+  }
+  // Otherwise the timer is firing, and FireBucket releases the bucket.
+  return true;
+}
+
+void CoarseTimerQueue::FireBucket(Shard* shard, Bucket* bucket) {
+  std::vector<EventEngine::Closure*> closures;
+  std::vector<absl::AnyInvocable<void()>> callbacks;
+  {
+    grpc_core::MutexLock lock(&shard->mu);
+    for (Entry* entry : bucket->entries) {
+      if (entry->seq != 0) {
+        if (entry->closure != nullptr) {
+          closures.push_back(entry->closure);
+        } else {
+          callbacks.push_back(std::move(entry->callback));
+        }
+      }
+      FreeEntry(shard, entry);
+    }
+    // A bucket detached by Cancel is no longer in the map, which may hold a
+    // new bucket for the same deadline.
+    auto it = shard->buckets.find(bucket->deadline);
+    if (it != shard->buckets.end() && it->second.get() == bucket) {
+      shard->buckets.erase(it);
+    } else {
+      delete bucket;
+    }
+  }
+  for (EventEngine::Closure* closure : closures) closure->Run();
+  for (auto& callback : callbacks) callback();
+}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
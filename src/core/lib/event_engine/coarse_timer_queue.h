@@ -0,0 +1,120 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_COARSE_TIMER_QUEUE_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_COARSE_TIMER_QUEUE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/functional/any_invocable.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+// Millisecond-bucketed timers layered on top of an EventEngine, for timers
+// that are armed at a high rate and almost always cancelled before they fire
+// (call deadlines, keepalive timers).
+//
+// Timers due in the same millisecond share a single EventEngine timer, so the
+// EventEngine only sees one RunAfter per bucket instead of one per timer, and
+// the closures of a bucket run as one batch when it fires. Timer entries come
+// from per-thread shards with their own free lists, and cancelling one only
+// marks it dead inside its bucket; the bucket's EventEngine timer is cancelled
+// once nothing live is left in it.
+//
+// RunAfter and Cancel follow the EventEngine semantics: closures are never run
+// inline, and Cancel returns true iff the closure will not run.
+class CoarseTimerQueue final : public grpc_core::RefCounted<CoarseTimerQueue> {
+ public:
+  // Returns the queue shared by all users of event_engine.
+  static grpc_core::RefCountedPtr<CoarseTimerQueue> Get(
+      std::shared_ptr<EventEngine> event_engine);
+
+  explicit CoarseTimerQueue(std::shared_ptr<EventEngine> event_engine);
+  ~CoarseTimerQueue() override;
+
+  EventEngine::TaskHandle RunAfter(EventEngine::Duration when,
+                                   EventEngine::Closure* closure);
+  EventEngine::TaskHandle RunAfter(EventEngine::Duration when,
+                                   absl::AnyInvocable<void()> closure);
+  bool Cancel(EventEngine::TaskHandle handle);
+
+  EventEngine* event_engine() const { return event_engine_.get(); }
+
+ private:
+  struct Shard;
+  struct Bucket;
+
+  struct Entry {
+    Shard* shard = nullptr;
+    // Matches the handle while the timer is pending; zero once it has been
+    // cancelled, has fired, or the entry is on the free list.
+    uint64_t seq = 0;
+    Bucket* bucket = nullptr;
+    EventEngine::Closure* closure = nullptr;
+    absl::AnyInvocable<void()> callback;
+    Entry* next_free = nullptr;
+  };
+
+  struct Bucket {
+    int64_t deadline;
+    EventEngine::TaskHandle timer = EventEngine::TaskHandle::kInvalid;
+    // Includes cancelled entries, which are released when the bucket fires.
+    std::vector<Entry*> entries;
+    size_t live = 0;
+  };
+
+  struct Shard {
+    grpc_core::Mutex mu;
+    uint64_t next_seq ABSL_GUARDED_BY(mu) = 1;
+    Entry* free_list ABSL_GUARDED_BY(mu) = nullptr;
+    std::vector<std::unique_ptr<Entry[]>> slabs ABSL_GUARDED_BY(mu);
+    absl::flat_hash_map<int64_t, std::unique_ptr<Bucket>> buckets
+        ABSL_GUARDED_BY(mu);
+  };
+
+  static constexpr size_t kEntriesPerSlab = 256;
+
+  EventEngine::TaskHandle Schedule(EventEngine::Duration when,
+                                   EventEngine::Closure* closure,
+                                   absl::AnyInvocable<void()> callback);
+  Shard* ThreadShard();
+  static Entry* AllocEntry(Shard* shard)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard->mu);
+  static void FreeEntry(Shard* shard, Entry* entry)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard->mu);
+  void FireBucket(Shard* shard, Bucket* bucket);
+
+  const std::shared_ptr<EventEngine> event_engine_;
+  const size_t num_shards_;
+  const std::unique_ptr<Shard[]> shards_;
+};
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_COARSE_TIMER_QUEUE_H
@@ -0,0 +1,105 @@
+// Copyright 2024 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/lib/event_engine/posix_engine/busy_poll.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/iomgr/port.h"
+
+#ifdef GRPC_LINUX_EPOLL
+#include <errno.h>
+#include <sched.h>
+#include <stdint.h>
+#include <sys/epoll.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <vector>
+
+#include <grpc/support/time.h>
+
+#include "src/core/lib/config/config_vars.h"
+#include "src/core/lib/resource_quota/thread_quota.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+
+// Returns the busy polling quota of cpu, or null if cpu is out of range.
+grpc_core::ThreadQuota* BusyPollQuota(int cpu) {
+  static const std::vector<grpc_core::ThreadQuota*>* quotas = [] {
+    const int32_t max_threads = std::max<int32_t>(
+        0, grpc_core::ConfigVars::Get().EpollBusyPollMaxThreads());
+    auto* quotas = new std::vector<grpc_core::ThreadQuota*>(
+        std::max<long>(1, sysconf(_SC_NPROCESSORS_CONF)));
+    for (auto& quota : *quotas) {
+      quota = new grpc_core::ThreadQuota();
+      quota->SetMax(max_threads);
+    }
+    return quotas;
+  }();
+  if (cpu < 0 || static_cast<size_t>(cpu) >= quotas->size()) return nullptr;
+  return (*quotas)[cpu];
+}
+
+}  // namespace
+
+int EpollWaitMaybeBusyPoll(int epfd, struct epoll_event* events,
+                           int max_events, int timeout_ms) {
+  const int32_t busy_poll_us = grpc_core::ConfigVars::Get().EpollBusyPollUs();
+  grpc_core::ThreadQuota* quota = nullptr;
+  if (busy_poll_us > 0 && timeout_ms != 0) {
+    quota = BusyPollQuota(sched_getcpu());
+    if (quota != nullptr && !quota->Reserve(1)) quota = nullptr;
+  }
+  if (quota != nullptr) {
+    const gpr_timespec start = gpr_now(GPR_CLOCK_MONOTONIC);
+    gpr_timespec spin_end =
+        gpr_time_add(start, gpr_time_from_micros(busy_poll_us, GPR_TIMESPAN));
+    if (timeout_ms > 0) {
+      spin_end = gpr_time_min(
+          spin_end,
+          gpr_time_add(start, gpr_time_from_millis(timeout_ms, GPR_TIMESPAN)));
+    }
+    int r = 0;
+    int saved_errno = 0;
+    gpr_timespec now = start;
+    while (gpr_time_cmp(now, spin_end) < 0) {
+      r = epoll_wait(epfd, events, max_events, 0);
+      saved_errno = errno;
+      if (r > 0 || (r < 0 && saved_errno != EINTR)) break;
+      now = gpr_now(GPR_CLOCK_MONOTONIC);
+    }
+    quota->Release(1);
+    if (r > 0 || (r < 0 && saved_errno != EINTR)) {
+      errno = saved_errno;
+      return r;
+    }
+    if (timeout_ms > 0) {
+      timeout_ms = static_cast<int>(std::max<int64_t>(
+          0, timeout_ms - gpr_time_to_millis(gpr_time_sub(now, start))));
+    }
+  }
+  int r;
+  do {
+    r = epoll_wait(epfd, events, max_events, timeout_ms);
+  } while (r < 0 && errno == EINTR);
+  return r;
+}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_LINUX_EPOLL
@@ -0,0 +1,46 @@
+// Copyright 2024 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_BUSY_POLL_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_BUSY_POLL_H
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/iomgr/port.h"
+
+#ifdef GRPC_LINUX_EPOLL
+
+struct epoll_event;
+
+namespace grpc_event_engine {
+namespace experimental {
+
+// Like epoll_wait(), but when busy polling is configured (see
+// ConfigVars::EpollBusyPollUs()) the calling thread first spins on
+// non-blocking epoll_wait() calls for up to that long, and only then blocks
+// for whatever remains of timeout_ms.
+//
+// Spinning pollers are budgeted per core: each cpu has a ThreadQuota sized by
+// ConfigVars::EpollBusyPollMaxThreads(), shared by the iomgr and EventEngine
+// pollers, and a poller reserves a slot on the cpu it starts spinning on. A
+// poller that finds the budget of its cpu used up blocks right away. EINTR is
+// retried internally.
+int EpollWaitMaybeBusyPoll(int epfd, struct epoll_event* events,
+                           int max_events, int timeout_ms);
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_LINUX_EPOLL
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_BUSY_POLL_H
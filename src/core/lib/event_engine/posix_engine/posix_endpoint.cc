@@ -76,6 +76,14 @@
 #define TCP_CM_INQ TCP_INQ
 #endif
 
+// Kernel TLS control message carrying the content type of a received record.
+#ifndef SOL_TLS
+#define SOL_TLS 282
+#endif
+#ifndef TLS_GET_RECORD_TYPE
+#define TLS_GET_RECORD_TYPE 2
+#endif
+
 #ifdef GRPC_HAVE_MSG_NOSIGNAL
 #define SENDMSG_FLAGS MSG_NOSIGNAL
 #else
@@ -211,6 +219,48 @@ bool CmsgIsZeroCopy(const cmsghdr& cmsg) {
 }
 #endif  // GRPC_LINUX_ERRQUEUE
 
+// With kernel TLS receive offload (see src/core/tsi/ssl/ktls), records other
+// than application data are returned by recvmsg() one at a time, with their
+// content type in a control message (or the read fails with EIO if there is
+// no room for it). The SSL library no longer sees the record layer, so such
+// records (alerts, post-handshake messages like KeyUpdate) end the
+// connection. Returns the error for the record read into msg, if it is one.
+absl::Status CheckTlsRecord(msghdr* msg, ssize_t read_bytes) {
+  for (cmsghdr* cmsg = CMSG_FIRSTHDR(msg); cmsg != nullptr;
+       cmsg = CMSG_NXTHDR(msg, cmsg)) {
+    if (cmsg->cmsg_level != SOL_TLS || cmsg->cmsg_type != TLS_GET_RECORD_TYPE ||
+        cmsg->cmsg_len < CMSG_LEN(sizeof(uint8_t))) {
+      continue;
+    }
+    const uint8_t type = *CMSG_DATA(cmsg);
+    const uint8_t* data = static_cast<const uint8_t*>(msg->msg_iov[0].iov_base);
+    const size_t length =
+        std::min(static_cast<size_t>(read_bytes), msg->msg_iov[0].iov_len);
+    switch (type) {
+      case 23:  // application_data
+        return absl::OkStatus();
+      case 21:  // alert
+        if (length >= 2) {
+          return absl::UnavailableError(absl::StrCat(
+              "TLS alert from peer: level ", data[0], ", description ",
+              data[1], data[1] == 0 ? " (close_notify)" : ""));
+        }
+        break;
+      case 22:  // handshake
+        if (length >= 1) {
+          return absl::UnavailableError(absl::StrCat(
+              "Unsupported TLS handshake message of type ", data[0],
+              data[0] == 24 ? " (KeyUpdate)" : "",
+              " from peer after the record layer moved to the kernel"));
+        }
+        break;
+    }
+    return absl::UnavailableError(
+        absl::StrCat("Unexpected TLS record of content type ", type));
+  }
+  return absl::OkStatus();
+}
+
 absl::Status PosixOSError(int error_no, const char* call_name) {
   absl::Status s = absl::UnknownError(grpc_core::StrError(error_no));
   grpc_core::StatusSetInt(&s, grpc_core::StatusIntProperty::kErrorNo, error_no);
@@ -328,13 +378,10 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
     msg.msg_namelen = 0;
     msg.msg_iov = iov;
     msg.msg_iovlen = static_cast<msg_iovlen_type>(iov_len);
-    if (inq_capable_) {
-      msg.msg_control = cmsgbuf;
-      msg.msg_controllen = sizeof(cmsgbuf);
-    } else {
-      msg.msg_control = nullptr;
-      msg.msg_controllen = 0;
-    }
+    // Always leave room for control messages, so that kernel TLS can report
+    // the type of records other than application data.
+    msg.msg_control = cmsgbuf;
+    msg.msg_controllen = sizeof(cmsgbuf);
     msg.msg_flags = 0;
 
     do {
@@ -371,6 +418,13 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
       return true;
     }
 
+    absl::Status tls_status = CheckTlsRecord(&msg, read_bytes);
+    if (!tls_status.ok()) {
+      incoming_buffer_->Clear();
+      status = TcpAnnotateError(std::move(tls_status));
+      return true;
+    }
+
     AddToEstimate(static_cast<size_t>(read_bytes));
     DCHECK((size_t)read_bytes <= incoming_buffer_->Length() - total_read_bytes);
 
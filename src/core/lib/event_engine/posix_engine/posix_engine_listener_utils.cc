@@ -170,6 +170,14 @@ absl::Status PrepareSocket(const PosixTcpOptions& options,
     GRPC_RETURN_IF_ERROR(socket.sock.SetSocketLowLatency(1));
     GRPC_RETURN_IF_ERROR(socket.sock.SetSocketReuseAddr(1));
     GRPC_RETURN_IF_ERROR(socket.sock.SetSocketDscp(options.dscp));
+    absl::Status busy_poll_status =
+        socket.sock.SetSocketBusyPoll(options.busy_poll_usec);
+    if (!busy_poll_status.ok()) {
+      // Raising SO_BUSY_POLL needs CAP_NET_ADMIN. It's not fatal: the server
+      // still works, just without busy polling.
+      gpr_log(GPR_ERROR, "Not busy polling listener sockets: %s",
+              busy_poll_status.ToString().c_str());
+    }
     socket.sock.TrySetSocketTcpUserTimeout(options, false);
   }
   GRPC_RETURN_IF_ERROR(socket.sock.SetSocketNoSigpipeIfPossible());
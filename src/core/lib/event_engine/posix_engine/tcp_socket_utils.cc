@@ -193,6 +193,8 @@ PosixTcpOptions TcpOptionsFromEndpointConfig(const EndpointConfig& config) {
                    config.GetInt(GRPC_ARG_EXPAND_WILDCARD_ADDRS)) != 0);
   options.dscp = AdjustValue(PosixTcpOptions::kDscpNotSet, 0, 63,
                              config.GetInt(GRPC_ARG_DSCP));
+  options.busy_poll_usec =
+      AdjustValue(0, 0, INT_MAX, config.GetInt(GRPC_ARG_TCP_BUSY_POLL_USEC));
   options.allow_reuse_port = PosixSocketWrapper::IsSocketReusePortSupported();
   auto allow_reuse_port_value = config.GetInt(GRPC_ARG_ALLOW_REUSEPORT);
   if (allow_reuse_port_value.has_value()) {
@@ -568,6 +570,34 @@ absl::Status PosixSocketWrapper::SetSocketDscp(int dscp) {
   return absl::OkStatus();
 }
 
+// Set SO_BUSY_POLL (and SO_PREFER_BUSY_POLL where available)
+absl::Status PosixSocketWrapper::SetSocketBusyPoll(int busy_poll_usec) {
+  if (busy_poll_usec <= 0) {
+    return absl::OkStatus();
+  }
+#ifdef SO_BUSY_POLL
+  if (0 != setsockopt(fd_, SOL_SOCKET, SO_BUSY_POLL, &busy_poll_usec,
+                      sizeof(busy_poll_usec))) {
+    return absl::Status(
+        absl::StatusCode::kInternal,
+        absl::StrCat("setsockopt(SO_BUSY_POLL): ", grpc_core::StrError(errno)));
+  }
+#ifdef SO_PREFER_BUSY_POLL
+  // Kernels older than 5.11 reject this; busy polling still works there.
+  int prefer = 1;
+  if (0 != setsockopt(fd_, SOL_SOCKET, SO_PREFER_BUSY_POLL, &prefer,
+                      sizeof(prefer))) {
+    gpr_log(GPR_DEBUG, "setsockopt(SO_PREFER_BUSY_POLL): %s",
+            grpc_core::StrError(errno).c_str());
+  }
+#endif
+  return absl::OkStatus();
+#else
+  return absl::UnimplementedError(
+      "SO_BUSY_POLL unavailable on compiling system");
+#endif
+}
+
 #if GPR_LINUX == 1
 // For Linux, it will be detected to support TCP_USER_TIMEOUT
 #ifndef TCP_USER_TIMEOUT
@@ -852,6 +882,10 @@ absl::Status PosixSocketWrapper::SetSocketDscp(int /*dscp*/) {
   grpc_core::Crash("unimplemented");
 }
 
+absl::Status PosixSocketWrapper::SetSocketBusyPoll(int /*busy_poll_usec*/) {
+  grpc_core::Crash("unimplemented");
+}
+
 void PosixSocketWrapper::ConfigureDefaultTcpUserTimeout(bool /*enable*/,
                                                         int /*timeout*/,
                                                         bool /*is_client*/) {}
@@ -74,6 +74,7 @@ struct PosixTcpOptions {
   bool expand_wildcard_addrs = false;
   bool allow_reuse_port = false;
   int dscp = kDscpNotSet;
+  int busy_poll_usec = 0;
   grpc_core::RefCountedPtr<grpc_core::ResourceQuota> resource_quota;
   struct grpc_socket_mutator* socket_mutator = nullptr;
   grpc_event_engine::experimental::MemoryAllocatorFactory*
@@ -145,6 +146,7 @@ struct PosixTcpOptions {
     expand_wildcard_addrs = other.expand_wildcard_addrs;
     allow_reuse_port = other.allow_reuse_port;
     dscp = other.dscp;
+    busy_poll_usec = other.busy_poll_usec;
   }
 };
 
@@ -195,6 +197,10 @@ class PosixSocketWrapper {
   // Set Differentiated Services Code Point (DSCP)
   absl::Status SetSocketDscp(int dscp);
 
+  // Set SO_BUSY_POLL (and SO_PREFER_BUSY_POLL where available) if
+  // busy_poll_usec is positive
+  absl::Status SetSocketBusyPoll(int busy_poll_usec);
+
   // Override default Tcp user timeout values if necessary.
   void TrySetSocketTcpUserTimeout(const PosixTcpOptions& options,
                                   bool is_client);
@@ -30,6 +30,8 @@
 #include <grpc/support/time.h>
 
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+#include "src/core/lib/experiments/experiments.h"
 
 static thread_local bool g_timer_thread;
 
@@ -89,7 +91,11 @@ bool TimerManager::IsTimerManagerThread() { return g_timer_thread; }
 TimerManager::TimerManager(
     std::shared_ptr<grpc_event_engine::experimental::ThreadPool> thread_pool)
     : host_(this), thread_pool_(std::move(thread_pool)) {
-  timer_list_ = std::make_unique<TimerList>(&host_);
+  if (grpc_core::IsEventEngineTimerWheelEnabled()) {
+    timer_list_ = std::make_unique<TimerWheel>(&host_);
+  } else {
+    timer_list_ = std::make_unique<TimerList>(&host_);
+  }
   main_loop_exit_signal_.emplace();
   thread_pool_->Run([this]() { MainLoop(); });
 }
@@ -99,7 +99,7 @@ class TimerManager final : public grpc_event_engine::experimental::Forkable {
   // number of timer wakeups
   uint64_t wakeups_ ABSL_GUARDED_BY(mu_) = false;
   // actual timer implementation
-  std::unique_ptr<TimerList> timer_list_;
+  std::unique_ptr<TimerListInterface> timer_list_;
   std::shared_ptr<grpc_event_engine::experimental::ThreadPool> thread_pool_;
   absl::optional<grpc_core::Notification> main_loop_exit_signal_;
 };
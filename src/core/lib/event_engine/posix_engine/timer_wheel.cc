@@ -0,0 +1,229 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+
+#include "absl/numeric/bits.h"
+
+#include <grpc/support/cpu.h>
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/time.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+// Bits [lo, lo + n) of a 64 bit word, wrapping around at the top.
+uint64_t RotatedMask(size_t lo, size_t n) {
+  if (n >= 64) return ~uint64_t{0};
+  return absl::rotl((uint64_t{1} << n) - 1, static_cast<int>(lo));
+}
+}  // namespace
+
+void TimerWheel::Shard::Add(Timer* timer) {
+  size_t index;
+  if (timer->deadline <= now) {
+    index = kDueSlot;
+  } else {
+    const uint64_t deadline = static_cast<uint64_t>(timer->deadline);
+    const int level =
+        (63 - absl::countl_zero(deadline ^ static_cast<uint64_t>(now))) /
+        kBitsPerLevel;
+    const size_t slot =
+        (deadline >> (level * kBitsPerLevel)) & (kSlotsPerLevel - 1);
+    index = level * kSlotsPerLevel + slot;
+    occupied[level] |= uint64_t{1} << slot;
+  }
+  timer->heap_index = index;
+  timer->prev = nullptr;
+  timer->next = slots[index];
+  if (timer->next != nullptr) timer->next->prev = timer;
+  slots[index] = timer;
+}
+
+void TimerWheel::Shard::Remove(Timer* timer) {
+  const size_t index = timer->heap_index;
+  if (timer->prev != nullptr) {
+    timer->prev->next = timer->next;
+  } else {
+    slots[index] = timer->next;
+  }
+  if (timer->next != nullptr) timer->next->prev = timer->prev;
+  if (slots[index] == nullptr && index != kDueSlot) {
+    occupied[index / kSlotsPerLevel] &=
+        ~(uint64_t{1} << (index % kSlotsPerLevel));
+  }
+}
+
+void TimerWheel::Shard::Advance(
+    int64_t new_now, std::vector<experimental::EventEngine::Closure*>* out) {
+  // Gather everything that may have come due: already-due timers, and on each
+  // level the slots whose start time lies in (now, new_now]. A level only
+  // turns if the level below it wrapped, so stop at the first level that did
+  // not move.
+  Timer* todo = std::exchange(slots[kDueSlot], nullptr);
+  if (new_now > now) {
+    for (int level = 0; level < kLevels; level++) {
+      const int shift = level * kBitsPerLevel;
+      const uint64_t old_tick = static_cast<uint64_t>(now) >> shift;
+      const uint64_t new_tick = static_cast<uint64_t>(new_now) >> shift;
+      if (old_tick == new_tick) break;
+      uint64_t pending =
+          occupied[level] & RotatedMask((old_tick + 1) & (kSlotsPerLevel - 1),
+                                        new_tick - old_tick);
+      occupied[level] &= ~pending;
+      while (pending != 0) {
+        const int slot = absl::countr_zero(pending);
+        pending &= pending - 1;
+        Timer*& head = slots[level * kSlotsPerLevel + slot];
+        Timer* tail = head;
+        while (tail->next != nullptr) tail = tail->next;
+        tail->next = todo;
+        todo = std::exchange(head, nullptr);
+      }
+    }
+    now = new_now;
+  }
+  while (todo != nullptr) {
+    Timer* timer = todo;
+    todo = timer->next;
+    if (timer->deadline <= now) {
+      timer->pending = false;
+      out->push_back(timer->closure);
+    } else {
+      Add(timer);
+    }
+  }
+}
+
+grpc_core::Timestamp TimerWheel::Shard::ComputeMinDeadline() {
+  if (slots[kDueSlot] != nullptr) {
+    return grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(now);
+  }
+  // Every slot start on a level is later than any deadline filed on the
+  // levels below it, so the first occupied level holds the minimum.
+  for (int level = 0; level < kLevels; level++) {
+    if (occupied[level] == 0) continue;
+    const int shift = level * kBitsPerLevel;
+    const uint64_t tick = (static_cast<uint64_t>(now) >> shift) + 1;
+    const uint64_t ahead = absl::countr_zero(absl::rotr(
+        occupied[level], static_cast<int>(tick & (kSlotsPerLevel - 1))));
+    return grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+        static_cast<int64_t>((tick + ahead) << shift));
+  }
+  return grpc_core::Timestamp::InfFuture();
+}
+
+TimerWheel::TimerWheel(TimerListHost* host)
+    : host_(host),
+      num_shards_(grpc_core::Clamp(2 * gpr_cpu_num_cores(), 1u, 32u)),
+      min_timer_(host_->Now().milliseconds_after_process_epoch()),
+      shards_(new Shard[num_shards_]) {
+  for (size_t i = 0; i < num_shards_; i++) {
+    Shard& shard = shards_[i];
+    grpc_core::MutexLock lock(&shard.mu);
+    shard.now = min_timer_.load(std::memory_order_relaxed);
+    shard.min_deadline = shard.ComputeMinDeadline();
+  }
+}
+
+void TimerWheel::TimerInit(Timer* timer, grpc_core::Timestamp deadline,
+                           experimental::EventEngine::Closure* closure) {
+  bool is_first_timer = false;
+  Shard* shard = &shards_[grpc_core::HashPointer(timer, num_shards_)];
+  timer->closure = closure;
+  timer->deadline = deadline.milliseconds_after_process_epoch();
+
+#ifndef NDEBUG
+  timer->hash_table_next = nullptr;
+#endif
+
+  {
+    grpc_core::MutexLock lock(&shard->mu);
+    timer->pending = true;
+    shard->Add(timer);
+    if (deadline < shard->min_deadline) {
+      shard->min_deadline = deadline;
+      is_first_timer = true;
+    }
+  }
+
+  // As in TimerList, lowering the global minimum happens under mu_, which
+  // FindExpiredTimers holds for its whole scan: either the scan saw this
+  // timer, or we get to lower min_timer_ after it is done.
+  if (is_first_timer) {
+    grpc_core::MutexLock lock(&mu_);
+    if (static_cast<uint64_t>(deadline.milliseconds_after_process_epoch()) <
+        min_timer_.load(std::memory_order_relaxed)) {
+      min_timer_.store(deadline.milliseconds_after_process_epoch(),
+                       std::memory_order_relaxed);
+      host_->Kick();
+    }
+  }
+}
+
+bool TimerWheel::TimerCancel(Timer* timer) {
+  Shard* shard = &shards_[grpc_core::HashPointer(timer, num_shards_)];
+  grpc_core::MutexLock lock(&shard->mu);
+  if (!timer->pending) return false;
+  timer->pending = false;
+  shard->Remove(timer);
+  return true;
+}
+
+std::vector<experimental::EventEngine::Closure*> TimerWheel::FindExpiredTimers(
+    grpc_core::Timestamp now, grpc_core::Timestamp* next) {
+  std::vector<experimental::EventEngine::Closure*> done;
+  grpc_core::MutexLock lock(&mu_);
+  grpc_core::Timestamp min_deadline = grpc_core::Timestamp::InfFuture();
+  for (size_t i = 0; i < num_shards_; i++) {
+    Shard& shard = shards_[i];
+    grpc_core::MutexLock shard_lock(&shard.mu);
+    if (shard.min_deadline <= now) {
+      shard.Advance(now.milliseconds_after_process_epoch(), &done);
+      shard.min_deadline = shard.ComputeMinDeadline();
+    }
+    min_deadline = std::min(min_deadline, shard.min_deadline);
+  }
+  if (next != nullptr) *next = std::min(*next, min_deadline);
+  min_timer_.store(min_deadline.milliseconds_after_process_epoch(),
+                   std::memory_order_relaxed);
+  return done;
+}
+
+absl::optional<std::vector<experimental::EventEngine::Closure*>>
+TimerWheel::TimerCheck(grpc_core::Timestamp* next) {
+  grpc_core::Timestamp now = host_->Now();
+  grpc_core::Timestamp min_timer =
+      grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+          min_timer_.load(std::memory_order_relaxed));
+  if (now < min_timer) {
+    if (next != nullptr) *next = std::min(*next, min_timer);
+    return std::vector<experimental::EventEngine::Closure*>();
+  }
+  if (!checker_mu_.TryLock()) return absl::nullopt;
+  std::vector<experimental::EventEngine::Closure*> run =
+      FindExpiredTimers(now, next);
+  checker_mu_.Unlock();
+  return std::move(run);
+}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
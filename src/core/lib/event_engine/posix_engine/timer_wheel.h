@@ -0,0 +1,113 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
+
+#include <stddef.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/types/optional.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/time.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+// Hierarchical timing wheel, sharded the same way as TimerList.
+//
+// Each shard keeps kLevels wheels of kSlotsPerLevel slots; a slot on level L
+// covers kSlotsPerLevel^L milliseconds. A timer is filed on the level of the
+// most significant bit group in which its deadline differs from the shard's
+// current time, so insertion and cancellation are O(1) list operations. As
+// time advances, the slots that come due on higher levels are re-filed closer
+// to their deadline ("cascaded"), and the timers that come due on level 0 are
+// returned. Most timers are cancelled long before they cascade at all.
+class TimerWheel final : public TimerListInterface {
+ public:
+  explicit TimerWheel(TimerListHost* host);
+
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+
+  void TimerInit(Timer* timer, grpc_core::Timestamp deadline,
+                 experimental::EventEngine::Closure* closure) override;
+  GRPC_MUST_USE_RESULT bool TimerCancel(Timer* timer) override;
+  absl::optional<std::vector<experimental::EventEngine::Closure*>> TimerCheck(
+      grpc_core::Timestamp* next) override;
+
+ private:
+  static constexpr int kBitsPerLevel = 6;
+  static constexpr size_t kSlotsPerLevel = size_t{1} << kBitsPerLevel;
+  // Enough levels to cover every 64-bit millisecond deadline.
+  static constexpr int kLevels = (64 + kBitsPerLevel - 1) / kBitsPerLevel;
+  // Slot for timers that were already due when they were added.
+  static constexpr size_t kDueSlot = kLevels * kSlotsPerLevel;
+
+  struct Shard {
+    // File timer in the slot matching its deadline.
+    void Add(Timer* timer) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    void Remove(Timer* timer) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // Move the shard's time forward to now, appending the closures of all
+    // timers that became due to out.
+    void Advance(int64_t now,
+                 std::vector<experimental::EventEngine::Closure*>* out)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // A lower bound for the earliest deadline in the shard: exact for timers
+    // on level 0, the start of the slot for timers that still need to
+    // cascade.
+    grpc_core::Timestamp ComputeMinDeadline() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+
+    grpc_core::Mutex mu;
+    // All timers with deadline <= now have been popped from the wheel.
+    int64_t now ABSL_GUARDED_BY(mu) = 0;
+    // Lower bound on the deadline of the next timer due in this shard.
+    grpc_core::Timestamp min_deadline ABSL_GUARDED_BY(mu);
+    // Bit s of occupied[L] is set iff slots[L * kSlotsPerLevel + s] is
+    // non-empty.
+    uint64_t occupied[kLevels] ABSL_GUARDED_BY(mu) = {};
+    // Doubly linked lists of timers (through Timer::next/prev), headed here.
+    Timer* slots[kDueSlot + 1] ABSL_GUARDED_BY(mu) = {};
+  };
+
+  std::vector<experimental::EventEngine::Closure*> FindExpiredTimers(
+      grpc_core::Timestamp now, grpc_core::Timestamp* next);
+
+  TimerListHost* const host_;
+  const size_t num_shards_;
+  grpc_core::Mutex mu_;
+  // The deadline of the next timer due across all timer shards
+  std::atomic<uint64_t> min_timer_;
+  // Allow only one FindExpiredTimers at once (used as a TryLock, protects no
+  // fields but ensures limits on concurrency)
+  grpc_core::Mutex checker_mu_;
+  // Whenever a timer is added, its address is hashed to select the shard to
+  // add the timer to.
+  const std::unique_ptr<Shard[]> shards_;
+};
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
@@ -0,0 +1,170 @@
+// Copyright 2024 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif  // _GNU_SOURCE
+
+#include "src/core/lib/event_engine/thread_pool/numa_topology.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/strip.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/event_engine/trace.h"
+#include "src/core/lib/gprpp/no_destruct.h"
+
+#ifdef GPR_LINUX
+#include <sched.h>
+#endif
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+
+// Upper bound on cpu numbers accepted from sysfs.
+constexpr int kMaxCpus = 1 << 16;
+
+// Returns the contents of a small file, or nullopt if it cannot be read.
+absl::optional<std::string> ReadSysfsFile(const std::string& path) {
+  FILE* file = fopen(path.c_str(), "r");
+  if (file == nullptr) return absl::nullopt;
+  char buf[4096];
+  size_t len = fread(buf, 1, sizeof(buf) - 1, file);
+  fclose(file);
+  if (len == 0) return absl::nullopt;
+  return std::string(buf, len);
+}
+
+#if defined(GPR_LINUX) && !defined(GPR_MUSL_LIBC_COMPAT)
+// The cpus that the process may run on, if known.
+absl::optional<std::vector<int>> AllowedCpus() {
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(0, sizeof(set), &set) != 0) return absl::nullopt;
+  std::vector<int> cpus;
+  for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+    if (CPU_ISSET(cpu, &set)) cpus.push_back(cpu);
+  }
+  return cpus;
+}
+#endif
+
+}  // namespace
+
+absl::optional<std::vector<int>> ParseCpuList(absl::string_view list) {
+  std::vector<int> cpus;
+  list = absl::StripAsciiWhitespace(list);
+  if (list.empty()) return cpus;
+  for (absl::string_view range : absl::StrSplit(list, ',')) {
+    std::pair<absl::string_view, absl::string_view> bounds =
+        absl::StrSplit(range, absl::MaxSplits('-', 1));
+    int first;
+    int last;
+    if (!absl::SimpleAtoi(bounds.first, &first)) return absl::nullopt;
+    if (bounds.second.empty()) {
+      last = first;
+    } else if (!absl::SimpleAtoi(bounds.second, &last)) {
+      return absl::nullopt;
+    }
+    if (first < 0 || last < first || last >= kMaxCpus) return absl::nullopt;
+    for (int cpu = first; cpu <= last; cpu++) cpus.push_back(cpu);
+  }
+  std::sort(cpus.begin(), cpus.end());
+  cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+  return cpus;
+}
+
+NumaTopology::NumaTopology(std::vector<std::vector<int>> node_cpus)
+    : node_cpus_(std::move(node_cpus)) {
+  if (node_cpus_.empty()) node_cpus_.emplace_back();
+}
+
+NumaTopology NumaTopology::FromSysfs(
+    const std::string& sysfs_root,
+    const absl::optional<std::vector<int>>& allowed_cpus) {
+  const std::string node_dir = sysfs_root + "/devices/system/node";
+  auto online = ReadSysfsFile(node_dir + "/online");
+  if (!online.has_value()) return NumaTopology({});
+  auto nodes = ParseCpuList(*online);
+  if (!nodes.has_value()) return NumaTopology({});
+  std::vector<std::vector<int>> node_cpus;
+  for (int node : *nodes) {
+    auto cpulist =
+        ReadSysfsFile(absl::StrCat(node_dir, "/node", node, "/cpulist"));
+    if (!cpulist.has_value()) return NumaTopology({});
+    auto cpus = ParseCpuList(*cpulist);
+    if (!cpus.has_value()) return NumaTopology({});
+    if (allowed_cpus.has_value()) {
+      cpus->erase(std::remove_if(cpus->begin(), cpus->end(),
+                                 [&allowed_cpus](int cpu) {
+                                   return !std::binary_search(
+                                       allowed_cpus->begin(),
+                                       allowed_cpus->end(), cpu);
+                                 }),
+                  cpus->end());
+    }
+    if (cpus->empty()) continue;
+    node_cpus.push_back(std::move(*cpus));
+  }
+  return NumaTopology(std::move(node_cpus));
+}
+
+const NumaTopology& NumaTopology::Get() {
+  static grpc_core::NoDestruct<NumaTopology> topology([] {
+#if defined(GPR_LINUX) && !defined(GPR_MUSL_LIBC_COMPAT)
+    NumaTopology topology = FromSysfs("/sys", AllowedCpus());
+#elif defined(GPR_LINUX)
+    NumaTopology topology = FromSysfs("/sys");
+#else
+    NumaTopology topology({});
+#endif
+    GRPC_EVENT_ENGINE_TRACE("NUMA topology: %" PRIuPTR " node(s)",
+                            topology.num_nodes());
+    return topology;
+  }());
+  return *topology;
+}
+
+bool NumaTopology::BindCurrentThread(size_t node) const {
+#if defined(GPR_LINUX) && !defined(GPR_MUSL_LIBC_COMPAT)
+  if (node_cpus_[node].empty()) return false;
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) return false;
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (int cpu : node_cpus_[node]) {
+    if (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed)) CPU_SET(cpu, &set);
+  }
+  if (CPU_COUNT(&set) == 0) return false;
+  return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+  (void)node;
+  return false;
+#endif
+}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
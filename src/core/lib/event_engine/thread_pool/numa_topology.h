@@ -0,0 +1,69 @@
+// Copyright 2024 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_THREAD_POOL_NUMA_TOPOLOGY_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_THREAD_POOL_NUMA_TOPOLOGY_H
+
+#include <stddef.h>
+
+#include <string>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+
+#include <grpc/support/port_platform.h>
+
+namespace grpc_event_engine {
+namespace experimental {
+
+// The NUMA nodes of the machine and the cpus belonging to each.
+//
+// On Linux this is read from /sys/devices/system/node, keeping only the cpus
+// that the process is allowed to run on. Everywhere else, and whenever sysfs
+// cannot be read, the machine is reported as a single node. Nodes without
+// (allowed) cpus are left out, so node indices here need not match the
+// kernel's node ids.
+class NumaTopology {
+ public:
+  // The topology of this machine, detected once.
+  static const NumaTopology& Get();
+  // Reads the topology from a sysfs tree rooted at sysfs_root (normally
+  // "/sys"), restricted to allowed_cpus if set. Exposed for testing.
+  static NumaTopology FromSysfs(
+      const std::string& sysfs_root,
+      const absl::optional<std::vector<int>>& allowed_cpus = absl::nullopt);
+
+  size_t num_nodes() const { return node_cpus_.size(); }
+  // Cpus of the given node, in increasing order. Empty for the single node of
+  // a machine whose topology is unknown.
+  const std::vector<int>& cpus(size_t node) const { return node_cpus_[node]; }
+  // Restricts the calling thread to the cpus of node that it may already run
+  // on. Returns false, leaving the thread as it was, if that is not supported
+  // here, failed, or would leave the thread without cpus.
+  bool BindCurrentThread(size_t node) const;
+
+ private:
+  explicit NumaTopology(std::vector<std::vector<int>> node_cpus);
+
+  std::vector<std::vector<int>> node_cpus_;
+};
+
+// Parses a Linux cpu or node list such as "0-3,8,10-11\n". Returns nullopt if
+// it is malformed.
+absl::optional<std::vector<int>> ParseCpuList(absl::string_view list);
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_THREAD_POOL_NUMA_TOPOLOGY_H
@@ -41,6 +41,7 @@
 #include "src/core/lib/event_engine/trace.h"
 #include "src/core/lib/event_engine/work_queue/basic_work_queue.h"
 #include "src/core/lib/event_engine/work_queue/work_queue.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gprpp/crash.h"
 #include "src/core/lib/gprpp/env.h"
 #include "src/core/lib/gprpp/examine_stack.h"
@@ -227,7 +228,14 @@ void WorkStealingThreadPool::PostforkChild() { pool_->Postfork(); }
 
 WorkStealingThreadPool::WorkStealingThreadPoolImpl::WorkStealingThreadPoolImpl(
     size_t reserve_threads)
-    : reserve_threads_(reserve_threads), queue_(this), lifeguard_(this) {}
+    : reserve_threads_(reserve_threads),
+      numa_(grpc_core::IsNumaAwareThreadPoolEnabled() &&
+                    NumaTopology::Get().num_nodes() > 1
+                ? &NumaTopology::Get()
+                : nullptr),
+      theft_registries_(new TheftRegistry[num_nodes()]),
+      queue_(this),
+      lifeguard_(this) {}
 
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Start() {
   for (size_t i = 0; i < reserve_threads_; i++) {
@@ -249,7 +257,20 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Run(
   work_signal_.Signal();
 }
 
+EventEngine::Closure*
+WorkStealingThreadPool::WorkStealingThreadPoolImpl::StealOne(size_t node) {
+  // Stealing from the local node first keeps closures, and the memory they
+  // touch, on the node that produced them.
+  for (size_t i = 0; i < num_nodes(); i++) {
+    auto* closure = theft_registries_[(node + i) % num_nodes()].StealOne();
+    if (closure != nullptr) return closure;
+  }
+  return nullptr;
+}
+
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::StartThread() {
+  const size_t node =
+      next_thread_node_.fetch_add(1, std::memory_order_relaxed) % num_nodes();
   last_started_thread_.store(
       grpc_core::Timestamp::Now().milliseconds_after_process_epoch(),
       std::memory_order_relaxed);
@@ -260,7 +281,7 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::StartThread() {
         worker->ThreadBody();
         delete worker;
       },
-      new ThreadState(shared_from_this()), nullptr,
+      new ThreadState(shared_from_this(), node), nullptr,
       grpc_core::Thread::Options().set_tracked(false).set_joinable(false))
       .Start();
 }
@@ -470,7 +491,7 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Lifeguard::
 // -------- WorkStealingThreadPool::ThreadState --------
 
 WorkStealingThreadPool::ThreadState::ThreadState(
-    std::shared_ptr<WorkStealingThreadPoolImpl> pool)
+    std::shared_ptr<WorkStealingThreadPoolImpl> pool, size_t node)
     : pool_(std::move(pool)),
       auto_thread_counter_(
           pool_->living_thread_count()->MakeAutoThreadCounter()),
@@ -478,7 +499,8 @@ WorkStealingThreadPool::ThreadState::ThreadState(
                    .set_initial_backoff(kWorkerThreadMinSleepBetweenChecks)
                    .set_max_backoff(kWorkerThreadMaxSleepBetweenChecks)
                    .set_multiplier(1.3)),
-      busy_count_idx_(pool_->busy_thread_count()->NextIndex()) {}
+      busy_count_idx_(pool_->busy_thread_count()->NextIndex()),
+      node_(node) {}
 
 void WorkStealingThreadPool::ThreadState::ThreadBody() {
   if (g_log_verbose_failures) {
@@ -489,8 +511,12 @@ void WorkStealingThreadPool::ThreadState::ThreadBody() {
 #endif
     pool_->TrackThread(gpr_thd_currentid());
   }
+  if (pool_->numa() != nullptr && !pool_->numa()->BindCurrentThread(node_)) {
+    GRPC_EVENT_ENGINE_TRACE("Failed to bind thread to NUMA node %" PRIuPTR,
+                            node_);
+  }
   g_local_queue = new BasicWorkQueue(pool_.get());
-  pool_->theft_registry()->Enroll(g_local_queue);
+  pool_->theft_registry(node_)->Enroll(g_local_queue);
   ThreadLocal::SetIsEventEngineThread(true);
   while (Step()) {
     // loop until the thread should no longer run
@@ -509,7 +535,7 @@ void WorkStealingThreadPool::ThreadState::ThreadBody() {
     FinishDraining();
   }
   CHECK(g_local_queue->Empty());
-  pool_->theft_registry()->Unenroll(g_local_queue);
+  pool_->theft_registry(node_)->Unenroll(g_local_queue);
   delete g_local_queue;
   if (g_log_verbose_failures) {
     pool_->UntrackThread(gpr_thd_currentid());
@@ -551,7 +577,7 @@ bool WorkStealingThreadPool::ThreadState::Step() {
       break;
     };
     // Try stealing if the queue is empty
-    closure = pool_->theft_registry()->StealOne();
+    closure = pool_->StealOne(node_);
     if (closure != nullptr) {
       should_run_again = true;
       break;
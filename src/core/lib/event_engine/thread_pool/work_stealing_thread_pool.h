@@ -33,6 +33,7 @@
 #include <grpc/support/thd_id.h>
 
 #include "src/core/lib/backoff/backoff.h"
+#include "src/core/lib/event_engine/thread_pool/numa_topology.h"
 #include "src/core/lib/event_engine/thread_pool/thread_count.h"
 #include "src/core/lib/event_engine/thread_pool/thread_pool.h"
 #include "src/core/lib/event_engine/work_queue/basic_work_queue.h"
@@ -110,6 +111,9 @@ class WorkStealingThreadPool final : public ThreadPool {
     // Add a closure to a work queue, preferably a thread-local queue if
     // available, otherwise the global queue.
     void Run(EventEngine::Closure* closure);
+    // Returns one closure from another worker thread, preferring workers on
+    // the given NUMA node, or nullptr if none are available.
+    EventEngine::Closure* StealOne(size_t node);
     // Start a new thread.
     // The reason argument determines whether thread creation is rate-limited;
     // threads created to populate the initial pool are not rate-limited, but
@@ -142,7 +146,16 @@ class WorkStealingThreadPool final : public ThreadPool {
     size_t reserve_threads() { return reserve_threads_; }
     BusyThreadCount* busy_thread_count() { return &busy_thread_count_; }
     LivingThreadCount* living_thread_count() { return &living_thread_count_; }
-    TheftRegistry* theft_registry() { return &theft_registry_; }
+    // Workers are grouped by NUMA node when the pool is NUMA aware, and
+    // otherwise all belong to node 0.
+    size_t num_nodes() const {
+      return numa_ == nullptr ? 1 : numa_->num_nodes();
+    }
+    // Null unless workers should be bound to the cpus of their node.
+    const NumaTopology* numa() const { return numa_; }
+    TheftRegistry* theft_registry(size_t node) {
+      return &theft_registries_[node];
+    }
     WorkQueue* queue() { return &queue_; }
     WorkSignal* work_signal() { return &work_signal_; }
 
@@ -180,7 +193,11 @@ class WorkStealingThreadPool final : public ThreadPool {
     const size_t reserve_threads_;
     BusyThreadCount busy_thread_count_;
     LivingThreadCount living_thread_count_;
-    TheftRegistry theft_registry_;
+    const NumaTopology* const numa_;
+    // One per node.
+    const std::unique_ptr<TheftRegistry[]> theft_registries_;
+    // Spreads new threads over the nodes.
+    std::atomic<size_t> next_thread_node_{0};
     BasicWorkQueue queue_;
     // Track shutdown and fork bits separately.
     // It's possible for a ThreadPool to initiate shut down while fork handlers
@@ -202,7 +219,7 @@ class WorkStealingThreadPool final : public ThreadPool {
 
   class ThreadState {
    public:
-    explicit ThreadState(std::shared_ptr<WorkStealingThreadPoolImpl> pool);
+    ThreadState(std::shared_ptr<WorkStealingThreadPoolImpl> pool, size_t node);
     void ThreadBody();
     void SleepIfRunning();
     bool Step();
@@ -220,6 +237,8 @@ class WorkStealingThreadPool final : public ThreadPool {
     LivingThreadCount::AutoThreadCounter auto_thread_counter_;
     grpc_core::BackOff backoff_;
     size_t busy_count_idx_;
+    // The NUMA node this thread belongs to.
+    const size_t node_;
   };
 
   const std::shared_ptr<WorkStealingThreadPoolImpl> pool_;
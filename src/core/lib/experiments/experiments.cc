@@ -36,6 +36,12 @@ const char* const description_canary_client_privacy =
 const char* const additional_constraints_canary_client_privacy = "{}";
 const char* const description_client_privacy = "If set, client privacy";
 const char* const additional_constraints_client_privacy = "{}";
+const char* const description_coarse_deadline_timers =
+    "Arm call deadline and chttp2 keepalive timers through a "
+    "millisecond-bucketed CoarseTimerQueue shared per EventEngine, so that "
+    "cancelling one is a flag flip instead of an EventEngine timer "
+    "cancellation.";
+const char* const additional_constraints_coarse_deadline_timers = "{}";
 const char* const description_event_engine_client =
     "Use EventEngine clients instead of iomgr's grpc_tcp_client";
 const char* const additional_constraints_event_engine_client = "{}";
@@ -45,6 +51,10 @@ const char* const additional_constraints_event_engine_dns = "{}";
 const char* const description_event_engine_listener =
     "Use EventEngine listeners instead of iomgr's grpc_tcp_server";
 const char* const additional_constraints_event_engine_listener = "{}";
+const char* const description_event_engine_timer_wheel =
+    "Use a hierarchical timing wheel instead of sharded heaps for the posix "
+    "EventEngine timers, making timer insertion and cancellation O(1).";
+const char* const additional_constraints_event_engine_timer_wheel = "{}";
 const char* const description_free_large_allocator =
     "If set, return all free bytes from a \042big\042 allocator";
 const char* const additional_constraints_free_large_allocator = "{}";
@@ -65,6 +75,10 @@ const char* const additional_constraints_monitoring_experiment = "{}";
 const char* const description_multiping =
     "Allow more than one ping to be in flight at a time by default.";
 const char* const additional_constraints_multiping = "{}";
+const char* const description_numa_aware_thread_pool =
+    "Group EventEngine thread pool workers by NUMA node, bind them to the cpus "
+    "of their node, and have idle workers steal from their own node first.";
+const char* const additional_constraints_numa_aware_thread_pool = "{}";
 const char* const description_peer_state_based_framing =
     "If set, the max sizes of frames sent to lower layers is controlled based "
     "on the peer's memory pressure which is reflected in its max http2 frame "
@@ -124,6 +138,16 @@ const char* const additional_constraints_tcp_frame_size_tuning = "{}";
 const char* const description_tcp_rcv_lowat =
     "Use SO_RCVLOWAT to avoid wakeups on the read path.";
 const char* const additional_constraints_tcp_rcv_lowat = "{}";
+const char* const description_tls_kernel_offload =
+    "After a TLS handshake, install the negotiated record keys into the kernel "
+    "(kTLS) where the cipher and protocol version allow it, so the secure "
+    "endpoint passes plaintext straight through for the offloaded directions.";
+const char* const additional_constraints_tls_kernel_offload = "{}";
+const char* const description_tls_zero_copy_frame_protector =
+    "Protect and unprotect TLS records directly over slice buffers with a "
+    "zero-copy frame protector, instead of copying through the secure endpoint "
+    "staging buffers.";
+const char* const additional_constraints_tls_zero_copy_frame_protector = "{}";
 const char* const description_trace_record_callops =
     "Enables tracing of call batch initiation and completion.";
 const char* const additional_constraints_trace_record_callops = "{}";
@@ -142,6 +166,11 @@ const char* const description_work_serializer_dispatch =
 const char* const additional_constraints_work_serializer_dispatch = "{}";
 const uint8_t required_experiments_work_serializer_dispatch[] = {
     static_cast<uint8_t>(grpc_core::kExperimentIdEventEngineClient)};
+const char* const description_work_serializer_run_budget =
+    "Have the thread that drains a work serializer hand the rest of the queue "
+    "to event engine once it has run its budget of callbacks, instead of "
+    "draining the whole queue inline.";
+const char* const additional_constraints_work_serializer_run_budget = "{}";
 }  // namespace
 
 namespace grpc_core {
@@ -157,12 +186,16 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_canary_client_privacy, nullptr, 0, false, false},
     {"client_privacy", description_client_privacy,
      additional_constraints_client_privacy, nullptr, 0, false, false},
+    {"coarse_deadline_timers", description_coarse_deadline_timers,
+     additional_constraints_coarse_deadline_timers, nullptr, 0, false, true},
     {"event_engine_client", description_event_engine_client,
      additional_constraints_event_engine_client, nullptr, 0, false, true},
     {"event_engine_dns", description_event_engine_dns,
      additional_constraints_event_engine_dns, nullptr, 0, false, false},
     {"event_engine_listener", description_event_engine_listener,
      additional_constraints_event_engine_listener, nullptr, 0, false, true},
+    {"event_engine_timer_wheel", description_event_engine_timer_wheel,
+     additional_constraints_event_engine_timer_wheel, nullptr, 0, false, true},
     {"free_large_allocator", description_free_large_allocator,
      additional_constraints_free_large_allocator, nullptr, 0, false, true},
     {"http2_stats_fix", description_http2_stats_fix,
@@ -175,6 +208,8 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_monitoring_experiment, nullptr, 0, true, true},
     {"multiping", description_multiping, additional_constraints_multiping,
      nullptr, 0, false, true},
+    {"numa_aware_thread_pool", description_numa_aware_thread_pool,
+     additional_constraints_numa_aware_thread_pool, nullptr, 0, false, true},
     {"peer_state_based_framing", description_peer_state_based_framing,
      additional_constraints_peer_state_based_framing, nullptr, 0, false, true},
     {"pending_queue_cap", description_pending_queue_cap,
@@ -205,6 +240,11 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_tcp_frame_size_tuning, nullptr, 0, false, true},
     {"tcp_rcv_lowat", description_tcp_rcv_lowat,
      additional_constraints_tcp_rcv_lowat, nullptr, 0, false, true},
+    {"tls_kernel_offload", description_tls_kernel_offload,
+     additional_constraints_tls_kernel_offload, nullptr, 0, false, true},
+    {"tls_zero_copy_frame_protector", description_tls_zero_copy_frame_protector,
+     additional_constraints_tls_zero_copy_frame_protector, nullptr, 0, false,
+     true},
     {"trace_record_callops", description_trace_record_callops,
      additional_constraints_trace_record_callops, nullptr, 0, true, true},
     {"unconstrained_max_quota_buffer_size",
@@ -218,6 +258,9 @@ const ExperimentMetadata g_experiment_metadata[] = {
     {"work_serializer_dispatch", description_work_serializer_dispatch,
      additional_constraints_work_serializer_dispatch,
      required_experiments_work_serializer_dispatch, 1, false, true},
+    {"work_serializer_run_budget", description_work_serializer_run_budget,
+     additional_constraints_work_serializer_run_budget, nullptr, 0, false,
+     true},
 };
 
 }  // namespace grpc_core
@@ -236,6 +279,12 @@ const char* const description_canary_client_privacy =
 const char* const additional_constraints_canary_client_privacy = "{}";
 const char* const description_client_privacy = "If set, client privacy";
 const char* const additional_constraints_client_privacy = "{}";
+const char* const description_coarse_deadline_timers =
+    "Arm call deadline and chttp2 keepalive timers through a "
+    "millisecond-bucketed CoarseTimerQueue shared per EventEngine, so that "
+    "cancelling one is a flag flip instead of an EventEngine timer "
+    "cancellation.";
+const char* const additional_constraints_coarse_deadline_timers = "{}";
 const char* const description_event_engine_client =
     "Use EventEngine clients instead of iomgr's grpc_tcp_client";
 const char* const additional_constraints_event_engine_client = "{}";
@@ -245,6 +294,10 @@ const char* const additional_constraints_event_engine_dns = "{}";
 const char* const description_event_engine_listener =
     "Use EventEngine listeners instead of iomgr's grpc_tcp_server";
 const char* const additional_constraints_event_engine_listener = "{}";
+const char* const description_event_engine_timer_wheel =
+    "Use a hierarchical timing wheel instead of sharded heaps for the posix "
+    "EventEngine timers, making timer insertion and cancellation O(1).";
+const char* const additional_constraints_event_engine_timer_wheel = "{}";
 const char* const description_free_large_allocator =
     "If set, return all free bytes from a \042big\042 allocator";
 const char* const additional_constraints_free_large_allocator = "{}";
@@ -265,6 +318,10 @@ const char* const additional_constraints_monitoring_experiment = "{}";
 const char* const description_multiping =
     "Allow more than one ping to be in flight at a time by default.";
 const char* const additional_constraints_multiping = "{}";
+const char* const description_numa_aware_thread_pool =
+    "Group EventEngine thread pool workers by NUMA node, bind them to the cpus "
+    "of their node, and have idle workers steal from their own node first.";
+const char* const additional_constraints_numa_aware_thread_pool = "{}";
 const char* const description_peer_state_based_framing =
     "If set, the max sizes of frames sent to lower layers is controlled based "
     "on the peer's memory pressure which is reflected in its max http2 frame "
@@ -324,6 +381,16 @@ const char* const additional_constraints_tcp_frame_size_tuning = "{}";
 const char* const description_tcp_rcv_lowat =
     "Use SO_RCVLOWAT to avoid wakeups on the read path.";
 const char* const additional_constraints_tcp_rcv_lowat = "{}";
+const char* const description_tls_kernel_offload =
+    "After a TLS handshake, install the negotiated record keys into the kernel "
+    "(kTLS) where the cipher and protocol version allow it, so the secure "
+    "endpoint passes plaintext straight through for the offloaded directions.";
+const char* const additional_constraints_tls_kernel_offload = "{}";
+const char* const description_tls_zero_copy_frame_protector =
+    "Protect and unprotect TLS records directly over slice buffers with a "
+    "zero-copy frame protector, instead of copying through the secure endpoint "
+    "staging buffers.";
+const char* const additional_constraints_tls_zero_copy_frame_protector = "{}";
 const char* const description_trace_record_callops =
     "Enables tracing of call batch initiation and completion.";
 const char* const additional_constraints_trace_record_callops = "{}";
@@ -342,6 +409,11 @@ const char* const description_work_serializer_dispatch =
 const char* const additional_constraints_work_serializer_dispatch = "{}";
 const uint8_t required_experiments_work_serializer_dispatch[] = {
     static_cast<uint8_t>(grpc_core::kExperimentIdEventEngineClient)};
+const char* const description_work_serializer_run_budget =
+    "Have the thread that drains a work serializer hand the rest of the queue "
+    "to event engine once it has run its budget of callbacks, instead of "
+    "draining the whole queue inline.";
+const char* const additional_constraints_work_serializer_run_budget = "{}";
 }  // namespace
 
 namespace grpc_core {
@@ -357,12 +429,16 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_canary_client_privacy, nullptr, 0, false, false},
     {"client_privacy", description_client_privacy,
      additional_constraints_client_privacy, nullptr, 0, false, false},
+    {"coarse_deadline_timers", description_coarse_deadline_timers,
+     additional_constraints_coarse_deadline_timers, nullptr, 0, false, true},
     {"event_engine_client", description_event_engine_client,
      additional_constraints_event_engine_client, nullptr, 0, false, true},
     {"event_engine_dns", description_event_engine_dns,
      additional_constraints_event_engine_dns, nullptr, 0, false, false},
     {"event_engine_listener", description_event_engine_listener,
      additional_constraints_event_engine_listener, nullptr, 0, true, true},
+    {"event_engine_timer_wheel", description_event_engine_timer_wheel,
+     additional_constraints_event_engine_timer_wheel, nullptr, 0, false, true},
     {"free_large_allocator", description_free_large_allocator,
      additional_constraints_free_large_allocator, nullptr, 0, false, true},
     {"http2_stats_fix", description_http2_stats_fix,
@@ -375,6 +451,8 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_monitoring_experiment, nullptr, 0, true, true},
     {"multiping", description_multiping, additional_constraints_multiping,
      nullptr, 0, false, true},
+    {"numa_aware_thread_pool", description_numa_aware_thread_pool,
+     additional_constraints_numa_aware_thread_pool, nullptr, 0, false, true},
     {"peer_state_based_framing", description_peer_state_based_framing,
      additional_constraints_peer_state_based_framing, nullptr, 0, false, true},
     {"pending_queue_cap", description_pending_queue_cap,
@@ -405,6 +483,11 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_tcp_frame_size_tuning, nullptr, 0, false, true},
     {"tcp_rcv_lowat", description_tcp_rcv_lowat,
      additional_constraints_tcp_rcv_lowat, nullptr, 0, false, true},
+    {"tls_kernel_offload", description_tls_kernel_offload,
+     additional_constraints_tls_kernel_offload, nullptr, 0, false, true},
+    {"tls_zero_copy_frame_protector", description_tls_zero_copy_frame_protector,
+     additional_constraints_tls_zero_copy_frame_protector, nullptr, 0, false,
+     true},
     {"trace_record_callops", description_trace_record_callops,
      additional_constraints_trace_record_callops, nullptr, 0, true, true},
     {"unconstrained_max_quota_buffer_size",
@@ -418,6 +501,9 @@ const ExperimentMetadata g_experiment_metadata[] = {
     {"work_serializer_dispatch", description_work_serializer_dispatch,
      additional_constraints_work_serializer_dispatch,
      required_experiments_work_serializer_dispatch, 1, false, true},
+    {"work_serializer_run_budget", description_work_serializer_run_budget,
+     additional_constraints_work_serializer_run_budget, nullptr, 0, false,
+     true},
 };
 
 }  // namespace grpc_core
@@ -436,6 +522,12 @@ const char* const description_canary_client_privacy =
 const char* const additional_constraints_canary_client_privacy = "{}";
 const char* const description_client_privacy = "If set, client privacy";
 const char* const additional_constraints_client_privacy = "{}";
+const char* const description_coarse_deadline_timers =
+    "Arm call deadline and chttp2 keepalive timers through a "
+    "millisecond-bucketed CoarseTimerQueue shared per EventEngine, so that "
+    "cancelling one is a flag flip instead of an EventEngine timer "
+    "cancellation.";
+const char* const additional_constraints_coarse_deadline_timers = "{}";
 const char* const description_event_engine_client =
     "Use EventEngine clients instead of iomgr's grpc_tcp_client";
 const char* const additional_constraints_event_engine_client = "{}";
@@ -445,6 +537,10 @@ const char* const additional_constraints_event_engine_dns = "{}";
 const char* const description_event_engine_listener =
     "Use EventEngine listeners instead of iomgr's grpc_tcp_server";
 const char* const additional_constraints_event_engine_listener = "{}";
+const char* const description_event_engine_timer_wheel =
+    "Use a hierarchical timing wheel instead of sharded heaps for the posix "
+    "EventEngine timers, making timer insertion and cancellation O(1).";
+const char* const additional_constraints_event_engine_timer_wheel = "{}";
 const char* const description_free_large_allocator =
     "If set, return all free bytes from a \042big\042 allocator";
 const char* const additional_constraints_free_large_allocator = "{}";
@@ -465,6 +561,10 @@ const char* const additional_constraints_monitoring_experiment = "{}";
 const char* const description_multiping =
     "Allow more than one ping to be in flight at a time by default.";
 const char* const additional_constraints_multiping = "{}";
+const char* const description_numa_aware_thread_pool =
+    "Group EventEngine thread pool workers by NUMA node, bind them to the cpus "
+    "of their node, and have idle workers steal from their own node first.";
+const char* const additional_constraints_numa_aware_thread_pool = "{}";
 const char* const description_peer_state_based_framing =
     "If set, the max sizes of frames sent to lower layers is controlled based "
     "on the peer's memory pressure which is reflected in its max http2 frame "
@@ -524,6 +624,16 @@ const char* const additional_constraints_tcp_frame_size_tuning = "{}";
 const char* const description_tcp_rcv_lowat =
     "Use SO_RCVLOWAT to avoid wakeups on the read path.";
 const char* const additional_constraints_tcp_rcv_lowat = "{}";
+const char* const description_tls_kernel_offload =
+    "After a TLS handshake, install the negotiated record keys into the kernel "
+    "(kTLS) where the cipher and protocol version allow it, so the secure "
+    "endpoint passes plaintext straight through for the offloaded directions.";
+const char* const additional_constraints_tls_kernel_offload = "{}";
+const char* const description_tls_zero_copy_frame_protector =
+    "Protect and unprotect TLS records directly over slice buffers with a "
+    "zero-copy frame protector, instead of copying through the secure endpoint "
+    "staging buffers.";
+const char* const additional_constraints_tls_zero_copy_frame_protector = "{}";
 const char* const description_trace_record_callops =
     "Enables tracing of call batch initiation and completion.";
 const char* const additional_constraints_trace_record_callops = "{}";
@@ -542,6 +652,11 @@ const char* const description_work_serializer_dispatch =
 const char* const additional_constraints_work_serializer_dispatch = "{}";
 const uint8_t required_experiments_work_serializer_dispatch[] = {
     static_cast<uint8_t>(grpc_core::kExperimentIdEventEngineClient)};
+const char* const description_work_serializer_run_budget =
+    "Have the thread that drains a work serializer hand the rest of the queue "
+    "to event engine once it has run its budget of callbacks, instead of "
+    "draining the whole queue inline.";
+const char* const additional_constraints_work_serializer_run_budget = "{}";
 }  // namespace
 
 namespace grpc_core {
@@ -557,12 +672,16 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_canary_client_privacy, nullptr, 0, false, false},
     {"client_privacy", description_client_privacy,
      additional_constraints_client_privacy, nullptr, 0, false, false},
+    {"coarse_deadline_timers", description_coarse_deadline_timers,
+     additional_constraints_coarse_deadline_timers, nullptr, 0, false, true},
     {"event_engine_client", description_event_engine_client,
      additional_constraints_event_engine_client, nullptr, 0, false, true},
     {"event_engine_dns", description_event_engine_dns,
      additional_constraints_event_engine_dns, nullptr, 0, true, false},
     {"event_engine_listener", description_event_engine_listener,
      additional_constraints_event_engine_listener, nullptr, 0, true, true},
+    {"event_engine_timer_wheel", description_event_engine_timer_wheel,
+     additional_constraints_event_engine_timer_wheel, nullptr, 0, false, true},
     {"free_large_allocator", description_free_large_allocator,
      additional_constraints_free_large_allocator, nullptr, 0, false, true},
     {"http2_stats_fix", description_http2_stats_fix,
@@ -575,6 +694,8 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_monitoring_experiment, nullptr, 0, true, true},
     {"multiping", description_multiping, additional_constraints_multiping,
      nullptr, 0, false, true},
+    {"numa_aware_thread_pool", description_numa_aware_thread_pool,
+     additional_constraints_numa_aware_thread_pool, nullptr, 0, false, true},
     {"peer_state_based_framing", description_peer_state_based_framing,
      additional_constraints_peer_state_based_framing, nullptr, 0, false, true},
     {"pending_queue_cap", description_pending_queue_cap,
@@ -605,6 +726,11 @@ const ExperimentMetadata g_experiment_metadata[] = {
      additional_constraints_tcp_frame_size_tuning, nullptr, 0, false, true},
     {"tcp_rcv_lowat", description_tcp_rcv_lowat,
      additional_constraints_tcp_rcv_lowat, nullptr, 0, false, true},
+    {"tls_kernel_offload", description_tls_kernel_offload,
+     additional_constraints_tls_kernel_offload, nullptr, 0, false, true},
+    {"tls_zero_copy_frame_protector", description_tls_zero_copy_frame_protector,
+     additional_constraints_tls_zero_copy_frame_protector, nullptr, 0, false,
+     true},
     {"trace_record_callops", description_trace_record_callops,
      additional_constraints_trace_record_callops, nullptr, 0, true, true},
     {"unconstrained_max_quota_buffer_size",
@@ -618,6 +744,9 @@ const ExperimentMetadata g_experiment_metadata[] = {
     {"work_serializer_dispatch", description_work_serializer_dispatch,
      additional_constraints_work_serializer_dispatch,
      required_experiments_work_serializer_dispatch, 1, true, true},
+    {"work_serializer_run_budget", description_work_serializer_run_budget,
+     additional_constraints_work_serializer_run_budget, nullptr, 0, false,
+     true},
 };
 
 }  // namespace grpc_core
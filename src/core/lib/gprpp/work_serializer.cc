@@ -16,6 +16,7 @@
 
 #include "src/core/lib/gprpp/work_serializer.h"
 
+#include <inttypes.h>
 #include <stdint.h>
 
 #include <algorithm>
@@ -47,6 +48,24 @@ namespace grpc_core {
 
 DebugOnlyTraceFlag grpc_work_serializer_trace(false, "work_serializer");
 
+namespace {
+
+// The budget of a thread running the callbacks of a work serializer: once it
+// has run this many callbacks, or has been running them for this long, it
+// leaves the rest of the queue to another EventEngine thread, so that a burst
+// of work (e.g. LB policy updates) does not hold on to a poller or to a pool
+// thread.
+constexpr size_t kMaxItemsPerSlice = 64;
+constexpr std::chrono::microseconds kMaxTimePerSlice(1000);
+
+bool SliceBudgetExhausted(std::chrono::steady_clock::time_point slice_start,
+                          size_t items_run) {
+  return items_run >= kMaxItemsPerSlice ||
+         std::chrono::steady_clock::now() - slice_start >= kMaxTimePerSlice;
+}
+
+}  // namespace
+
 //
 // WorkSerializer::WorkSerializerImpl
 //
@@ -70,6 +89,10 @@ class WorkSerializer::WorkSerializerImpl : public Orphanable {
 
 class WorkSerializer::LegacyWorkSerializer final : public WorkSerializerImpl {
  public:
+  explicit LegacyWorkSerializer(
+      std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+          event_engine)
+      : event_engine_(std::move(event_engine)) {}
   void Run(std::function<void()> callback,
            const DebugLocation& location) override;
   void Schedule(std::function<void()> callback,
@@ -103,6 +126,10 @@ class WorkSerializer::LegacyWorkSerializer final : public WorkSerializerImpl {
   // that the queue size is also incremented as part of the fetch_add to allow
   // the callers to add a callback to the queue if another thread already holds
   // the lock to the work serializer.
+  //
+  // If experiment `work_serializer_run_budget` is enabled, the draining thread
+  // stops once it spent its budget, and an EventEngine thread drains the rest
+  // of the queue without giving up ownership in between.
   void DrainQueueOwned();
 
   // First 16 bits indicate ownership of the WorkSerializer, next 48 bits are
@@ -130,6 +157,10 @@ class WorkSerializer::LegacyWorkSerializer final : public WorkSerializerImpl {
   // orphaned.
   std::atomic<uint64_t> refs_{MakeRefPair(0, 1)};
   MultiProducerSingleConsumerQueue queue_;
+  // EventEngine instance that the queue is handed to when the draining thread
+  // runs out of budget.
+  const std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+      event_engine_;
 #ifndef NDEBUG
   std::thread::id current_thread_;
 #endif
@@ -226,6 +257,8 @@ void WorkSerializer::LegacyWorkSerializer::DrainQueueOwned() {
   if (GRPC_TRACE_FLAG_ENABLED(grpc_work_serializer_trace)) {
     gpr_log(GPR_INFO, "WorkSerializer::DrainQueueOwned() %p", this);
   }
+  const auto slice_start = std::chrono::steady_clock::now();
+  size_t items_run = 0;
   while (true) {
     auto prev_ref_pair = refs_.fetch_sub(MakeRefPair(0, 1));
     // It is possible that while draining the queue, the last callback ended
@@ -260,6 +293,26 @@ void WorkSerializer::LegacyWorkSerializer::DrainQueueOwned() {
       // Didn't wind up giving up ownership, so set current_thread_ again.
       SetCurrentThread();
     }
+    if (IsWorkSerializerRunBudgetEnabled() &&
+        SliceBudgetExhausted(slice_start, items_run)) {
+      // There is more work, but this thread has run for long enough. Restore
+      // the queue size expected by DrainQueueOwned() and hand the queue over
+      // to EventEngine while still owning the work serializer, so that the
+      // callbacks keep running in order.
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_work_serializer_trace)) {
+        gpr_log(GPR_INFO, "  Ran %" PRIuPTR " items, handing off the queue",
+                items_run);
+      }
+      refs_.fetch_add(MakeRefPair(0, 1), std::memory_order_acq_rel);
+      ClearCurrentThread();
+      event_engine_->Run([this]() {
+        ApplicationCallbackExecCtx app_exec_ctx;
+        ExecCtx exec_ctx;
+        SetCurrentThread();
+        DrainQueueOwned();
+      });
+      return;
+    }
     // There is at least one callback on the queue. Pop the callback from the
     // queue and execute it.
     if (IsWorkSerializerClearsTimeCacheEnabled() && ExecCtx::Get() != nullptr) {
@@ -282,6 +335,7 @@ void WorkSerializer::LegacyWorkSerializer::DrainQueueOwned() {
     }
     cb_wrapper->callback();
     delete cb_wrapper;
+    ++items_run;
   }
 }
 
@@ -289,9 +343,12 @@ void WorkSerializer::LegacyWorkSerializer::DrainQueueOwned() {
 // WorkSerializer::DispatchingWorkSerializer
 //
 
-// DispatchingWorkSerializer: executes callbacks one at a time on EventEngine.
-// One at a time guarantees that fixed size thread pools in EventEngine
-// implementations are not starved of threads by long running work serializers.
+// DispatchingWorkSerializer: executes callbacks on EventEngine, a batch at a
+// time. Each dispatch runs callbacks until the queue is empty or the slice
+// budget is spent, then dispatches again: batching saves an EventEngine hop
+// per callback, and the budget guarantees that fixed size thread pools in
+// EventEngine implementations are not starved of threads by long running work
+// serializers.
 // We implement EventEngine::Closure directly to avoid allocating once per
 // callback in the queue when scheduling.
 class WorkSerializer::DispatchingWorkSerializer final
@@ -440,32 +497,44 @@ void WorkSerializer::DispatchingWorkSerializer::Run() {
   // TODO(ctiller): remove these when we can deprecate ExecCtx
   ApplicationCallbackExecCtx app_exec_ctx;
   ExecCtx exec_ctx;
-  // Grab the last element of processing_ - which is the next item in our queue
-  // since processing_ is stored in reverse order.
-  auto& cb = processing_.back();
-  if (GRPC_TRACE_FLAG_ENABLED(grpc_work_serializer_trace)) {
-    gpr_log(GPR_INFO, "WorkSerializer[%p] Executing callback [%s:%d]", this,
-            cb.location.file(), cb.location.line());
-  }
-  // Run the work item.
-  const auto start = std::chrono::steady_clock::now();
-  SetCurrentThread();
-  cb.callback();
-  // pop_back here destroys the callback - freeing any resources it might hold.
-  // We do so before clearing the current thread in case the callback destructor
-  // wants to check that it's in the WorkSerializer too.
-  processing_.pop_back();
-  ClearCurrentThread();
-  global_stats().IncrementWorkSerializerItemsDequeued();
-  const auto work_time = std::chrono::steady_clock::now() - start;
-  global_stats().IncrementWorkSerializerWorkTimePerItemMs(
-      std::chrono::duration_cast<std::chrono::milliseconds>(work_time).count());
-  time_running_items_ += work_time;
-  ++items_processed_during_run_;
-  // Check if we've drained the queue and if so refill it.
-  if (processing_.empty() && !Refill()) return;
-  // There's still work in processing_, so schedule ourselves again on
-  // EventEngine.
+  const auto slice_start = std::chrono::steady_clock::now();
+  size_t items_run = 0;
+  do {
+    // Grab the last element of processing_ - which is the next item in our
+    // queue since processing_ is stored in reverse order.
+    auto& cb = processing_.back();
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_work_serializer_trace)) {
+      gpr_log(GPR_INFO, "WorkSerializer[%p] Executing callback [%s:%d]", this,
+              cb.location.file(), cb.location.line());
+    }
+    if (items_run > 0 && IsWorkSerializerClearsTimeCacheEnabled()) {
+      exec_ctx.InvalidateNow();
+    }
+    // Run the work item.
+    const auto start = std::chrono::steady_clock::now();
+    SetCurrentThread();
+    cb.callback();
+    // pop_back here destroys the callback - freeing any resources it might
+    // hold. We do so before clearing the current thread in case the callback
+    // destructor wants to check that it's in the WorkSerializer too.
+    processing_.pop_back();
+    ClearCurrentThread();
+    // Run the closures that the callback scheduled before the next callback,
+    // as if each callback had its own ExecCtx.
+    exec_ctx.Flush();
+    global_stats().IncrementWorkSerializerItemsDequeued();
+    const auto work_time = std::chrono::steady_clock::now() - start;
+    global_stats().IncrementWorkSerializerWorkTimePerItemMs(
+        std::chrono::duration_cast<std::chrono::milliseconds>(work_time)
+            .count());
+    time_running_items_ += work_time;
+    ++items_processed_during_run_;
+    ++items_run;
+    // Check if we've drained the queue and if so refill it.
+    if (processing_.empty() && !Refill()) return;
+  } while (!SliceBudgetExhausted(slice_start, items_run));
+  // There's still work in processing_, but this slice is over: schedule
+  // ourselves again on EventEngine.
   event_engine_->Run(this);
 }
 
@@ -533,7 +602,8 @@ WorkSerializer::WorkSerializer(
                       MakeOrphanable<DispatchingWorkSerializer>(
                           std::move(event_engine)))
                 : OrphanablePtr<WorkSerializerImpl>(
-                      MakeOrphanable<LegacyWorkSerializer>())) {}
+                      MakeOrphanable<LegacyWorkSerializer>(
+                          std::move(event_engine)))) {}
 
 WorkSerializer::~WorkSerializer() = default;
 
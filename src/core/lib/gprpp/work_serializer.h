@@ -59,14 +59,18 @@ class ABSL_LOCKABLE WorkSerializer {
   // Runs a given callback on the work serializer.
   //
   // If experiment `work_serializer_dispatch` is enabled:
-  // The callback will be executed as an EventEngine callback, that then
-  // arranges for the next callback in the queue to execute.
+  // The callback will be executed as an EventEngine callback, that then runs
+  // the next callbacks in the queue until its time slice is spent, and
+  // arranges for the remaining ones to execute in another EventEngine
+  // callback.
   //
   // If experiment `work_serializer_dispatch` is NOT enabled:
   // If there is no other thread currently executing the WorkSerializer, the
   // callback is run immediately. In this case, the current thread is also
   // borrowed for draining the queue for any callbacks that get added in the
-  // meantime.
+  // meantime. If experiment `work_serializer_run_budget` is enabled, the
+  // current thread only drains the queue for one time slice, and then leaves
+  // the remaining callbacks to an EventEngine thread.
   // This behavior is deprecated and will be removed soon.
   //
   // If you want to use clang thread annotation to make sure that callback is
@@ -50,6 +50,7 @@
 
 #include "src/core/lib/debug/stats.h"
 #include "src/core/lib/debug/stats_data.h"
+#include "src/core/lib/event_engine/posix_engine/busy_poll.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/manual_constructor.h"
@@ -720,10 +721,8 @@ static grpc_error_handle do_epoll_wait(grpc_pollset* ps,
   if (timeout != 0) {
     GRPC_SCHEDULING_START_BLOCKING_REGION;
   }
-  do {
-    r = epoll_wait(g_epoll_set.epfd, g_epoll_set.events, MAX_EPOLL_EVENTS,
-                   timeout);
-  } while (r < 0 && errno == EINTR);
+  r = grpc_event_engine::experimental::EpollWaitMaybeBusyPoll(
+      g_epoll_set.epfd, g_epoll_set.events, MAX_EPOLL_EVENTS, timeout);
   if (timeout != 0) {
     GRPC_SCHEDULING_END_BLOCKING_REGION;
   }
@@ -280,6 +280,32 @@ grpc_error_handle grpc_set_socket_dscp(int fd, int dscp) {
   return absl::OkStatus();
 }
 
+// Set SO_BUSY_POLL (and SO_PREFER_BUSY_POLL where available)
+grpc_error_handle grpc_set_socket_busy_poll(int fd, int busy_poll_usec) {
+  if (busy_poll_usec <= 0) {
+    return absl::OkStatus();
+  }
+#ifdef SO_BUSY_POLL
+  if (0 != setsockopt(fd, SOL_SOCKET, SO_BUSY_POLL, &busy_poll_usec,
+                      sizeof(busy_poll_usec))) {
+    return GRPC_OS_ERROR(errno, "setsockopt(SO_BUSY_POLL)");
+  }
+#ifdef SO_PREFER_BUSY_POLL
+  // Kernels older than 5.11 reject this; busy polling still works there.
+  int prefer = 1;
+  if (0 != setsockopt(fd, SOL_SOCKET, SO_PREFER_BUSY_POLL, &prefer,
+                      sizeof(prefer))) {
+    gpr_log(GPR_DEBUG, "setsockopt(SO_PREFER_BUSY_POLL) %s",
+            grpc_core::StrError(errno).c_str());
+  }
+#endif
+  return absl::OkStatus();
+#else
+  (void)fd;
+  return GRPC_ERROR_CREATE("SO_BUSY_POLL unavailable on compiling system");
+#endif
+}
+
 // The default values for TCP_USER_TIMEOUT are currently configured to be in
 // line with the default values of KEEPALIVE_TIMEOUT as proposed in
 // https://github.com/grpc/proposal/blob/master/A18-tcp-user-timeout.md
@@ -95,6 +95,8 @@ PosixTcpOptions TcpOptionsFromEndpointConfig(const EndpointConfig& config) {
        0);
   options.dscp = AdjustValue(PosixTcpOptions::kDscpNotSet, 0, 63,
                              config.GetInt(GRPC_ARG_DSCP));
+  options.busy_poll_usec =
+      AdjustValue(0, 0, INT_MAX, config.GetInt(GRPC_ARG_TCP_BUSY_POLL_USEC));
 
   if (options.tcp_min_read_chunk_size > options.tcp_max_read_chunk_size) {
     options.tcp_min_read_chunk_size = options.tcp_max_read_chunk_size;
@@ -61,6 +61,7 @@ struct PosixTcpOptions {
   int keep_alive_time_ms = 0;
   int keep_alive_timeout_ms = 0;
   int dscp = kDscpNotSet;
+  int busy_poll_usec = 0;
   bool expand_wildcard_addrs = false;
   bool allow_reuse_port = false;
   RefCountedPtr<ResourceQuota> resource_quota;
@@ -128,6 +129,7 @@ struct PosixTcpOptions {
     expand_wildcard_addrs = other.expand_wildcard_addrs;
     allow_reuse_port = other.allow_reuse_port;
     dscp = other.dscp;
+    busy_poll_usec = other.busy_poll_usec;
   }
 };
 
@@ -164,6 +166,10 @@ grpc_error_handle grpc_set_socket_reuse_port(int fd, int reuse);
 /* Set Differentiated Services Code Point (DSCP) */
 grpc_error_handle grpc_set_socket_dscp(int fd, int dscp);
 
+// Set SO_BUSY_POLL (and SO_PREFER_BUSY_POLL where available) if busy_poll_usec
+// is positive
+grpc_error_handle grpc_set_socket_busy_poll(int fd, int busy_poll_usec);
+
 // Configure the default values for TCP_USER_TIMEOUT
 void config_default_tcp_user_timeout(bool enable, int timeout, bool is_client);
 
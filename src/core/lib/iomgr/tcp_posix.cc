@@ -87,6 +87,14 @@
 #define TCP_CM_INQ TCP_INQ
 #endif
 
+// Kernel TLS control message carrying the content type of a received record.
+#ifndef SOL_TLS
+#define SOL_TLS 282
+#endif
+#ifndef TLS_GET_RECORD_TYPE
+#define TLS_GET_RECORD_TYPE 2
+#endif
+
 #ifdef GRPC_HAVE_MSG_NOSIGNAL
 #define SENDMSG_FLAGS MSG_NOSIGNAL
 #else
@@ -926,6 +934,48 @@ static void update_rcvlowat(grpc_tcp* tcp)
   tcp->set_rcvlowat = remaining;
 }
 
+// With kernel TLS receive offload (see src/core/tsi/ssl/ktls), records other
+// than application data are returned by recvmsg() one at a time, with their
+// content type in a control message (or the read fails with EIO if there is
+// no room for it). The SSL library no longer sees the record layer, so such
+// records (alerts, post-handshake messages like KeyUpdate) end the
+// connection. Returns the error for the record read into msg, if it is one.
+static absl::Status tcp_check_tls_record(msghdr* msg, ssize_t read_bytes) {
+  for (cmsghdr* cmsg = CMSG_FIRSTHDR(msg); cmsg != nullptr;
+       cmsg = CMSG_NXTHDR(msg, cmsg)) {
+    if (cmsg->cmsg_level != SOL_TLS || cmsg->cmsg_type != TLS_GET_RECORD_TYPE ||
+        cmsg->cmsg_len < CMSG_LEN(sizeof(uint8_t))) {
+      continue;
+    }
+    const uint8_t type = *CMSG_DATA(cmsg);
+    const uint8_t* data = static_cast<const uint8_t*>(msg->msg_iov[0].iov_base);
+    const size_t length =
+        std::min(static_cast<size_t>(read_bytes), msg->msg_iov[0].iov_len);
+    switch (type) {
+      case 23:  // application_data
+        return absl::OkStatus();
+      case 21:  // alert
+        if (length >= 2) {
+          return absl::UnavailableError(absl::StrCat(
+              "TLS alert from peer: level ", data[0], ", description ",
+              data[1], data[1] == 0 ? " (close_notify)" : ""));
+        }
+        break;
+      case 22:  // handshake
+        if (length >= 1) {
+          return absl::UnavailableError(absl::StrCat(
+              "Unsupported TLS handshake message of type ", data[0],
+              data[0] == 24 ? " (KeyUpdate)" : "",
+              " from peer after the record layer moved to the kernel"));
+        }
+        break;
+    }
+    return absl::UnavailableError(
+        absl::StrCat("Unexpected TLS record of content type ", type));
+  }
+  return absl::OkStatus();
+}
+
 // Returns true if data available to read or error other than EAGAIN.
 #define MAX_READ_IOVEC 64
 static bool tcp_do_read(grpc_tcp* tcp, grpc_error_handle* error)
@@ -964,13 +1014,10 @@ static bool tcp_do_read(grpc_tcp* tcp, grpc_error_handle* error)
     msg.msg_namelen = 0;
     msg.msg_iov = iov;
     msg.msg_iovlen = static_cast<msg_iovlen_type>(iov_len);
-    if (tcp->inq_capable) {
-      msg.msg_control = cmsgbuf;
-      msg.msg_controllen = sizeof(cmsgbuf);
-    } else {
-      msg.msg_control = nullptr;
-      msg.msg_controllen = 0;
-    }
+    // Always leave room for control messages, so that kernel TLS can report
+    // the type of records other than application data.
+    msg.msg_control = cmsgbuf;
+    msg.msg_controllen = sizeof(cmsgbuf);
     msg.msg_flags = 0;
 
     grpc_core::global_stats().IncrementTcpReadOffer(
@@ -1018,6 +1065,13 @@ static bool tcp_do_read(grpc_tcp* tcp, grpc_error_handle* error)
       return true;
     }
 
+    grpc_error_handle tls_error = tcp_check_tls_record(&msg, read_bytes);
+    if (!tls_error.ok()) {
+      grpc_slice_buffer_reset_and_unref(tcp->incoming_buffer);
+      *error = tcp_annotate_error(tls_error, tcp);
+      return true;
+    }
+
     grpc_core::global_stats().IncrementTcpReadSize(read_bytes);
     add_to_estimate(tcp, static_cast<size_t>(read_bytes));
     DCHECK((size_t)read_bytes <=
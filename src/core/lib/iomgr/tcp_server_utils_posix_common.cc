@@ -235,6 +235,13 @@ grpc_error_handle grpc_tcp_server_prepare_socket(
     if (!err.ok()) goto error;
     err = grpc_set_socket_dscp(fd, s->options.dscp);
     if (!err.ok()) goto error;
+    err = grpc_set_socket_busy_poll(fd, s->options.busy_poll_usec);
+    if (!err.ok()) {
+      // Raising SO_BUSY_POLL needs CAP_NET_ADMIN. It's not fatal: the server
+      // still works, just without busy polling.
+      gpr_log(GPR_ERROR, "Not busy polling listener sockets: %s",
+              grpc_core::StatusToString(err).c_str());
+    }
     err =
         grpc_set_socket_tcp_user_timeout(fd, s->options, false /* is_client */);
     if (!err.ok()) goto error;
@@ -135,6 +135,11 @@ class HeaderMatcher {
   // Valid for kSafeRegex.
   RE2* regex_matcher() const { return matcher_.regex_matcher(); }
 
+  // Valid for kExact, kPrefix, kSuffix and kContains.
+  bool case_sensitive() const { return matcher_.case_sensitive(); }
+
+  bool invert_match() const { return invert_match_; }
+
   bool Match(const absl::optional<absl::string_view>& value) const;
 
   std::string ToString() const;
@@ -164,7 +164,7 @@ std::string Activity::DebugTag() const {
 std::string IntraActivityWaiter::DebugString() const {
   std::vector<int> bits;
   for (size_t i = 0; i < 8 * sizeof(WakeupMask); i++) {
-    if (wakeups_ & (1 << i)) bits.push_back(i);
+    if (wakeups_ & (WakeupMask{1} << i)) bits.push_back(i);
   }
   return absl::StrCat("{", absl::StrJoin(bits, ","), "}");
 }
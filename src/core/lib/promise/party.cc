@@ -69,12 +69,34 @@ bool PartySyncUsingAtomics::UnreffedLast() {
   return (prev_state & kLocked) == 0;
 }
 
+WakeupMask PartySyncUsingAtomics::AllocateOverflowSlots(size_t count,
+                                                        size_t* slots) {
+  WakeupMask allocated = overflow_allocated_.load(std::memory_order_acquire);
+  WakeupMask wakeup_mask;
+  do {
+    wakeup_mask = 0;
+    size_t n = 0;
+    for (size_t bit = party_detail::kInlineParticipants;
+         n < count && bit < party_detail::kMaxParticipants; bit++) {
+      const WakeupMask participant = WakeupMask{1} << bit;
+      if (allocated & participant) continue;
+      wakeup_mask |= participant;
+      slots[n++] = bit;
+    }
+    CHECK(n == count);
+  } while (!overflow_allocated_.compare_exchange_weak(
+      allocated, allocated | wakeup_mask, std::memory_order_acq_rel,
+      std::memory_order_acquire));
+  return wakeup_mask;
+}
+
 bool PartySyncUsingAtomics::ScheduleWakeup(WakeupMask mask) {
   // Or in the wakeup bit for the participant, AND the locked bit.
-  uint64_t prev_state = state_.fetch_or((mask & kWakeupMask) | kLocked,
-                                        std::memory_order_acq_rel);
+  const uint64_t wakeup_bits = PublishWakeups(mask);
+  uint64_t prev_state =
+      state_.fetch_or(wakeup_bits | kLocked, std::memory_order_acq_rel);
   LogStateChange("ScheduleWakeup", prev_state,
-                 prev_state | (mask & kWakeupMask) | kLocked);
+                 prev_state | wakeup_bits | kLocked);
   // If the lock was not held now we hold it, so we need to run.
   return ((prev_state & kLocked) == 0);
 }
@@ -178,18 +200,39 @@ Party::Participant::~Participant() {
   }
 }
 
-Party::~Party() {}
+Party::~Party() {
+  delete overflow_participants_.load(std::memory_order_relaxed);
+}
 
 void Party::CancelRemainingParticipants() {
   ScopedActivity activity(this);
-  for (size_t i = 0; i < party_detail::kMaxParticipants; i++) {
-    if (auto* p =
-            participants_[i].exchange(nullptr, std::memory_order_acquire)) {
+  const size_t num_slots =
+      overflow_participants_.load(std::memory_order_acquire) == nullptr
+          ? party_detail::kInlineParticipants
+          : party_detail::kMaxParticipants;
+  for (size_t i = 0; i < num_slots; i++) {
+    if (auto* p = participant_slot(i).exchange(nullptr,
+                                               std::memory_order_acquire)) {
       p->Destroy();
     }
   }
 }
 
+void Party::EnsureOverflowParticipants() {
+  if (overflow_participants_.load(std::memory_order_acquire) != nullptr) {
+    return;
+  }
+  // Several threads may add participants at once: the first to install its
+  // slots wins.
+  auto* overflow = new OverflowParticipants();
+  OverflowParticipants* expected = nullptr;
+  if (!overflow_participants_.compare_exchange_strong(
+          expected, overflow, std::memory_order_acq_rel,
+          std::memory_order_acquire)) {
+    delete overflow;
+  }
+}
+
 std::string Party::ActivityDebugTag(WakeupMask wakeup_mask) const {
   return absl::StrFormat("%s [parts:%x]", DebugTag(), wakeup_mask);
 }
@@ -197,15 +240,15 @@ std::string Party::ActivityDebugTag(WakeupMask wakeup_mask) const {
 Waker Party::MakeOwningWaker() {
   DCHECK(currently_polling_ != kNotPolling);
   IncrementRefCount();
-  return Waker(this, 1u << currently_polling_);
+  return Waker(this, WakeupMask{1} << currently_polling_);
 }
 
 Waker Party::MakeNonOwningWaker() {
   DCHECK(currently_polling_ != kNotPolling);
-  return Waker(participants_[currently_polling_]
+  return Waker(participant_slot(currently_polling_)
                    .load(std::memory_order_relaxed)
                    ->MakeNonOwningWakeable(this),
-               1u << currently_polling_);
+               WakeupMask{1} << currently_polling_);
 }
 
 void Party::ForceImmediateRepoll(WakeupMask mask) {
@@ -271,7 +314,7 @@ bool Party::RunOneParticipant(int i) {
   // If the participant is null, skip.
   // This allows participants to complete whilst wakers still exist
   // somewhere.
-  auto* participant = participants_[i].load(std::memory_order_acquire);
+  auto* participant = participant_slot(i).load(std::memory_order_acquire);
   if (participant == nullptr) {
     if (grpc_trace_promise_primitives.enabled()) {
       gpr_log(GPR_INFO, "%s[party] wakeup %d already complete",
@@ -294,7 +337,7 @@ bool Party::RunOneParticipant(int i) {
       gpr_log(GPR_INFO, "%s[%s] end poll and finish job %d", DebugTag().c_str(),
               std::string(name).c_str(), i);
     }
-    participants_[i].store(nullptr, std::memory_order_relaxed);
+    participant_slot(i).store(nullptr, std::memory_order_relaxed);
   } else if (!name.empty()) {
     gpr_log(GPR_INFO, "%s[%s] end poll", DebugTag().c_str(),
             std::string(name).c_str());
@@ -311,7 +354,12 @@ void Party::AddParticipants(Participant** participants, size_t count) {
                 "Party %p                 AddParticipant: %s @ %" PRIdPTR,
                 &sync_, std::string(participants[i]->name()).c_str(), slots[i]);
       }
-      participants_[slots[i]].store(participants[i], std::memory_order_release);
+      if (slots[i] >= party_detail::kInlineParticipants) {
+        EnsureOverflowParticipants();
+      }
+      sync_.SetPriority(WakeupMask{1} << slots[i], participants[i]->priority());
+      participant_slot(slots[i]).store(participants[i],
+                                       std::memory_order_release);
     }
   });
   if (run_party) RunLocked();
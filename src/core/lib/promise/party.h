@@ -65,11 +65,82 @@ extern grpc_core::DebugOnlyTraceFlag grpc_trace_party_state;
 
 namespace grpc_core {
 
+// Scheduling class of a party participant. The participants woken up at the
+// same time are polled lane by lane, and in spawn order within a lane.
+enum class PartyPriority : uint8_t {
+  // Cancellation and other work that finishes the call.
+  kUrgent,
+  kNormal,
+  // Message pumping, which may be woken up for every message and should not
+  // delay the other lanes.
+  kBulk,
+};
+
 namespace party_detail {
 
-// Number of bits reserved for wakeups gives us the maximum number of
-// participants.
-static constexpr size_t kMaxParticipants = 16;
+// Number of participants whose wakeups fit in the party's main state word.
+static constexpr size_t kInlineParticipants = 16;
+
+// Number of bits in a WakeupMask gives us the maximum number of participants.
+// The participants beyond the inline ones are tracked by a second pair of
+// state words.
+static constexpr size_t kMaxParticipants = 8 * sizeof(WakeupMask);
+
+// Calls f(i) for each bit i set in mask, from the lowest.
+template <typename F>
+void ForEachParticipant(WakeupMask mask, F f) {
+  for (size_t i = 0; mask != 0; i++, mask >>= 1) {
+    if ((mask & 1) != 0) f(i);
+  }
+}
+
+// The participants of the urgent and bulk lanes (see PartyPriority).
+// Set by the thread adding a participant before its wakeup is published, and
+// cleared by the thread running the party when it completes, before its slot
+// is freed.
+class PriorityLanes {
+ public:
+  void Set(WakeupMask mask, PartyPriority priority) {
+    switch (priority) {
+      case PartyPriority::kUrgent:
+        urgent_.fetch_or(mask, std::memory_order_relaxed);
+        break;
+      case PartyPriority::kNormal:
+        break;
+      case PartyPriority::kBulk:
+        bulk_.fetch_or(mask, std::memory_order_relaxed);
+        break;
+    }
+  }
+
+  void Clear(WakeupMask mask) {
+    if ((urgent_.load(std::memory_order_relaxed) & mask) != 0) {
+      urgent_.fetch_and(~mask, std::memory_order_relaxed);
+    }
+    if ((bulk_.load(std::memory_order_relaxed) & mask) != 0) {
+      bulk_.fetch_and(~mask, std::memory_order_relaxed);
+    }
+  }
+
+  // Calls poll_one_participant(i) for each participant i woken up in wakeups:
+  // the urgent ones first, then the normal ones, then the bulk ones.
+  template <typename F>
+  void PollInOrder(WakeupMask wakeups, F poll_one_participant) {
+    const WakeupMask urgent = wakeups & urgent_.load(std::memory_order_relaxed);
+    const WakeupMask bulk = wakeups & bulk_.load(std::memory_order_relaxed);
+    if (urgent == 0 && bulk == 0) {
+      ForEachParticipant(wakeups, poll_one_participant);
+      return;
+    }
+    ForEachParticipant(urgent, poll_one_participant);
+    ForEachParticipant(wakeups & ~(urgent | bulk), poll_one_participant);
+    ForEachParticipant(bulk, poll_one_participant);
+  }
+
+ private:
+  std::atomic<WakeupMask> urgent_{0};
+  std::atomic<WakeupMask> bulk_{0};
+};
 
 }  // namespace party_detail
 
@@ -98,9 +169,11 @@ class PartySyncUsingAtomics {
   void ForceImmediateRepoll(WakeupMask mask) {
     // Or in the bit for the currently polling participant.
     // Will be grabbed next round to force a repoll of this promise.
+    const uint64_t wakeup_bits = PublishWakeups(mask);
     const uint64_t prev_state =
-        state_.fetch_or(mask, std::memory_order_relaxed);
-    LogStateChange("ForceImmediateRepoll", prev_state, prev_state | mask);
+        state_.fetch_or(wakeup_bits, std::memory_order_relaxed);
+    LogStateChange("ForceImmediateRepoll", prev_state,
+                   prev_state | wakeup_bits);
   }
 
   // Run the update loop: poll_one_participant is called with an integral index
@@ -119,22 +192,29 @@ class PartySyncUsingAtomics {
       CHECK(prev_state & kLocked);
       if (prev_state & kDestroying) return true;
       // From the previous state, extract which participants we're to wakeup.
-      uint64_t wakeups = prev_state & kWakeupMask;
+      WakeupMask wakeups = prev_state & kWakeupMask;
+      if (prev_state & kOverflowWakeup) {
+        wakeups |= overflow_wakeups_.exchange(0, std::memory_order_acquire);
+      }
       // Now update prev_state to be what we want the CAS to see below.
       prev_state &= kRefMask | kLocked | kAllocatedMask;
-      // For each wakeup bit...
-      for (size_t i = 0; wakeups != 0; i++, wakeups >>= 1) {
-        // If the bit is not set, skip.
-        if ((wakeups & 1) == 0) continue;
-        if (poll_one_participant(i)) {
-          const uint64_t allocated_bit = (1u << i << kAllocatedShift);
-          prev_state &= ~allocated_bit;
-          uint64_t finished_prev_state =
-              state_.fetch_and(~allocated_bit, std::memory_order_release);
-          LogStateChange("Run:ParticipantComplete", finished_prev_state,
-                         finished_prev_state & ~allocated_bit);
+      // For each wakeup bit, by priority...
+      lanes_.PollInOrder(wakeups, [&](size_t i) {
+        if (!poll_one_participant(i)) return;
+        const WakeupMask participant = WakeupMask{1} << i;
+        lanes_.Clear(participant);
+        if (i >= party_detail::kInlineParticipants) {
+          overflow_allocated_.fetch_and(~participant,
+                                        std::memory_order_release);
+          return;
         }
-      }
+        const uint64_t allocated_bit = (1u << i << kAllocatedShift);
+        prev_state &= ~allocated_bit;
+        uint64_t finished_prev_state =
+            state_.fetch_and(~allocated_bit, std::memory_order_release);
+        LogStateChange("Run:ParticipantComplete", finished_prev_state,
+                       finished_prev_state & ~allocated_bit);
+      });
       // Try to CAS the state we expected to have (with no wakeups or adds)
       // back to unlocked (by masking in only the ref mask - sans locked bit).
       // If this succeeds then no wakeups were added, no adds were added, and we
@@ -158,7 +238,7 @@ class PartySyncUsingAtomics {
         if (state_.compare_exchange_weak(
                 prev_state,
                 (prev_state & (kRefMask | kAllocatedMask | kLocked)) |
-                    wake_after_poll_,
+                    PublishWakeups(wake_after_poll_),
                 std::memory_order_acq_rel, std::memory_order_acquire)) {
           LogStateChange("Run:EndIteration", prev_state,
                          prev_state & (kRefMask | kAllocatedMask));
@@ -185,33 +265,43 @@ class PartySyncUsingAtomics {
     // slot upwards to ensure the same poll ordering as presentation ordering to
     // this function.
     WakeupMask wakeup_mask;
-    do {
+    for (;;) {
       wakeup_mask = 0;
       allocated = (state & kAllocatedMask) >> kAllocatedShift;
       size_t n = 0;
-      for (size_t bit = 0; n < count && bit < party_detail::kMaxParticipants;
-           bit++) {
+      for (size_t bit = 0;
+           n < count && bit < party_detail::kInlineParticipants; bit++) {
         if (allocated & (1 << bit)) continue;
         wakeup_mask |= (1 << bit);
         slots[n++] = bit;
         allocated |= 1 << bit;
       }
-      CHECK(n == count);
+      if (n < count) {
+        // Not enough inline slots: place all the new participants in overflow
+        // slots, which keeps them in presentation order.
+        wakeup_mask = AllocateOverflowSlots(count, slots);
+        IncrementRefCount();
+        break;
+      }
       // Try to allocate this slot and take a ref (atomically).
       // Ref needs to be taken because once we store the participant it could be
       // spuriously woken up and unref the party.
-    } while (!state_.compare_exchange_weak(
-        state, (state | (allocated << kAllocatedShift)) + kOneRef,
-        std::memory_order_acq_rel, std::memory_order_acquire));
-    LogStateChange("AddParticipantsAndRef", state,
-                   (state | (allocated << kAllocatedShift)) + kOneRef);
+      if (state_.compare_exchange_weak(
+              state, (state | (allocated << kAllocatedShift)) + kOneRef,
+              std::memory_order_acq_rel, std::memory_order_acquire)) {
+        LogStateChange("AddParticipantsAndRef", state,
+                       (state | (allocated << kAllocatedShift)) + kOneRef);
+        break;
+      }
+    }
 
     store(slots);
 
     // Now we need to wake up the party.
-    state = state_.fetch_or(wakeup_mask | kLocked, std::memory_order_release);
+    const uint64_t wakeup_bits = PublishWakeups(wakeup_mask);
+    state = state_.fetch_or(wakeup_bits | kLocked, std::memory_order_release);
     LogStateChange("AddParticipantsAndRef:Wakeup", state,
-                   state | wakeup_mask | kLocked);
+                   state | wakeup_bits | kLocked);
 
     // If the party was already locked, we're done.
     return ((state & kLocked) == 0);
@@ -226,9 +316,27 @@ class PartySyncUsingAtomics {
     return iteration_.load(std::memory_order_relaxed);
   }
 
+  // Sets the lane of the participants in mask. Must be called before they are
+  // woken up, i.e. from the store callback of AddParticipantsAndRef.
+  void SetPriority(WakeupMask mask, PartyPriority priority) {
+    lanes_.Set(mask, priority);
+  }
+
  private:
   bool UnreffedLast();
 
+  // Allocates count slots beyond the inline ones, returning their mask.
+  WakeupMask AllocateOverflowSlots(size_t count, size_t* slots);
+
+  // Returns the bits to set in state_ to wake up the participants in mask,
+  // after adding those beyond the inline ones to overflow_wakeups_.
+  uint64_t PublishWakeups(WakeupMask mask) {
+    const WakeupMask overflow = mask & kOverflowParticipants;
+    if (overflow == 0) return mask;
+    overflow_wakeups_.fetch_or(overflow, std::memory_order_release);
+    return (mask & kWakeupMask) | kOverflowWakeup;
+  }
+
   void LogStateChange(const char* op, uint64_t prev_state, uint64_t new_state,
                       DebugLocation loc = {}) {
     if (grpc_trace_party_state.enabled()) {
@@ -252,20 +360,28 @@ class PartySyncUsingAtomics {
   //   - 16 bits, one per participant, indicating which participants have
   //   been
   //     woken up and should be polled next time the main loop runs.
+  //   - 1 bit to indicate that participants beyond the first 16 have been
+  //     woken up: their wakeups are in overflow_wakeups_, and their slots in
+  //     overflow_allocated_.
 
   // clang-format off
   // Bits used to store 16 bits of wakeups
-  static constexpr uint64_t kWakeupMask    = 0x0000'0000'0000'ffff;
+  static constexpr uint64_t kWakeupMask     = 0x0000'0000'0000'ffff;
   // Bits used to store 16 bits of allocated participant slots.
-  static constexpr uint64_t kAllocatedMask = 0x0000'0000'ffff'0000;
+  static constexpr uint64_t kAllocatedMask  = 0x0000'0000'ffff'0000;
   // Bit indicating destruction has begun (refs went to zero)
-  static constexpr uint64_t kDestroying    = 0x0000'0001'0000'0000;
+  static constexpr uint64_t kDestroying     = 0x0000'0001'0000'0000;
+  // Bit indicating wakeups are pending in overflow_wakeups_
+  static constexpr uint64_t kOverflowWakeup = 0x0000'0002'0000'0000;
   // Bit indicating locked or not
-  static constexpr uint64_t kLocked        = 0x0000'0008'0000'0000;
+  static constexpr uint64_t kLocked         = 0x0000'0008'0000'0000;
   // Bits used to store 24 bits of ref counts
-  static constexpr uint64_t kRefMask       = 0xffff'ff00'0000'0000;
+  static constexpr uint64_t kRefMask        = 0xffff'ff00'0000'0000;
   // clang-format on
 
+  // Participants tracked by overflow_wakeups_ and overflow_allocated_.
+  static constexpr WakeupMask kOverflowParticipants =
+      ~WakeupMask{0} << party_detail::kInlineParticipants;
   // Shift to get from a participant mask to an allocated mask.
   static constexpr size_t kAllocatedShift = 16;
   // How far to shift to get the refcount
@@ -276,6 +392,10 @@ class PartySyncUsingAtomics {
   std::atomic<uint64_t> state_;
   std::atomic<uint32_t> iteration_{0};
   WakeupMask wake_after_poll_ = 0;
+  // Chained state words for the participants beyond the inline ones.
+  std::atomic<WakeupMask> overflow_wakeups_{0};
+  std::atomic<WakeupMask> overflow_allocated_{0};
+  party_detail::PriorityLanes lanes_;
 };
 
 class PartySyncUsingMutex {
@@ -302,10 +422,12 @@ class PartySyncUsingMutex {
         return false;
       }
       lock.Release();
-      for (size_t i = 0; wakeup != 0; i++, wakeup >>= 1) {
-        if ((wakeup & 1) == 0) continue;
-        if (poll_one_participant(i)) freed |= 1 << i;
-      }
+      lanes_.PollInOrder(wakeup, [&](size_t i) {
+        if (!poll_one_participant(i)) return;
+        const WakeupMask participant = WakeupMask{1} << i;
+        lanes_.Clear(participant);
+        freed |= participant;
+      });
     }
   }
 
@@ -318,10 +440,11 @@ class PartySyncUsingMutex {
     size_t n = 0;
     for (size_t bit = 0; n < count && bit < party_detail::kMaxParticipants;
          bit++) {
-      if (allocated_ & (1 << bit)) continue;
+      const WakeupMask participant = WakeupMask{1} << bit;
+      if (allocated_ & participant) continue;
       slots[n++] = bit;
-      wakeup_mask |= 1 << bit;
-      allocated_ |= 1 << bit;
+      wakeup_mask |= participant;
+      allocated_ |= participant;
     }
     CHECK(n == count);
     store(slots);
@@ -331,8 +454,13 @@ class PartySyncUsingMutex {
 
   GRPC_MUST_USE_RESULT bool ScheduleWakeup(WakeupMask mask);
 
+  void SetPriority(WakeupMask mask, PartyPriority priority) {
+    lanes_.Set(mask, priority);
+  }
+
  private:
   RefCount refs_;
+  party_detail::PriorityLanes lanes_;
   Mutex mu_;
   WakeupMask allocated_ ABSL_GUARDED_BY(mu_) = 0;
   WakeupMask wakeups_ ABSL_GUARDED_BY(mu_) = 0;
@@ -348,7 +476,8 @@ class Party : public Activity, private Wakeable {
   // One participant in the party.
   class Participant {
    public:
-    explicit Participant(absl::string_view name) : name_(name) {}
+    Participant(absl::string_view name, PartyPriority priority)
+        : name_(name), priority_(priority) {}
     // Poll the participant. Return true if complete.
     // Participant should take care of its own deallocation in this case.
     virtual bool PollParticipantPromise() = 0;
@@ -360,6 +489,7 @@ class Party : public Activity, private Wakeable {
     Wakeable* MakeNonOwningWakeable(Party* party);
 
     absl::string_view name() const { return name_; }
+    PartyPriority priority() const { return priority_; }
 
    protected:
     ~Participant();
@@ -367,6 +497,15 @@ class Party : public Activity, private Wakeable {
    private:
     Handle* handle_ = nullptr;
     absl::string_view name_;
+    PartyPriority priority_;
+  };
+
+  // Slots of the participants beyond the inline ones, allocated the first
+  // time the party has more than kInlineParticipants participants.
+  struct OverflowParticipants {
+    std::atomic<Participant*> participants[party_detail::kMaxParticipants -
+                                           party_detail::kInlineParticipants] =
+        {};
   };
 
  public:
@@ -378,13 +517,18 @@ class Party : public Activity, private Wakeable {
   // down.
   // The on_complete callback will be called with the result of the promise if
   // it completes.
-  // A maximum of sixteen promises can be spawned onto a party.
+  // The priority selects the lane in which the promise is polled when it is
+  // woken up along with other participants.
+  // A maximum of 64 promises can be spawned onto a party; beyond the first
+  // sixteen, wakeups take an extra atomic operation.
   template <typename Factory, typename OnComplete>
   void Spawn(absl::string_view name, Factory promise_factory,
-             OnComplete on_complete);
+             OnComplete on_complete,
+             PartyPriority priority = PartyPriority::kNormal);
 
   template <typename Factory>
-  auto SpawnWaitable(absl::string_view name, Factory factory);
+  auto SpawnWaitable(absl::string_view name, Factory factory,
+                     PartyPriority priority = PartyPriority::kNormal);
 
   void Orphan() final { Crash("unused"); }
 
@@ -392,7 +536,7 @@ class Party : public Activity, private Wakeable {
   void ForceImmediateRepoll(WakeupMask mask) final;
   WakeupMask CurrentParticipant() const final {
     DCHECK(currently_polling_ != kNotPolling);
-    return 1u << currently_polling_;
+    return WakeupMask{1} << currently_polling_;
   }
   Waker MakeOwningWaker() final;
   Waker MakeNonOwningWaker() final;
@@ -430,7 +574,8 @@ class Party : public Activity, private Wakeable {
 
     template <typename Factory, typename OnComplete>
     void Spawn(absl::string_view name, Factory promise_factory,
-               OnComplete on_complete);
+               OnComplete on_complete,
+               PartyPriority priority = PartyPriority::kNormal);
 
    private:
     Party* const party_;
@@ -469,8 +614,8 @@ class Party : public Activity, private Wakeable {
 
    public:
     ParticipantImpl(absl::string_view name, SuppliedFactory promise_factory,
-                    OnComplete on_complete)
-        : Participant(name), on_complete_(std::move(on_complete)) {
+                    OnComplete on_complete, PartyPriority priority)
+        : Participant(name, priority), on_complete_(std::move(on_complete)) {
       Construct(&factory_, std::move(promise_factory));
     }
     ~ParticipantImpl() {
@@ -519,8 +664,9 @@ class Party : public Activity, private Wakeable {
 
    public:
     PromiseParticipantImpl(absl::string_view name,
-                           SuppliedFactory promise_factory)
-        : Participant(name) {
+                           SuppliedFactory promise_factory,
+                           PartyPriority priority)
+        : Participant(name, priority) {
       Construct(&factory_, std::move(promise_factory));
     }
 
@@ -612,6 +758,15 @@ class Party : public Activity, private Wakeable {
   void AddParticipants(Participant** participant, size_t count);
   bool RunOneParticipant(int i);
 
+  // Returns the slot of participant i.
+  std::atomic<Participant*>& participant_slot(size_t i) {
+    if (i < party_detail::kInlineParticipants) return participants_[i];
+    return overflow_participants_.load(std::memory_order_acquire)
+        ->participants[i - party_detail::kInlineParticipants];
+  }
+  // Allocates overflow_participants_ if needed.
+  void EnsureOverflowParticipants();
+
   virtual grpc_event_engine::experimental::EventEngine* event_engine()
       const = 0;
 
@@ -630,7 +785,10 @@ class Party : public Activity, private Wakeable {
   // All current participants, using a tagged format.
   // If the lower bit is unset, then this is a Participant*.
   // If the lower bit is set, then this is a ParticipantFactory*.
-  std::atomic<Participant*> participants_[party_detail::kMaxParticipants] = {};
+  std::atomic<Participant*> participants_[party_detail::kInlineParticipants] =
+      {};
+  // Participants beyond the inline ones.
+  std::atomic<OverflowParticipants*> overflow_participants_{nullptr};
 };
 
 template <>
@@ -640,26 +798,28 @@ struct ContextSubclass<Party> {
 
 template <typename Factory, typename OnComplete>
 void Party::BulkSpawner::Spawn(absl::string_view name, Factory promise_factory,
-                               OnComplete on_complete) {
+                               OnComplete on_complete,
+                               PartyPriority priority) {
   if (grpc_trace_promise_primitives.enabled()) {
     gpr_log(GPR_DEBUG, "%s[bulk_spawn] On %p queue %s",
             party_->DebugTag().c_str(), this, std::string(name).c_str());
   }
   participants_[num_participants_++] = new ParticipantImpl<Factory, OnComplete>(
-      name, std::move(promise_factory), std::move(on_complete));
+      name, std::move(promise_factory), std::move(on_complete), priority);
 }
 
 template <typename Factory, typename OnComplete>
 void Party::Spawn(absl::string_view name, Factory promise_factory,
-                  OnComplete on_complete) {
+                  OnComplete on_complete, PartyPriority priority) {
   BulkSpawner(this).Spawn(name, std::move(promise_factory),
-                          std::move(on_complete));
+                          std::move(on_complete), priority);
 }
 
 template <typename Factory>
-auto Party::SpawnWaitable(absl::string_view name, Factory promise_factory) {
+auto Party::SpawnWaitable(absl::string_view name, Factory promise_factory,
+                          PartyPriority priority) {
   auto participant = MakeRefCounted<PromiseParticipantImpl<Factory>>(
-      name, std::move(promise_factory));
+      name, std::move(promise_factory), priority);
   Participant* p = participant->Ref().release();
   AddParticipants(&p, 1);
   return [participant = std::move(participant)]() mutable {
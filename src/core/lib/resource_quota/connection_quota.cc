@@ -41,6 +41,18 @@ bool ConnectionQuota::AllowIncomingConnection(MemoryQuotaRefPtr mem_quota,
     return false;
   }
 
+  // Accepting the connection only to shed its handshake would waste the work.
+  // Without a queue (a maximum of zero) nothing ever waits, so this never
+  // refuses connections: handshakes are shed only while every handshake
+  // executor slot is busy.
+  const int queued_handshakes =
+      queued_handshakes_.load(std::memory_order_relaxed);
+  if (queued_handshakes > 0 &&
+      queued_handshakes >=
+          max_queued_handshakes_.load(std::memory_order_relaxed)) {
+    return false;
+  }
+
   if (max_incoming_connections_.load(std::memory_order_relaxed) == INT_MAX) {
     return true;
   }
@@ -67,4 +79,40 @@ void ConnectionQuota::ReleaseConnections(int num_connections) {
             num_connections, std::memory_order_acq_rel) >= num_connections);
 }
 
+void ConnectionQuota::SetMaxQueuedHandshakes(int max_queued_handshakes) {
+  if (max_queued_handshakes < 0) {
+    gpr_log(GPR_ERROR,
+            "Ignoring negative maximum number of queued handshakes (%d)",
+            max_queued_handshakes);
+    return;
+  }
+  // The maximum can only be configured once.
+  CHECK_LT(max_queued_handshakes, INT_MAX);
+  CHECK(max_queued_handshakes_.exchange(max_queued_handshakes,
+                                        std::memory_order_release) == INT_MAX);
+}
+
+// Returns true if another handshake is allowed to wait for the handshake
+// executor.
+bool ConnectionQuota::AllowQueuedHandshake() {
+  int curr_queued_handshakes =
+      queued_handshakes_.load(std::memory_order_acquire);
+  do {
+    if (curr_queued_handshakes >=
+        max_queued_handshakes_.load(std::memory_order_relaxed)) {
+      return false;
+    }
+  } while (!queued_handshakes_.compare_exchange_weak(
+      curr_queued_handshakes, curr_queued_handshakes + 1,
+      std::memory_order_acq_rel, std::memory_order_relaxed));
+  return true;
+}
+
+// Mark queued handshakes as no longer waiting.
+void ConnectionQuota::ReleaseQueuedHandshakes(int num_handshakes) {
+  CHECK(queued_handshakes_.fetch_sub(num_handshakes,
+                                     std::memory_order_acq_rel) >=
+        num_handshakes);
+}
+
 }  // namespace grpc_core
@@ -49,9 +49,25 @@ class ConnectionQuota : public RefCounted<ConnectionQuota> {
   // Mark connections as closed.
   void ReleaseConnections(int num_connections);
 
+  // Set the maximum number of handshakes allowed to wait for the handshake
+  // executor. While that many are waiting, new handshakes are shed and
+  // incoming connections are not accepted. Zero means no handshake waits:
+  // handshakes are shed whenever the executor is busy, and connections are
+  // still accepted. Negative values are ignored.
+  void SetMaxQueuedHandshakes(int max_queued_handshakes);
+
+  // Returns true if another handshake is allowed to wait for the handshake
+  // executor.
+  bool AllowQueuedHandshake();
+
+  // Mark queued handshakes as no longer waiting.
+  void ReleaseQueuedHandshakes(int num_handshakes);
+
  private:
   std::atomic<int> active_incoming_connections_{0};
   std::atomic<int> max_incoming_connections_{std::numeric_limits<int>::max()};
+  std::atomic<int> queued_handshakes_{0};
+  std::atomic<int> max_queued_handshakes_{std::numeric_limits<int>::max()};
 };
 
 using ConnectionQuotaRefPtr = RefCountedPtr<ConnectionQuota>;
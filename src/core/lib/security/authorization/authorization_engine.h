@@ -37,6 +37,11 @@ class AuthorizationEngine : public RefCounted<AuthorizationEngine> {
   };
 
   virtual Decision Evaluate(const EvaluateArgs& args) const = 0;
+
+  // Invoked when a channel is set up, with the EvaluateArgs of its per
+  // channel args, so that the engine can evaluate ahead of its calls what
+  // only depends on the channel.
+  virtual void PrepareChannel(const EvaluateArgs& /*args*/) const {}
 };
 
 }  // namespace grpc_core
@@ -16,6 +16,8 @@
 
 #include <string.h>
 
+#include <algorithm>
+
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/match.h"
@@ -69,6 +71,31 @@ EvaluateArgs::PerChannelArgs::Address ParseEndpointUri(
 
 }  // namespace
 
+std::shared_ptr<ChannelRuleResults::Results> ChannelRuleResults::Get(
+    uint64_t engine_id, size_t num_rules,
+    absl::FunctionRef<std::vector<uint32_t>()> channel_matches) {
+  MutexLock lock(&mu_);
+  if (!engines_.empty() && engines_.back().first == engine_id) {
+    return engines_.back().second;
+  }
+  auto it = std::find_if(
+      engines_.begin(), engines_.end(),
+      [engine_id](const std::pair<uint64_t, std::shared_ptr<Results>>& entry) {
+        return entry.first == engine_id;
+      });
+  std::pair<uint64_t, std::shared_ptr<Results>> entry;
+  if (it != engines_.end()) {
+    entry = std::move(*it);
+    engines_.erase(it);
+  } else {
+    if (engines_.size() == kMaxEngines) engines_.erase(engines_.begin());
+    entry = {engine_id,
+             std::make_shared<Results>(num_rules, channel_matches())};
+  }
+  engines_.push_back(std::move(entry));
+  return engines_.back().second;
+}
+
 EvaluateArgs::PerChannelArgs::PerChannelArgs(grpc_auth_context* auth_context,
                                              const ChannelArgs& args) {
   if (auth_context != nullptr) {
@@ -218,4 +245,11 @@ absl::string_view EvaluateArgs::GetSubject() const {
   return channel_args_->subject;
 }
 
+ChannelRuleResults* EvaluateArgs::GetChannelRuleResults() const {
+  if (channel_args_ == nullptr) {
+    return nullptr;
+  }
+  return channel_args_->rule_results.get();
+}
+
 }  // namespace grpc_core
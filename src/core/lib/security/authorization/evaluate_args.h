@@ -15,9 +15,17 @@
 #ifndef GRPC_SRC_CORE_LIB_SECURITY_AUTHORIZATION_EVALUATE_ARGS_H
 #define GRPC_SRC_CORE_LIB_SECURITY_AUTHORIZATION_EVALUATE_ARGS_H
 
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/function_ref.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
 
@@ -25,11 +33,58 @@
 #include <grpc/support/port_platform.h>
 
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/resolved_address.h"
 #include "src/core/lib/transport/metadata_batch.h"
 
 namespace grpc_core {
 
+// The results of the authorization rules that only depend on the channel,
+// memoized by the authorization engines that evaluate them (see RbacProgram),
+// so that each of them is evaluated once per channel rather than per call.
+// Thread safe.
+class ChannelRuleResults final {
+ public:
+  // Results of the rules of one engine.
+  class Results final {
+   public:
+    Results(size_t num_rules, std::vector<uint32_t> channel_matches)
+        : values_(new std::atomic<uint8_t>[num_rules]()),
+          channel_matches_(std::move(channel_matches)) {}
+
+    // 0 until the rule is evaluated, then 1 if it does not match and 2 if it
+    // does.
+    std::atomic<uint8_t>& operator[](size_t rule) { return values_[rule]; }
+
+    // The entries of the engine (the policies, for RbacProgram) whose
+    // channel scoped part matches the channel, computed when the results are
+    // created.
+    const std::vector<uint32_t>& channel_matches() const {
+      return channel_matches_;
+    }
+
+   private:
+    std::unique_ptr<std::atomic<uint8_t>[]> values_;
+    const std::vector<uint32_t> channel_matches_;
+  };
+
+  // Returns the results of the engine \a engine_id, which memoizes \a
+  // num_rules rules. If there are none yet, \a channel_matches is invoked,
+  // under a lock, to compute them. Only the results of the engines used last
+  // are kept.
+  std::shared_ptr<Results> Get(
+      uint64_t engine_id, size_t num_rules,
+      absl::FunctionRef<std::vector<uint32_t>()> channel_matches);
+
+ private:
+  static constexpr size_t kMaxEngines = 4;
+
+  Mutex mu_;
+  // Most recently used last.
+  std::vector<std::pair<uint64_t, std::shared_ptr<Results>>> engines_
+      ABSL_GUARDED_BY(mu_);
+};
+
 class EvaluateArgs final {
  public:
   // Caller is responsible for ensuring auth_context outlives PerChannelArgs
@@ -53,6 +108,8 @@ class EvaluateArgs final {
     absl::string_view subject;
     Address local_address;
     Address peer_address;
+    std::shared_ptr<ChannelRuleResults> rule_results =
+        std::make_shared<ChannelRuleResults>();
   };
 
   EvaluateArgs(grpc_metadata_batch* metadata, PerChannelArgs* channel_args)
@@ -83,6 +140,8 @@ class EvaluateArgs final {
   std::vector<absl::string_view> GetDnsSans() const;
   absl::string_view GetCommonName() const;
   absl::string_view GetSubject() const;
+  // Returns nullptr if there are no per channel args.
+  ChannelRuleResults* GetChannelRuleResults() const;
 
  private:
   grpc_metadata_batch* metadata_;
@@ -49,14 +49,8 @@ bool ShouldLog(const Decision& decision,
 GrpcAuthorizationEngine::GrpcAuthorizationEngine(Rbac policy)
     : name_(std::move(policy.name)),
       action_(policy.action),
+      program_(std::move(policy.policies)),
       audit_condition_(policy.audit_condition) {
-  for (auto& sub_policy : policy.policies) {
-    Policy policy;
-    policy.name = sub_policy.first;
-    policy.matcher = std::make_unique<PolicyAuthorizationMatcher>(
-        std::move(sub_policy.second));
-    policies_.push_back(std::move(policy));
-  }
   for (auto& logger_config : policy.logger_configs) {
     auto logger =
         AuditLoggerRegistry::CreateAuditLogger(std::move(logger_config));
@@ -69,7 +63,7 @@ GrpcAuthorizationEngine::GrpcAuthorizationEngine(
     GrpcAuthorizationEngine&& other) noexcept
     : name_(std::move(other.name_)),
       action_(other.action_),
-      policies_(std::move(other.policies_)),
+      program_(std::move(other.program_)),
       audit_condition_(other.audit_condition_),
       audit_loggers_(std::move(other.audit_loggers_)) {}
 
@@ -77,7 +71,7 @@ GrpcAuthorizationEngine& GrpcAuthorizationEngine::operator=(
     GrpcAuthorizationEngine&& other) noexcept {
   name_ = std::move(other.name_);
   action_ = other.action_;
-  policies_ = std::move(other.policies_);
+  program_ = std::move(other.program_);
   audit_condition_ = other.audit_condition_;
   audit_loggers_ = std::move(other.audit_loggers_);
   return *this;
@@ -86,14 +80,9 @@ GrpcAuthorizationEngine& GrpcAuthorizationEngine::operator=(
 AuthorizationEngine::Decision GrpcAuthorizationEngine::Evaluate(
     const EvaluateArgs& args) const {
   Decision decision;
-  bool matches = false;
-  for (const auto& policy : policies_) {
-    if (policy.matcher->Matches(args)) {
-      matches = true;
-      decision.matching_policy_name = policy.name;
-      break;
-    }
-  }
+  const std::string* matching_policy_name = program_.FindMatchingPolicy(args);
+  bool matches = matching_policy_name != nullptr;
+  if (matches) decision.matching_policy_name = *matching_policy_name;
   decision.type = (matches == (action_ == Rbac::Action::kAllow))
                       ? Decision::Type::kAllow
                       : Decision::Type::kDeny;
@@ -26,8 +26,8 @@
 
 #include "src/core/lib/security/authorization/authorization_engine.h"
 #include "src/core/lib/security/authorization/evaluate_args.h"
-#include "src/core/lib/security/authorization/matchers.h"
 #include "src/core/lib/security/authorization/rbac_policy.h"
+#include "src/core/lib/security/authorization/rbac_program.h"
 
 namespace grpc_core {
 
@@ -38,7 +38,8 @@ using experimental::AuditLogger;
 // based on permission and principal configs in the provided RBAC policy and the
 // engine type. This engine ignores condition field in RBAC config. It is the
 // caller's responsibility to provide RBAC policies that are compatible with
-// this engine.
+// this engine. The policies are compiled into an RbacProgram when the engine
+// is built.
 class GrpcAuthorizationEngine : public AuthorizationEngine {
  public:
   // Builds GrpcAuthorizationEngine without any policies.
@@ -53,7 +54,7 @@ class GrpcAuthorizationEngine : public AuthorizationEngine {
   Rbac::Action action() const { return action_; }
 
   // Required only for testing purpose.
-  size_t num_policies() const { return policies_.size(); }
+  size_t num_policies() const { return program_.num_policies(); }
 
   // Required only for testing purpose.
   Rbac::AuditCondition audit_condition() const { return audit_condition_; }
@@ -67,15 +68,14 @@ class GrpcAuthorizationEngine : public AuthorizationEngine {
   // whether allow/deny this request.
   Decision Evaluate(const EvaluateArgs& args) const override;
 
- private:
-  struct Policy {
-    std::string name;
-    std::unique_ptr<AuthorizationMatcher> matcher;
-  };
+  void PrepareChannel(const EvaluateArgs& args) const override {
+    program_.PrepareChannel(args);
+  }
 
+ private:
   std::string name_;
   Rbac::Action action_;
-  std::vector<Policy> policies_;
+  RbacProgram program_;
   Rbac::AuditCondition audit_condition_;
   std::vector<std::unique_ptr<AuditLogger>> audit_loggers_;
 };
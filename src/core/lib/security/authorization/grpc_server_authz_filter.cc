@@ -49,7 +49,19 @@ GrpcServerAuthzFilter::GrpcServerAuthzFilter(
     RefCountedPtr<grpc_authorization_policy_provider> provider)
     : auth_context_(std::move(auth_context)),
       per_channel_evaluate_args_(auth_context_.get(), args),
-      provider_(std::move(provider)) {}
+      provider_(std::move(provider)) {
+  // The peer of the channel is known: evaluate the rules that only depend on
+  // it now rather than on the first call.
+  EvaluateArgs channel_args(nullptr, &per_channel_evaluate_args_);
+  grpc_authorization_policy_provider::AuthorizationEngines engines =
+      provider_->engines();
+  if (engines.deny_engine != nullptr) {
+    engines.deny_engine->PrepareChannel(channel_args);
+  }
+  if (engines.allow_engine != nullptr) {
+    engines.allow_engine->PrepareChannel(channel_args);
+  }
+}
 
 absl::StatusOr<std::unique_ptr<GrpcServerAuthzFilter>>
 GrpcServerAuthzFilter::Create(const ChannelArgs& args, ChannelFilter::Args) {
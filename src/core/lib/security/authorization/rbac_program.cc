@@ -0,0 +1,479 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/security/authorization/rbac_program.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+
+#include <grpc/grpc_security_constants.h>
+#include <grpc/support/log.h>
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/address_utils/parse_address.h"
+#include "src/core/lib/address_utils/sockaddr_utils.h"
+
+namespace grpc_core {
+
+namespace {
+
+std::atomic<uint64_t> g_next_program_id{1};
+
+bool IsExactMatcher(const StringMatcher& matcher) {
+  return matcher.type() == StringMatcher::Type::kExact &&
+         matcher.case_sensitive();
+}
+
+bool IsExactMatcher(const HeaderMatcher& matcher) {
+  return matcher.type() == HeaderMatcher::Type::kExact &&
+         matcher.case_sensitive() && !matcher.invert_match();
+}
+
+// Returns the path matcher of a rule, or nullptr if it is not a path rule.
+const StringMatcher* GetPathMatcher(const Rbac::Permission& permission) {
+  if (permission.type != Rbac::Permission::RuleType::kPath) return nullptr;
+  return &permission.string_matcher;
+}
+
+const StringMatcher* GetPathMatcher(const Rbac::Principal& principal) {
+  if (principal.type != Rbac::Principal::RuleType::kPath) return nullptr;
+  return &principal.string_matcher.value();
+}
+
+// Returns the header matcher of a rule, or nullptr if it is not a header
+// rule.
+template <typename Rule>
+const HeaderMatcher* GetHeaderMatcher(const Rule& rule) {
+  if (rule.type != Rule::RuleType::kHeader) return nullptr;
+  return &rule.header_matcher;
+}
+
+}  // namespace
+
+//
+// RbacProgram::CallAttributes
+//
+
+// The attributes of a call that the rules match, extracted from the
+// EvaluateArgs the first time a rule needs them.
+class RbacProgram::CallAttributes final {
+ public:
+  CallAttributes(const EvaluateArgs& args, size_t num_headers)
+      : args_(args), headers_(num_headers) {}
+
+  const EvaluateArgs& args() const { return args_; }
+
+  ChannelRuleResults::Results* memo() const { return memo_.get(); }
+  void set_memo(std::shared_ptr<ChannelRuleResults::Results> memo) {
+    memo_ = std::move(memo);
+  }
+
+  absl::string_view path() {
+    if (!path_.has_value()) path_ = args_.GetPath();
+    return *path_;
+  }
+
+  absl::optional<absl::string_view> header(size_t index,
+                                           const std::string& name) {
+    Header& header = headers_[index];
+    if (!header.extracted) {
+      header.value = args_.GetHeaderValue(name, &header.concatenated_value);
+      header.extracted = true;
+    }
+    return header.value;
+  }
+
+ private:
+  struct Header {
+    bool extracted = false;
+    absl::optional<absl::string_view> value;
+    // Storage for value, when the header is present more than once.
+    std::string concatenated_value;
+  };
+
+  const EvaluateArgs& args_;
+  std::shared_ptr<ChannelRuleResults::Results> memo_;
+  absl::optional<absl::string_view> path_;
+  // Never resized, so that the values can point to the concatenated values.
+  std::vector<Header> headers_;
+};
+
+//
+// RbacProgram
+//
+
+RbacProgram::RbacProgram(std::map<std::string, Rbac::Policy> policies)
+    : id_(g_next_program_id.fetch_add(1, std::memory_order_relaxed)) {
+  for (auto& p : policies) {
+    std::vector<uint32_t> conjuncts;
+    AddConjuncts(Compile(std::move(p.second.permissions)), &conjuncts);
+    AddConjuncts(Compile(std::move(p.second.principals)), &conjuncts);
+    std::vector<uint32_t> channel_conjuncts;
+    std::vector<uint32_t> call_conjuncts;
+    for (uint32_t conjunct : conjuncts) {
+      (nodes_[conjunct].channel_level ? channel_conjuncts : call_conjuncts)
+          .push_back(conjunct);
+    }
+    Policy policy;
+    policy.name = p.first;
+    policy.channel_rules =
+        channel_conjuncts.empty()
+            ? AddNode(NodeType::kAlways, /*channel_level=*/true)
+            : AddParent(NodeType::kAnd, std::move(channel_conjuncts));
+    policy.call_rules =
+        call_conjuncts.empty()
+            ? AddNode(NodeType::kAlways, /*channel_level=*/true)
+            : AddParent(NodeType::kAnd, std::move(call_conjuncts));
+    // The channel rules are evaluated once per channel anyway.
+    AssignMemoSlots(policy.call_rules, /*parent_channel_level=*/false);
+    policies_.push_back(std::move(policy));
+  }
+}
+
+const std::string* RbacProgram::FindMatchingPolicy(
+    const EvaluateArgs& args) const {
+  CallAttributes attributes(args, header_names_.size());
+  std::shared_ptr<ChannelRuleResults::Results> channel_results =
+      GetChannelResults(attributes);
+  if (channel_results == nullptr) {
+    for (const Policy& policy : policies_) {
+      if (Evaluate(policy.channel_rules, attributes) &&
+          Evaluate(policy.call_rules, attributes)) {
+        return &policy.name;
+      }
+    }
+    return nullptr;
+  }
+  const std::vector<uint32_t>& candidates = channel_results->channel_matches();
+  attributes.set_memo(std::move(channel_results));
+  for (uint32_t index : candidates) {
+    const Policy& policy = policies_[index];
+    if (Evaluate(policy.call_rules, attributes)) return &policy.name;
+  }
+  return nullptr;
+}
+
+void RbacProgram::PrepareChannel(const EvaluateArgs& args) const {
+  CallAttributes attributes(args, header_names_.size());
+  GetChannelResults(attributes);
+}
+
+std::shared_ptr<ChannelRuleResults::Results> RbacProgram::GetChannelResults(
+    CallAttributes& attributes) const {
+  ChannelRuleResults* rule_results = attributes.args().GetChannelRuleResults();
+  if (rule_results == nullptr || policies_.empty()) return nullptr;
+  return rule_results->Get(id_, num_memo_slots_, [&]() {
+    std::vector<uint32_t> candidates;
+    for (size_t i = 0; i < policies_.size(); ++i) {
+      if (Evaluate(policies_[i].channel_rules, attributes)) {
+        candidates.push_back(i);
+      }
+    }
+    return candidates;
+  });
+}
+
+uint32_t RbacProgram::AddNode(NodeType type, bool channel_level,
+                              uint32_t operand) {
+  Node node;
+  node.type = type;
+  node.channel_level = channel_level;
+  node.operand = operand;
+  nodes_.push_back(node);
+  return nodes_.size() - 1;
+}
+
+uint32_t RbacProgram::AddParent(NodeType type, std::vector<uint32_t> children) {
+  if ((type == NodeType::kAnd || type == NodeType::kOr) &&
+      children.size() == 1) {
+    return children[0];
+  }
+  // The rules have no side effects, so the children can be evaluated in any
+  // order: the ones that only depend on the channel go first, since they are
+  // memoized.
+  std::stable_partition(children.begin(), children.end(), [&](uint32_t child) {
+    return nodes_[child].channel_level;
+  });
+  Node node;
+  node.type = type;
+  node.channel_level = std::all_of(
+      children.begin(), children.end(),
+      [&](uint32_t child) { return nodes_[child].channel_level; });
+  node.children_begin = children_.size();
+  children_.insert(children_.end(), children.begin(), children.end());
+  node.children_end = children_.size();
+  nodes_.push_back(node);
+  return nodes_.size() - 1;
+}
+
+size_t RbacProgram::HeaderIndex(const std::string& name) {
+  auto it = std::find(header_names_.begin(), header_names_.end(), name);
+  if (it != header_names_.end()) return it - header_names_.begin();
+  header_names_.push_back(name);
+  return header_names_.size() - 1;
+}
+
+uint32_t RbacProgram::AddIpRule(bool local, const Rbac::CidrRange& range) {
+  IpRule rule;
+  rule.local = local;
+  rule.prefix_len = range.prefix_len;
+  auto address =
+      StringToSockaddr(range.address_prefix, 0);  // Port does not matter here.
+  if (!address.ok()) {
+    gpr_log(GPR_DEBUG, "CidrRange address \"%s\" is not IPv4/IPv6. Error: %s",
+            range.address_prefix.c_str(), address.status().ToString().c_str());
+    memset(&rule.subnet_address, 0, sizeof(rule.subnet_address));
+  } else {
+    rule.subnet_address = *address;
+    grpc_sockaddr_mask_bits(&rule.subnet_address, rule.prefix_len);
+  }
+  ip_rules_.push_back(rule);
+  return AddNode(NodeType::kIp, /*channel_level=*/true, ip_rules_.size() - 1);
+}
+
+template <typename Rule>
+uint32_t RbacProgram::CompileOr(std::vector<std::unique_ptr<Rule>> rules) {
+  absl::flat_hash_set<std::string> paths;
+  // Keyed by header index.
+  std::map<size_t, absl::flat_hash_set<std::string>> header_values;
+  std::vector<uint32_t> children;
+  for (auto& rule : rules) {
+    const StringMatcher* path_matcher = GetPathMatcher(*rule);
+    if (path_matcher != nullptr && IsExactMatcher(*path_matcher)) {
+      paths.insert(path_matcher->string_matcher());
+      continue;
+    }
+    const HeaderMatcher* header_matcher = GetHeaderMatcher(*rule);
+    if (header_matcher != nullptr && IsExactMatcher(*header_matcher)) {
+      header_values[HeaderIndex(header_matcher->name())].insert(
+          header_matcher->string_matcher());
+      continue;
+    }
+    children.push_back(Compile(std::move(*rule)));
+  }
+  if (!paths.empty()) {
+    path_set_rules_.push_back(std::move(paths));
+    children.push_back(AddNode(NodeType::kPathSet, /*channel_level=*/false,
+                               path_set_rules_.size() - 1));
+  }
+  for (auto& p : header_values) {
+    header_set_rules_.push_back({p.first, std::move(p.second)});
+    children.push_back(AddNode(NodeType::kHeaderSet, /*channel_level=*/false,
+                               header_set_rules_.size() - 1));
+  }
+  return AddParent(NodeType::kOr, std::move(children));
+}
+
+uint32_t RbacProgram::Compile(Rbac::Permission permission) {
+  switch (permission.type) {
+    case Rbac::Permission::RuleType::kAnd: {
+      std::vector<uint32_t> children;
+      for (auto& rule : permission.permissions) {
+        children.push_back(Compile(std::move(*rule)));
+      }
+      return AddParent(NodeType::kAnd, std::move(children));
+    }
+    case Rbac::Permission::RuleType::kOr:
+      return CompileOr(std::move(permission.permissions));
+    case Rbac::Permission::RuleType::kNot:
+      return AddParent(NodeType::kNot,
+                       {Compile(std::move(*permission.permissions[0]))});
+    case Rbac::Permission::RuleType::kAny:
+      return AddNode(NodeType::kAlways, /*channel_level=*/true);
+    case Rbac::Permission::RuleType::kHeader:
+      header_rules_.push_back(
+          {HeaderIndex(permission.header_matcher.name()),
+           std::move(permission.header_matcher)});
+      return AddNode(NodeType::kHeader, /*channel_level=*/false,
+                     header_rules_.size() - 1);
+    case Rbac::Permission::RuleType::kPath:
+      path_rules_.push_back(std::move(permission.string_matcher));
+      return AddNode(NodeType::kPath, /*channel_level=*/false,
+                     path_rules_.size() - 1);
+    case Rbac::Permission::RuleType::kDestIp:
+      return AddIpRule(/*local=*/true, permission.ip);
+    case Rbac::Permission::RuleType::kDestPort:
+      return AddNode(NodeType::kPort, /*channel_level=*/true, permission.port);
+    case Rbac::Permission::RuleType::kMetadata:
+      // See MetadataAuthorizationMatcher.
+      return AddNode(permission.invert ? NodeType::kAlways : NodeType::kNever,
+                     /*channel_level=*/true);
+    case Rbac::Permission::RuleType::kReqServerName:
+      // Currently we only support matching against an empty string.
+      return AddNode(permission.string_matcher.Match("") ? NodeType::kAlways
+                                                         : NodeType::kNever,
+                     /*channel_level=*/true);
+  }
+  return AddNode(NodeType::kNever, /*channel_level=*/true);
+}
+
+uint32_t RbacProgram::Compile(Rbac::Principal principal) {
+  switch (principal.type) {
+    case Rbac::Principal::RuleType::kAnd: {
+      std::vector<uint32_t> children;
+      for (auto& id : principal.principals) {
+        children.push_back(Compile(std::move(*id)));
+      }
+      return AddParent(NodeType::kAnd, std::move(children));
+    }
+    case Rbac::Principal::RuleType::kOr:
+      return CompileOr(std::move(principal.principals));
+    case Rbac::Principal::RuleType::kNot:
+      return AddParent(NodeType::kNot,
+                       {Compile(std::move(*principal.principals[0]))});
+    case Rbac::Principal::RuleType::kAny:
+      return AddNode(NodeType::kAlways, /*channel_level=*/true);
+    case Rbac::Principal::RuleType::kPrincipalName:
+      authenticated_rules_.push_back(std::move(principal.string_matcher));
+      return AddNode(NodeType::kAuthenticated, /*channel_level=*/true,
+                     authenticated_rules_.size() - 1);
+    case Rbac::Principal::RuleType::kSourceIp:
+    case Rbac::Principal::RuleType::kDirectRemoteIp:
+    case Rbac::Principal::RuleType::kRemoteIp:
+      return AddIpRule(/*local=*/false, principal.ip);
+    case Rbac::Principal::RuleType::kHeader:
+      header_rules_.push_back({HeaderIndex(principal.header_matcher.name()),
+                               std::move(principal.header_matcher)});
+      return AddNode(NodeType::kHeader, /*channel_level=*/false,
+                     header_rules_.size() - 1);
+    case Rbac::Principal::RuleType::kPath:
+      path_rules_.push_back(std::move(principal.string_matcher.value()));
+      return AddNode(NodeType::kPath, /*channel_level=*/false,
+                     path_rules_.size() - 1);
+    case Rbac::Principal::RuleType::kMetadata:
+      return AddNode(principal.invert ? NodeType::kAlways : NodeType::kNever,
+                     /*channel_level=*/true);
+  }
+  return AddNode(NodeType::kNever, /*channel_level=*/true);
+}
+
+void RbacProgram::AssignMemoSlots(uint32_t index, bool parent_channel_level) {
+  Node& node = nodes_[index];
+  // Only the largest subtrees that depend on the channel alone are memoized,
+  // and constants are not worth it.
+  if (node.channel_level && !parent_channel_level &&
+      node.type != NodeType::kAlways && node.type != NodeType::kNever) {
+    node.memo_slot = num_memo_slots_++;
+  }
+  for (uint32_t i = node.children_begin; i < node.children_end; ++i) {
+    AssignMemoSlots(children_[i], node.channel_level);
+  }
+}
+
+void RbacProgram::AddConjuncts(uint32_t index,
+                               std::vector<uint32_t>* conjuncts) const {
+  const Node& node = nodes_[index];
+  if (node.type != NodeType::kAnd) {
+    conjuncts->push_back(index);
+    return;
+  }
+  for (uint32_t i = node.children_begin; i < node.children_end; ++i) {
+    AddConjuncts(children_[i], conjuncts);
+  }
+}
+
+bool RbacProgram::Evaluate(uint32_t index, CallAttributes& attributes) const {
+  const Node& node = nodes_[index];
+  ChannelRuleResults::Results* memo = attributes.memo();
+  if (node.memo_slot < 0 || memo == nullptr) {
+    return EvaluateNode(node, attributes);
+  }
+  // Concurrent calls may both evaluate the node, with the same result.
+  std::atomic<uint8_t>& result = (*memo)[node.memo_slot];
+  uint8_t value = result.load(std::memory_order_relaxed);
+  if (value != 0) return value == 2;
+  bool matches = EvaluateNode(node, attributes);
+  result.store(matches ? 2 : 1, std::memory_order_relaxed);
+  return matches;
+}
+
+bool RbacProgram::EvaluateNode(const Node& node,
+                               CallAttributes& attributes) const {
+  switch (node.type) {
+    case NodeType::kAlways:
+      return true;
+    case NodeType::kNever:
+      return false;
+    case NodeType::kAnd:
+      for (uint32_t i = node.children_begin; i < node.children_end; ++i) {
+        if (!Evaluate(children_[i], attributes)) return false;
+      }
+      return true;
+    case NodeType::kOr:
+      for (uint32_t i = node.children_begin; i < node.children_end; ++i) {
+        if (Evaluate(children_[i], attributes)) return true;
+      }
+      return false;
+    case NodeType::kNot:
+      return !Evaluate(children_[node.children_begin], attributes);
+    case NodeType::kHeader: {
+      const HeaderRule& rule = header_rules_[node.operand];
+      return rule.matcher.Match(
+          attributes.header(rule.header, header_names_[rule.header]));
+    }
+    case NodeType::kHeaderSet: {
+      const HeaderSetRule& rule = header_set_rules_[node.operand];
+      absl::optional<absl::string_view> value =
+          attributes.header(rule.header, header_names_[rule.header]);
+      return value.has_value() && rule.values.contains(*value);
+    }
+    case NodeType::kPath: {
+      absl::string_view path = attributes.path();
+      return !path.empty() && path_rules_[node.operand].Match(path);
+    }
+    case NodeType::kPathSet: {
+      absl::string_view path = attributes.path();
+      return !path.empty() && path_set_rules_[node.operand].contains(path);
+    }
+    case NodeType::kIp: {
+      const IpRule& rule = ip_rules_[node.operand];
+      grpc_resolved_address address = rule.local
+                                          ? attributes.args().GetLocalAddress()
+                                          : attributes.args().GetPeerAddress();
+      return grpc_sockaddr_match_subnet(&address, &rule.subnet_address,
+                                        rule.prefix_len);
+    }
+    case NodeType::kPort:
+      return attributes.args().GetLocalPort() ==
+             static_cast<int>(node.operand);
+    case NodeType::kAuthenticated: {
+      // See AuthenticatedAuthorizationMatcher.
+      const EvaluateArgs& args = attributes.args();
+      if (args.GetTransportSecurityType() != GRPC_SSL_TRANSPORT_SECURITY_TYPE &&
+          args.GetTransportSecurityType() != GRPC_TLS_TRANSPORT_SECURITY_TYPE) {
+        return false;
+      }
+      const absl::optional<StringMatcher>& matcher =
+          authenticated_rules_[node.operand];
+      if (!matcher.has_value()) return true;
+      for (absl::string_view uri : args.GetUriSans()) {
+        if (matcher->Match(uri)) return true;
+      }
+      for (absl::string_view dns : args.GetDnsSans()) {
+        if (matcher->Match(dns)) return true;
+      }
+      return matcher->Match(args.GetSubject());
+    }
+  }
+  return false;
+}
+
+}  // namespace grpc_core
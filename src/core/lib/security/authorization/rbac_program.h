@@ -0,0 +1,173 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_SECURITY_AUTHORIZATION_RBAC_PROGRAM_H
+#define GRPC_SRC_CORE_LIB_SECURITY_AUTHORIZATION_RBAC_PROGRAM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/container/flat_hash_set.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/iomgr/resolved_address.h"
+#include "src/core/lib/matchers/matchers.h"
+#include "src/core/lib/security/authorization/evaluate_args.h"
+#include "src/core/lib/security/authorization/rbac_policy.h"
+
+namespace grpc_core {
+
+// The policies of an RBAC config, compiled when the config is loaded.
+//
+// The permission and principal rules of all the policies are flattened into a
+// single array of nodes, evaluated without virtual calls. The exact paths and
+// header values listed by Or rules are looked up in hash sets. The path and
+// headers of a call are extracted once, however many rules use them.
+//
+// The conjuncts of each policy are split into the channel scoped ones (peer
+// identity and addresses, in most configs) and the call scoped ones (path and
+// headers). The channel scoped part of every policy is evaluated once per
+// channel, and the resulting list of candidate policies is kept in
+// EvaluateArgs::PerChannelArgs: a call only evaluates the call scoped part of
+// the candidates. The channel scoped subtrees nested in call scoped rules are
+// memoized there too.
+//
+// Matches exactly the same requests as PolicyAuthorizationMatcher.
+class RbacProgram final {
+ public:
+  RbacProgram() = default;
+  explicit RbacProgram(std::map<std::string, Rbac::Policy> policies);
+
+  RbacProgram(RbacProgram&& other) noexcept = default;
+  RbacProgram& operator=(RbacProgram&& other) noexcept = default;
+
+  size_t num_policies() const { return policies_.size(); }
+
+  // Returns the name of the first policy that matches \a args, or nullptr if
+  // none does.
+  const std::string* FindMatchingPolicy(const EvaluateArgs& args) const;
+
+  // Evaluates the channel scoped part of the policies for the channel of \a
+  // args, if not done yet, so that the calls of the channel do not have to.
+  void PrepareChannel(const EvaluateArgs& args) const;
+
+ private:
+  enum class NodeType : uint8_t {
+    kAlways,
+    kNever,
+    kAnd,
+    kOr,
+    kNot,
+    kHeader,
+    kHeaderSet,
+    kPath,
+    kPathSet,
+    kIp,
+    kPort,
+    kAuthenticated,
+  };
+
+  struct Node {
+    NodeType type;
+    // Whether the result of the node only depends on the channel.
+    bool channel_level = false;
+    // Index of the memoized result of the node in ChannelRuleResults, or -1
+    // if the node is not memoized.
+    int memo_slot = -1;
+    // For kAnd, kOr and kNot: the children are children_[children_begin,
+    // children_end).
+    uint32_t children_begin = 0;
+    uint32_t children_end = 0;
+    // For the other types, the index of the rule in the vector of its type,
+    // or the port for kPort.
+    uint32_t operand = 0;
+  };
+
+  struct HeaderRule {
+    // Index of the header in header_names_.
+    size_t header;
+    HeaderMatcher matcher;
+  };
+
+  struct HeaderSetRule {
+    size_t header;
+    absl::flat_hash_set<std::string> values;
+  };
+
+  struct IpRule {
+    // Whether the local address is matched, rather than the peer address.
+    bool local;
+    // Subnet masked address.
+    grpc_resolved_address subnet_address;
+    uint32_t prefix_len;
+  };
+
+  struct Policy {
+    std::string name;
+    // The conjuncts of the policy that only depend on the channel.
+    uint32_t channel_rules;
+    // The other conjuncts.
+    uint32_t call_rules;
+  };
+
+  class CallAttributes;
+
+  uint32_t AddNode(NodeType type, bool channel_level, uint32_t operand = 0);
+  uint32_t AddParent(NodeType type, std::vector<uint32_t> children);
+  size_t HeaderIndex(const std::string& name);
+  uint32_t AddIpRule(bool local, const Rbac::CidrRange& range);
+
+  uint32_t Compile(Rbac::Permission permission);
+  uint32_t Compile(Rbac::Principal principal);
+  // Compiles an Or rule, with its exact path and header matchers merged into
+  // hash sets.
+  template <typename Rule>
+  uint32_t CompileOr(std::vector<std::unique_ptr<Rule>> rules);
+  void AssignMemoSlots(uint32_t node, bool parent_channel_level);
+  void AddConjuncts(uint32_t node, std::vector<uint32_t>* conjuncts) const;
+
+  // Returns the results of the channel of \a attributes, or nullptr if
+  // there is no channel.
+  std::shared_ptr<ChannelRuleResults::Results> GetChannelResults(
+      CallAttributes& attributes) const;
+
+  bool Evaluate(uint32_t node, CallAttributes& attributes) const;
+  bool EvaluateNode(const Node& node, CallAttributes& attributes) const;
+
+  // Identifies the program in ChannelRuleResults.
+  uint64_t id_ = 0;
+  std::vector<Node> nodes_;
+  std::vector<uint32_t> children_;
+  std::vector<std::string> header_names_;
+  std::vector<HeaderRule> header_rules_;
+  std::vector<HeaderSetRule> header_set_rules_;
+  std::vector<StringMatcher> path_rules_;
+  std::vector<absl::flat_hash_set<std::string>> path_set_rules_;
+  std::vector<IpRule> ip_rules_;
+  // Principal name matchers of kAuthenticated rules; nullopt allows any
+  // authenticated peer.
+  std::vector<absl::optional<StringMatcher>> authenticated_rules_;
+  size_t num_memo_slots_ = 0;
+  std::vector<Policy> policies_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_SECURITY_AUTHORIZATION_RBAC_PROGRAM_H
@@ -381,6 +381,65 @@ int64_t FileWatcherCertificateProvider::TestOnlyGetRefreshIntervalSecond()
   return refresh_interval_sec_;
 }
 
+FileWatcherSessionTicketKeyProvider::FileWatcherSessionTicketKeyProvider(
+    std::string session_ticket_key_path, int64_t refresh_interval_sec)
+    : session_ticket_key_path_(std::move(session_ticket_key_path)),
+      refresh_interval_sec_(refresh_interval_sec),
+      key_ring_(MakeRefCounted<tsi::SslSessionTicketKeyRing>()) {
+  if (refresh_interval_sec_ < kMinimumFileWatcherRefreshIntervalSeconds) {
+    gpr_log(GPR_INFO,
+            "FileWatcherSessionTicketKeyProvider refresh_interval_sec_ set to "
+            "value less than minimum. Overriding configured value to minimum.");
+    refresh_interval_sec_ = kMinimumFileWatcherRefreshIntervalSeconds;
+  }
+  CHECK(!session_ticket_key_path_.empty());
+  gpr_event_init(&shutdown_event_);
+  ForceUpdate();
+  auto thread_lambda = [](void* arg) {
+    FileWatcherSessionTicketKeyProvider* provider =
+        static_cast<FileWatcherSessionTicketKeyProvider*>(arg);
+    CHECK_NE(provider, nullptr);
+    while (true) {
+      void* value = gpr_event_wait(
+          &provider->shutdown_event_,
+          TimeoutSecondsToDeadline(provider->refresh_interval_sec_));
+      if (value != nullptr) {
+        return;
+      }
+      provider->ForceUpdate();
+    }
+  };
+  refresh_thread_ =
+      Thread("FileWatcherSessionTicketKeyProvider_refreshing_thread",
+             thread_lambda, this);
+  refresh_thread_.Start();
+}
+
+FileWatcherSessionTicketKeyProvider::~FileWatcherSessionTicketKeyProvider() {
+  gpr_event_set(&shutdown_event_, reinterpret_cast<void*>(1));
+  refresh_thread_.Join();
+}
+
+void FileWatcherSessionTicketKeyProvider::ForceUpdate() {
+  auto keys_slice =
+      LoadFile(session_ticket_key_path_, /*add_null_terminator=*/false);
+  if (!keys_slice.ok()) {
+    gpr_log(GPR_ERROR, "Reading file %s failed: %s",
+            session_ticket_key_path_.c_str(),
+            keys_slice.status().ToString().c_str());
+    return;
+  }
+  absl::string_view keys = keys_slice->as_string_view();
+  if (keys == session_ticket_keys_) return;
+  absl::Status status = key_ring_->SetKeys(keys);
+  if (!status.ok()) {
+    gpr_log(GPR_ERROR, "Loading session ticket keys from %s failed: %s",
+            session_ticket_key_path_.c_str(), status.ToString().c_str());
+    return;
+  }
+  session_ticket_keys_ = std::string(keys);
+}
+
 }  // namespace grpc_core
 
 /// -- Wrapper APIs declared in grpc_security.h -- *
@@ -194,6 +194,42 @@ class FileWatcherCertificateProvider final
   std::map<std::string, WatcherInfo> watcher_info_ ABSL_GUARDED_BY(mu_);
 };
 
+// Keeps the session ticket keys of TLS servers in sync with a file, so that
+// the replicas of a server that are given the same file can resume each
+// other's TLS sessions. The file holds one or more keys of
+// tsi::kSslSessionTicketKeySize bytes back to back; the first one encrypts new
+// tickets, and all of them decrypt tickets (see tsi::SslSessionTicketKeyRing).
+// Like FileWatcherCertificateProvider, it re-reads the file every
+// refresh_interval_sec seconds. Keys are rotated by replacing the file
+// atomically (e.g. by renaming a new file over it). Reading a file that does
+// not hold valid keys leaves the keys unchanged.
+class FileWatcherSessionTicketKeyProvider final
+    : public RefCounted<FileWatcherSessionTicketKeyProvider> {
+ public:
+  FileWatcherSessionTicketKeyProvider(std::string session_ticket_key_path,
+                                      int64_t refresh_interval_sec);
+
+  ~FileWatcherSessionTicketKeyProvider() override;
+
+  tsi::SslSessionTicketKeyRing* key_ring() const { return key_ring_.get(); }
+
+ private:
+  // Force an update from the file system regardless of the interval.
+  void ForceUpdate();
+
+  // Information that is used by the refreshing thread.
+  std::string session_ticket_key_path_;
+  int64_t refresh_interval_sec_ = 0;
+
+  RefCountedPtr<tsi::SslSessionTicketKeyRing> key_ring_;
+  Thread refresh_thread_;
+  gpr_event shutdown_event_;
+
+  // The contents of the file the keys were last loaded from. Only used by the
+  // refreshing thread, and by the constructor before it starts.
+  std::string session_ticket_keys_;
+};
+
 //  Checks if the private key matches the certificate's public key.
 //  Returns a not-OK status on failure, or a bool indicating
 //  whether the key/cert pair matches.
@@ -144,6 +144,16 @@ void grpc_tls_credentials_options_set_send_client_ca_list(
   options->set_send_client_ca_list(send_client_ca_list);
 }
 
+void grpc_tls_credentials_options_set_session_ticket_key_file(
+    grpc_tls_credentials_options* options, const char* path,
+    unsigned int refresh_interval_sec) {
+  CHECK_NE(options, nullptr);
+  CHECK_NE(path, nullptr);
+  options->set_session_ticket_key_provider(
+      grpc_core::MakeRefCounted<grpc_core::FileWatcherSessionTicketKeyProvider>(
+          path, refresh_interval_sec));
+}
+
 void grpc_tls_credentials_options_set_crl_provider(
     grpc_tls_credentials_options* options,
     std::shared_ptr<grpc_core::experimental::CrlProvider> provider) {
@@ -66,6 +66,11 @@ struct grpc_tls_credentials_options
   // Returns the CRL Provider
   std::shared_ptr<grpc_core::experimental::CrlProvider> crl_provider() const { return crl_provider_; }
   bool send_client_ca_list() const { return send_client_ca_list_; }
+  // Returns the key ring of session_ticket_key_provider_ if it is set, nullptr otherwise.
+  tsi::SslSessionTicketKeyRing* session_ticket_key_ring() {
+    if (session_ticket_key_provider_ != nullptr) { return session_ticket_key_provider_->key_ring(); }
+    return nullptr;
+  }
 
   // Setters for member fields.
   void set_cert_request_type(grpc_ssl_client_certificate_request_type cert_request_type) { cert_request_type_ = cert_request_type; }
@@ -88,6 +93,8 @@ struct grpc_tls_credentials_options
   void set_crl_directory(std::string crl_directory) { crl_directory_ = std::move(crl_directory); }
   void set_crl_provider(std::shared_ptr<grpc_core::experimental::CrlProvider> crl_provider) { crl_provider_ = std::move(crl_provider); }
   void set_send_client_ca_list(bool send_client_ca_list) { send_client_ca_list_ = send_client_ca_list; }
+  // Keeps the session ticket keys of a TLS server in sync with a file, so that all the servers given the same file can resume each other's sessions. If not set, each server uses its own random key.
+  void set_session_ticket_key_provider(grpc_core::RefCountedPtr<grpc_core::FileWatcherSessionTicketKeyProvider> session_ticket_key_provider) { session_ticket_key_provider_ = std::move(session_ticket_key_provider); }
 
   bool operator==(const grpc_tls_credentials_options& other) const {
     return cert_request_type_ == other.cert_request_type_ &&
@@ -104,7 +111,8 @@ struct grpc_tls_credentials_options
       tls_session_key_log_file_path_ == other.tls_session_key_log_file_path_ &&
       crl_directory_ == other.crl_directory_ &&
       (crl_provider_ == other.crl_provider_) &&
-      send_client_ca_list_ == other.send_client_ca_list_;
+      send_client_ca_list_ == other.send_client_ca_list_ &&
+      (session_ticket_key_provider_ == other.session_ticket_key_provider_);
   }
 
   grpc_tls_credentials_options(grpc_tls_credentials_options& other) :
@@ -122,7 +130,8 @@ struct grpc_tls_credentials_options
       tls_session_key_log_file_path_(other.tls_session_key_log_file_path_),
       crl_directory_(other.crl_directory_),
       crl_provider_(other.crl_provider_),
-      send_client_ca_list_(other.send_client_ca_list_)  {}
+      send_client_ca_list_(other.send_client_ca_list_),
+      session_ticket_key_provider_(other.session_ticket_key_provider_)  {}
 
  private:
   grpc_ssl_client_certificate_request_type cert_request_type_ = GRPC_SSL_DONT_REQUEST_CLIENT_CERTIFICATE;
@@ -140,6 +149,7 @@ struct grpc_tls_credentials_options
   std::string crl_directory_;
   std::shared_ptr<grpc_core::experimental::CrlProvider> crl_provider_;
   bool send_client_ca_list_ = false;
+  grpc_core::RefCountedPtr<grpc_core::FileWatcherSessionTicketKeyProvider> session_ticket_key_provider_;
 };
 
 #endif  // GRPC_SRC_CORE_LIB_SECURITY_CREDENTIALS_TLS_GRPC_TLS_CREDENTIALS_OPTIONS_H
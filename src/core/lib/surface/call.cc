@@ -367,22 +367,37 @@ void Call::UpdateDeadline(Timestamp deadline) {
         StatusIntProperty::kRpcStatus, GRPC_STATUS_DEADLINE_EXCEEDED));
     return;
   }
-  auto* const event_engine = channel()->event_engine();
   if (deadline_ != Timestamp::InfFuture()) {
-    if (!event_engine->Cancel(deadline_task_)) return;
+    if (!CancelDeadlineTimer()) return;
   } else {
     InternalRef("deadline");
   }
   deadline_ = deadline;
-  deadline_task_ = event_engine->RunAfter(deadline - Timestamp::Now(), this);
+  // Nearly every deadline timer is cancelled when the call completes; the
+  // channel's coarse timer queue (if any) makes that cancellation cheap.
+  auto* const deadline_timers = channel()->deadline_timers();
+  if (deadline_timers != nullptr) {
+    deadline_task_ =
+        deadline_timers->RunAfter(deadline - Timestamp::Now(), this);
+  } else {
+    deadline_task_ =
+        channel()->event_engine()->RunAfter(deadline - Timestamp::Now(), this);
+  }
+}
+
+bool Call::CancelDeadlineTimer() {
+  auto* const deadline_timers = channel()->deadline_timers();
+  if (deadline_timers != nullptr) {
+    return deadline_timers->Cancel(deadline_task_);
+  }
+  return channel()->event_engine()->Cancel(deadline_task_);
 }
 
 void Call::ResetDeadline() {
   {
     MutexLock lock(&deadline_mu_);
     if (deadline_ == Timestamp::InfFuture()) return;
-    auto* const event_engine = channel()->event_engine();
-    if (!event_engine->Cancel(deadline_task_)) return;
+    if (!CancelDeadlineTimer()) return;
     deadline_ = Timestamp::InfFuture();
   }
   InternalUnref("deadline[reset]");
@@ -2640,7 +2655,7 @@ class ClientPromiseBasedCall final : public PromiseBasedCall {
             Finish(std::move(md));
             return Empty{};
           },
-          [](Empty) {});
+          [](Empty) {}, PartyPriority::kUrgent);
     } else {
       Spawn(
           "cancel_with_error",
@@ -2652,7 +2667,7 @@ class ClientPromiseBasedCall final : public PromiseBasedCall {
             }
             return Empty{};
           },
-          [](Empty) {});
+          [](Empty) {}, PartyPriority::kUrgent);
     }
   }
   absl::string_view GetServerAuthority() const override { abort(); }
@@ -2733,6 +2748,14 @@ class ClientPromiseBasedCall final : public PromiseBasedCall {
 
       void V2HackToStartCallWithoutACallFilterStack() override {}
 
+      grpc_event_engine::experimental::EventEngine* event_engine()
+          const override {
+        return call_->event_engine();
+      }
+      grpc_call_context_element* legacy_context() override {
+        return call_->context();
+      }
+
      private:
       RefCount refs_;
       ClientPromiseBasedCall* const call_;
@@ -3518,7 +3541,7 @@ void ServerPromiseBasedCall::CancelWithError(absl::Status error) {
         }
         return Empty{};
       },
-      [](Empty) {});
+      [](Empty) {}, PartyPriority::kUrgent);
 }
 #endif
 
@@ -3586,6 +3609,10 @@ class ServerCallSpine final : public PipeBasedCallSpine,
   Arena* arena() override { return BasicPromiseBasedCall::arena(); }
   void IncrementRefCount() override { InternalRef("CallSpine"); }
   void Unref() override { InternalUnref("CallSpine"); }
+  grpc_event_engine::experimental::EventEngine* event_engine() const override {
+    return BasicPromiseBasedCall::event_engine();
+  }
+  grpc_call_context_element* legacy_context() override { return context(); }
 
   // PromiseBasedCall
   void OrphanCall() override {
@@ -3593,12 +3620,15 @@ class ServerCallSpine final : public PipeBasedCallSpine,
     CancelWithError(absl::CancelledError());
   }
   void CancelWithError(grpc_error_handle error) override {
-    SpawnInfallible("CancelWithError", [this, error = std::move(error)] {
-      auto status = ServerMetadataFromStatus(error);
-      status->Set(GrpcCallWasCancelled(), true);
-      PushServerTrailingMetadata(std::move(status));
-      return Empty{};
-    });
+    SpawnInfallible(
+        "CancelWithError",
+        [this, error = std::move(error)] {
+          auto status = ServerMetadataFromStatus(error);
+          status->Set(GrpcCallWasCancelled(), true);
+          PushServerTrailingMetadata(std::move(status));
+          return Empty{};
+        },
+        PartyPriority::kUrgent);
   }
   bool is_trailers_only() const override {
     Crash("is_trailers_only not implemented for server calls");
@@ -222,6 +222,9 @@ class Call : public CppImplOf<Call, grpc_call>,
   gpr_cycle_counter start_time() const { return start_time_; }
 
  private:
+  // Cancels deadline_task_ on whichever queue it was armed on.
+  bool CancelDeadlineTimer() ABSL_EXCLUSIVE_LOCKS_REQUIRED(deadline_mu_);
+
   RefCountedPtr<Channel> channel_;
   Arena* const arena_;
   std::atomic<ParentCall*> parent_call_{nullptr};
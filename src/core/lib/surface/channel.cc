@@ -16,6 +16,9 @@
 
 #include "src/core/lib/surface/channel.h"
 
+#include <memory>
+#include <utility>
+
 #include "absl/log/check.h"
 
 #include <grpc/compression.h>
@@ -32,6 +35,7 @@
 #include "src/core/lib/debug/stats.h"
 #include "src/core/lib/debug/stats_data.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/surface/api_trace.h"
 
@@ -62,10 +66,25 @@ Channel::RegisteredCall::~RegisteredCall() {}
 // Channel
 //
 
+namespace {
+
+RefCountedPtr<grpc_event_engine::experimental::CoarseTimerQueue>
+DeadlineTimersFromChannelArgs(const ChannelArgs& channel_args) {
+  if (!IsCoarseDeadlineTimersEnabled()) return nullptr;
+  auto event_engine =
+      channel_args.GetObjectRef<grpc_event_engine::experimental::EventEngine>();
+  if (event_engine == nullptr) return nullptr;
+  return grpc_event_engine::experimental::CoarseTimerQueue::Get(
+      std::move(event_engine));
+}
+
+}  // namespace
+
 Channel::Channel(std::string target, const ChannelArgs& channel_args)
     : target_(std::move(target)),
       channelz_node_(channel_args.GetObjectRef<channelz::ChannelNode>()),
-      compression_options_(CompressionOptionsFromChannelArgs(channel_args)) {}
+      compression_options_(CompressionOptionsFromChannelArgs(channel_args)),
+      deadline_timers_(DeadlineTimersFromChannelArgs(channel_args)) {}
 
 Channel::RegisteredCall* Channel::RegisterCall(const char* method,
                                                const char* host) {
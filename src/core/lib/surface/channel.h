@@ -33,6 +33,7 @@
 
 #include "src/core/channelz/channelz.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/coarse_timer_queue.h"
 #include "src/core/lib/gprpp/cpp_impl_of.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
@@ -84,6 +85,12 @@ class Channel : public RefCounted<Channel>,
   virtual grpc_event_engine::experimental::EventEngine* event_engine()
       const = 0;
 
+  // Timer queue for call deadlines, or null if deadlines should be armed
+  // directly on event_engine().
+  grpc_event_engine::experimental::CoarseTimerQueue* deadline_timers() const {
+    return deadline_timers_.get();
+  }
+
   virtual bool SupportsConnectivityWatcher() const = 0;
 
   virtual grpc_connectivity_state CheckConnectivityState(
@@ -136,6 +143,8 @@ class Channel : public RefCounted<Channel>,
   const std::string target_;
   const RefCountedPtr<channelz::ChannelNode> channelz_node_;
   const grpc_compression_options compression_options_;
+  const RefCountedPtr<grpc_event_engine::experimental::CoarseTimerQueue>
+      deadline_timers_;
 
   Mutex mu_;
   // The map key needs to be owned strings rather than unowned char*'s to
@@ -0,0 +1,56 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/transport/call_destination.h"
+
+#include <utility>
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/promise/map.h"
+#include "src/core/lib/promise/status_flag.h"
+
+namespace grpc_core {
+
+void ForwardingCallDestination::HandleCall(CallHandler call_handler) {
+  call_handler.SpawnGuarded("forward_call", [call_handler,
+                                             destination =
+                                                 destination_]() mutable {
+    return Map(
+        call_handler.PullClientInitialMetadata(),
+        [call_handler, destination = std::move(destination)](
+            ValueOrFailure<ClientMetadataHandle> md) mutable -> StatusFlag {
+          if (!md.ok()) return Failure{};
+          // The outgoing call lives on the arena of the incoming one, and
+          // shares its EventEngine and context, as a hijacked call does: the
+          // promises forwarding the call hold a ref to the incoming call, and
+          // so to its arena.
+          auto call = MakeCallPair(std::move(*md), call_handler.event_engine(),
+                                   call_handler.arena(), nullptr,
+                                   call_handler.legacy_context());
+          call.handler.SpawnInfallible(
+              "start_call", [destination = std::move(destination),
+                             handler = call.handler]() mutable {
+                destination->StartCall(std::move(handler));
+                return Empty{};
+              });
+          ForwardCall(std::move(call_handler), std::move(call.initiator));
+          return Success{};
+        });
+  });
+}
+
+void ForwardingCallDestination::Orphaned() { destination_.reset(); }
+
+}  // namespace grpc_core
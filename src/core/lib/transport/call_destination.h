@@ -15,9 +15,12 @@
 #ifndef GRPC_SRC_CORE_LIB_TRANSPORT_CALL_DESTINATION_H
 #define GRPC_SRC_CORE_LIB_TRANSPORT_CALL_DESTINATION_H
 
+#include <utility>
+
 #include <grpc/support/port_platform.h>
 
 #include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/transport/call_spine.h"
 
 namespace grpc_core {
@@ -51,6 +54,30 @@ class CallDestination : public DualRefCounted<CallDestination> {
   virtual void HandleCall(CallHandler unstarted_call_handler) = 0;
 };
 
+// ForwardingCallDestination splices each call it handles onto a new call
+// started on an UnstartedCallDestination (eg a channel to a backend), without
+// surfacing the call to the application.
+//
+// The outgoing call is allocated on the arena of the incoming call, and the
+// messages are moved from one call to the other as they are: their payloads
+// are never copied nor reserialized. A message is only pulled from one side
+// once the previous one has been pushed into the other, so a slow reader on
+// either side applies backpressure to the writer on the other one (see
+// ForwardCall). The filters of both calls still see the metadata and the
+// messages that go through.
+class ForwardingCallDestination final : public CallDestination {
+ public:
+  explicit ForwardingCallDestination(
+      RefCountedPtr<UnstartedCallDestination> destination)
+      : destination_(std::move(destination)) {}
+
+  void HandleCall(CallHandler call_handler) override;
+  void Orphaned() override;
+
+ private:
+  RefCountedPtr<UnstartedCallDestination> destination_;
+};
+
 }  // namespace grpc_core
 
 #endif  // GRPC_SRC_CORE_LIB_TRANSPORT_CALL_DESTINATION_H
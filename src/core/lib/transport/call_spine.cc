@@ -34,7 +34,8 @@ void ForwardCall(CallHandler call_handler, CallInitiator call_initiator) {
                              [msg = std::move(msg), call_initiator]() mutable {
                                return call_initiator.CancelIfFails(
                                    call_initiator.PushMessage(std::move(msg)));
-                             });
+                             },
+                             PartyPriority::kBulk);
                        }),
                [call_initiator](StatusFlag result) mutable {
                  if (result.ok()) {
@@ -76,7 +77,8 @@ void ForwardCall(CallHandler call_handler, CallInitiator call_initiator) {
                                 [msg = std::move(msg), call_handler]() mutable {
                                   return call_handler.CancelIfFails(
                                       call_handler.PushMessage(std::move(msg)));
-                                });
+                                },
+                                PartyPriority::kBulk);
                           }),
                   []() -> StatusFlag { return Success{}; });
             })),
@@ -84,6 +84,11 @@ class CallSpineInterface {
   virtual Promise<bool> WasCancelled() = 0;
   virtual ClientMetadata& UnprocessedClientInitialMetadata() = 0;
   virtual void V2HackToStartCallWithoutACallFilterStack() = 0;
+  // The EventEngine and the legacy context of the call, for the calls that
+  // are started on its behalf (eg when it is forwarded).
+  virtual grpc_event_engine::experimental::EventEngine* event_engine()
+      const = 0;
+  virtual grpc_call_context_element* legacy_context() = 0;
 
   // Wrap a promise so that if it returns failure it automatically cancels
   // the rest of the call.
@@ -104,8 +109,9 @@ class CallSpineInterface {
   // Spawn a promise that returns Empty{} and save some boilerplate handling
   // that detail.
   template <typename PromiseFactory>
-  void SpawnInfallible(absl::string_view name, PromiseFactory promise_factory) {
-    party().Spawn(name, std::move(promise_factory), [](Empty) {});
+  void SpawnInfallible(absl::string_view name, PromiseFactory promise_factory,
+                       PartyPriority priority = PartyPriority::kNormal) {
+    party().Spawn(name, std::move(promise_factory), [](Empty) {}, priority);
   }
 
   // Spawn a promise that returns some status-like type; if the status
@@ -350,7 +356,9 @@ class CallSpine final : public CallSpineInterface, public Party {
     return legacy_context_[index];
   }
 
-  grpc_call_context_element* legacy_context() { return legacy_context_; }
+  grpc_call_context_element* legacy_context() override {
+    return legacy_context_;
+  }
 
   grpc_event_engine::experimental::EventEngine* event_engine() const override {
     return event_engine_;
@@ -473,13 +481,16 @@ class CallInitiator {
   }
 
   template <typename PromiseFactory>
-  void SpawnInfallible(absl::string_view name, PromiseFactory promise_factory) {
-    spine_->SpawnInfallible(name, std::move(promise_factory));
+  void SpawnInfallible(absl::string_view name, PromiseFactory promise_factory,
+                       PartyPriority priority = PartyPriority::kNormal) {
+    spine_->SpawnInfallible(name, std::move(promise_factory), priority);
   }
 
   template <typename PromiseFactory>
-  auto SpawnWaitable(absl::string_view name, PromiseFactory promise_factory) {
-    return spine_->party().SpawnWaitable(name, std::move(promise_factory));
+  auto SpawnWaitable(absl::string_view name, PromiseFactory promise_factory,
+                     PartyPriority priority = PartyPriority::kNormal) {
+    return spine_->party().SpawnWaitable(name, std::move(promise_factory),
+                                         priority);
   }
 
   Arena* arena() { return spine_->arena(); }
@@ -525,24 +536,27 @@ class CallHandler {
   }
 
   template <typename PromiseFactory>
-  void SpawnInfallible(absl::string_view name, PromiseFactory promise_factory) {
-    spine_->SpawnInfallible(name, std::move(promise_factory));
+  void SpawnInfallible(absl::string_view name, PromiseFactory promise_factory,
+                       PartyPriority priority = PartyPriority::kNormal) {
+    spine_->SpawnInfallible(name, std::move(promise_factory), priority);
   }
 
   template <typename PromiseFactory>
-  auto SpawnWaitable(absl::string_view name, PromiseFactory promise_factory) {
-    return spine_->party().SpawnWaitable(name, std::move(promise_factory));
+  auto SpawnWaitable(absl::string_view name, PromiseFactory promise_factory,
+                     PartyPriority priority = PartyPriority::kNormal) {
+    return spine_->party().SpawnWaitable(name, std::move(promise_factory),
+                                         priority);
   }
 
   Arena* arena() { return spine_->arena(); }
 
   grpc_event_engine::experimental::EventEngine* event_engine() {
-    return DownCast<CallSpine*>(spine_.get())->event_engine();
+    return spine_->event_engine();
   }
 
   // TODO(ctiller): re-evaluate this API
   grpc_call_context_element* legacy_context() {
-    return DownCast<CallSpine*>(spine_.get())->legacy_context();
+    return spine_->legacy_context();
   }
 
  private:
@@ -572,13 +586,16 @@ class UnstartedCallHandler {
   }
 
   template <typename PromiseFactory>
-  void SpawnInfallible(absl::string_view name, PromiseFactory promise_factory) {
-    spine_->SpawnInfallible(name, std::move(promise_factory));
+  void SpawnInfallible(absl::string_view name, PromiseFactory promise_factory,
+                       PartyPriority priority = PartyPriority::kNormal) {
+    spine_->SpawnInfallible(name, std::move(promise_factory), priority);
   }
 
   template <typename PromiseFactory>
-  auto SpawnWaitable(absl::string_view name, PromiseFactory promise_factory) {
-    return spine_->party().SpawnWaitable(name, std::move(promise_factory));
+  auto SpawnWaitable(absl::string_view name, PromiseFactory promise_factory,
+                     PartyPriority priority = PartyPriority::kNormal) {
+    return spine_->party().SpawnWaitable(name, std::move(promise_factory),
+                                         priority);
   }
 
   ClientMetadata& UnprocessedClientInitialMetadata() {
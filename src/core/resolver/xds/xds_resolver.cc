@@ -26,6 +26,7 @@
 #include <utility>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/log/check.h"
 #include "absl/meta/type_traits.h"
 #include "absl/random/random.h"
@@ -70,6 +71,7 @@
 #include "src/core/lib/gprpp/xxhash_inline.h"
 #include "src/core/lib/iomgr/iomgr_fwd.h"
 #include "src/core/lib/iomgr/pollset_set.h"
+#include "src/core/lib/matchers/matchers.h"
 #include "src/core/lib/promise/arena_promise.h"
 #include "src/core/lib/promise/context.h"
 #include "src/core/lib/resource_quota/arena.h"
@@ -264,6 +266,14 @@ class XdsResolver final : public Resolver {
 
     std::map<absl::string_view, RefCountedPtr<ClusterRef>> clusters_;
     std::vector<RouteEntry> routes_;
+    // Built in Create() and never modified afterwards, so calls look up
+    // their route without taking a lock.
+    XdsRouting::RouteIndex route_index_;
+    // Route of each path named by a case-sensitive exact path matcher, for
+    // the paths whose route does not depend on anything but the path,
+    // so that the calls to those methods skip route_index_. Built in
+    // Create() like route_index_. The keys point into routes_.
+    absl::flat_hash_map<absl::string_view, RouteEntry*> routes_by_path_;
   };
 
   class XdsConfigSelector final : public ConfigSelector {
@@ -287,10 +297,15 @@ class XdsResolver final : public Resolver {
       return filters_;
     }
 
+    bool IsFilterActive(const grpc_channel_filter* filter,
+                        const ServiceConfigCallData& call_config) override;
+
    private:
     RefCountedPtr<XdsResolver> resolver_;
     RefCountedPtr<RouteConfigData> route_config_data_;
     std::vector<const grpc_channel_filter*> filters_;
+    // The xDS HTTP filters that added a C-core filter to filters_.
+    std::vector<const XdsHttpFilterImpl*> filter_impls_;
   };
 
   class XdsRouteStateAttributeImpl final : public XdsRouteStateAttribute {
@@ -431,14 +446,31 @@ XdsResolver::RouteConfigData::Create(
       return status;
     }
   }
+  RouteListIterator route_list_iterator(data.get());
+  data->route_index_ = XdsRouting::RouteIndex(route_list_iterator);
+  for (const RouteEntry& entry : data->routes_) {
+    const StringMatcher& path_matcher = entry.route.matchers.path_matcher;
+    if (path_matcher.type() != StringMatcher::Type::kExact ||
+        !path_matcher.case_sensitive()) {
+      continue;
+    }
+    absl::optional<size_t> route_index = data->route_index_.GetRouteForPath(
+        route_list_iterator, path_matcher.string_matcher());
+    if (route_index.has_value()) {
+      data->routes_by_path_.emplace(path_matcher.string_matcher(),
+                                    &data->routes_[*route_index]);
+    }
+  }
   return data;
 }
 
 XdsResolver::RouteConfigData::RouteEntry*
 XdsResolver::RouteConfigData::GetRouteForRequest(
     absl::string_view path, grpc_metadata_batch* initial_metadata) {
-  auto route_index = XdsRouting::GetRouteForRequest(RouteListIterator(this),
-                                                    path, initial_metadata);
+  auto it = routes_by_path_.find(path);
+  if (it != routes_by_path_.end()) return it->second;
+  absl::optional<size_t> route_index = route_index_.GetRouteForRequest(
+      RouteListIterator(this), path, initial_metadata);
   if (!route_index.has_value()) {
     return nullptr;
   }
@@ -643,11 +675,23 @@ XdsResolver::XdsConfigSelector::XdsConfigSelector(
     // Add C-core filter to list.
     if (filter_impl->channel_filter() != nullptr) {
       filters_.push_back(filter_impl->channel_filter());
+      filter_impls_.push_back(filter_impl);
     }
   }
   filters_.push_back(&ClusterSelectionFilter::kFilter);
 }
 
+bool XdsResolver::XdsConfigSelector::IsFilterActive(
+    const grpc_channel_filter* filter,
+    const ServiceConfigCallData& call_config) {
+  for (const XdsHttpFilterImpl* filter_impl : filter_impls_) {
+    if (filter_impl->channel_filter() == filter) {
+      return filter_impl->IsActiveForCall(call_config);
+    }
+  }
+  return true;
+}
+
 XdsResolver::XdsConfigSelector::~XdsConfigSelector() {
   if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_resolver_trace)) {
     gpr_log(GPR_INFO, "[xds_resolver %p] destroying XdsConfigSelector %p",
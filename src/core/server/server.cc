@@ -33,6 +33,7 @@
 #include "absl/cleanup/cleanup.h"
 #include "absl/container/flat_hash_map.h"
 #include "absl/log/check.h"
+#include "absl/random/random.h"
 #include "absl/status/status.h"
 #include "absl/types/optional.h"
 
@@ -283,15 +284,70 @@ struct Server::RequestedCall {
   } data;
 };
 
+// The incoming calls of a RealRequestMatcher that are waiting for the
+// application to request them, sharded by the index of the completion queue
+// that their channel starts matching at. Each shard has its own lock, so that
+// the calls of the different methods and of the different completion queues
+// do not contend on a single lock.
+template <typename PendingCall>
+class PendingCallShards {
+ public:
+  struct alignas(GPR_CACHELINE_SIZE) Shard {
+    Mutex mu;
+    std::queue<PendingCall> calls ABSL_GUARDED_BY(mu);
+    absl::BitGen bitgen ABSL_GUARDED_BY(mu);
+  };
+
+  explicit PendingCallShards(size_t shard_count)
+      : shards_(std::max<size_t>(1, shard_count)) {}
+
+  size_t size() const { return shards_.size(); }
+  Shard& operator[](size_t index) { return shards_[index % shards_.size()]; }
+
+  // The number of pending calls in all the shards.
+  size_t count() const { return count_.load(std::memory_order_relaxed); }
+
+  void Push(Shard& shard, PendingCall call)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard.mu) {
+    shard.calls.push(std::move(call));
+    count_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  PendingCall Pop(Shard& shard) ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard.mu) {
+    PendingCall call = std::move(shard.calls.front());
+    shard.calls.pop();
+    count_.fetch_sub(1, std::memory_order_relaxed);
+    return call;
+  }
+
+  bool empty() const { return count() == 0; }
+
+ private:
+  std::vector<Shard> shards_;
+  std::atomic<size_t> count_{0};
+};
+
 // The RealRequestMatcher is an implementation of RequestMatcherInterface that
 // actually uses all the features of RequestMatcherInterface: expecting the
 // application to explicitly request RPCs and then matching those to incoming
 // RPCs, along with a slow path by which incoming RPCs are put on a locked
 // pending list if they aren't able to be matched to an application request.
+//
+// The pending list is sharded per completion queue (see PendingCallShards).
+// An incoming RPC that finds no request is queued on the shard of the
+// completion queue its channel starts matching at, after checking every
+// request queue under the lock of that shard. A request that arrives on an
+// empty request queue matches the RPCs of the shard of its completion queue
+// first, then steals the RPCs of the other shards, taking the lock of each
+// shard in turn: since the RPC queued on a shard checked the request queues
+// under the lock of that shard, either it saw the request, or the request
+// sees it.
 class Server::RealRequestMatcherFilterStack : public RequestMatcherInterface {
  public:
   explicit RealRequestMatcherFilterStack(Server* server)
-      : server_(server), requests_per_cq_(server->cqs_.size()) {}
+      : server_(server),
+        pending_(server->cqs_.size()),
+        requests_per_cq_(server->cqs_.size()) {}
 
   ~RealRequestMatcherFilterStack() override {
     for (LockedMultiProducerSingleConsumerQueue& queue : requests_per_cq_) {
@@ -301,10 +357,14 @@ class Server::RealRequestMatcherFilterStack : public RequestMatcherInterface {
   }
 
   void ZombifyPending() override {
-    while (!pending_.empty()) {
-      pending_.front().calld->SetState(CallData::CallState::ZOMBIED);
-      pending_.front().calld->KillZombie();
-      pending_.pop();
+    for (size_t i = 0; i < pending_.size(); i++) {
+      auto& shard = pending_[i];
+      MutexLock lock(&shard.mu);
+      while (!shard.calls.empty()) {
+        CallData* calld = pending_.Pop(shard).calld;
+        calld->SetState(CallData::CallState::ZOMBIED);
+        calld->KillZombie();
+      }
     }
   }
 
@@ -326,31 +386,39 @@ class Server::RealRequestMatcherFilterStack : public RequestMatcherInterface {
                                       RequestedCall* call) override {
     if (requests_per_cq_[request_queue_index].Push(&call->mpscq_node)) {
       // this was the first queued request: we need to lock and start
-      // matching calls
+      // matching calls, from the shard of this cq and then from the others
       struct NextPendingCall {
         RequestedCall* rc = nullptr;
         CallData* pending;
       };
-      while (true) {
+      size_t shard_index = request_queue_index;
+      size_t empty_shards = 0;
+      while (empty_shards < pending_.size()) {
         NextPendingCall pending_call;
         {
-          MutexLock lock(&server_->mu_call_);
-          while (!pending_.empty() &&
-                 pending_.front().Age() > server_->max_time_in_pending_queue_) {
-            pending_.front().calld->SetState(CallData::CallState::ZOMBIED);
-            pending_.front().calld->KillZombie();
-            pending_.pop();
+          auto& shard = pending_[shard_index];
+          MutexLock lock(&shard.mu);
+          while (!shard.calls.empty() &&
+                 shard.calls.front().Age() >
+                     server_->max_time_in_pending_queue_) {
+            CallData* calld = pending_.Pop(shard).calld;
+            calld->SetState(CallData::CallState::ZOMBIED);
+            calld->KillZombie();
           }
-          if (!pending_.empty()) {
+          if (!shard.calls.empty()) {
             pending_call.rc = reinterpret_cast<RequestedCall*>(
                 requests_per_cq_[request_queue_index].Pop());
-            if (pending_call.rc != nullptr) {
-              pending_call.pending = pending_.front().calld;
-              pending_.pop();
-            }
+            // All the requests were matched.
+            if (pending_call.rc == nullptr) return;
+            pending_call.pending = pending_.Pop(shard).calld;
           }
         }
-        if (pending_call.rc == nullptr) break;
+        if (pending_call.rc == nullptr) {
+          ++empty_shards;
+          shard_index = (shard_index + 1) % pending_.size();
+          continue;
+        }
+        empty_shards = 0;
         if (!pending_call.pending->MaybeActivate()) {
           // Zombied Call
           pending_call.pending->KillZombie();
@@ -377,14 +445,15 @@ class Server::RealRequestMatcherFilterStack : public RequestMatcherInterface {
     }
     // No cq to take the request found; queue it on the slow list.
     // We need to ensure that all the queues are empty.  We do this under
-    // the server mu_call_ lock to ensure that if something is added to
+    // the lock of the pending shard to ensure that if something is added to
     // an empty request queue, it will block until the call is actually
     // added to the pending list.
     RequestedCall* rc = nullptr;
     size_t cq_idx = 0;
     size_t loop_count;
     {
-      MutexLock lock(&server_->mu_call_);
+      auto& shard = pending_[start_request_queue_index];
+      MutexLock lock(&shard.mu);
       for (loop_count = 0; loop_count < requests_per_cq_.size(); loop_count++) {
         cq_idx =
             (start_request_queue_index + loop_count) % requests_per_cq_.size();
@@ -395,7 +464,7 @@ class Server::RealRequestMatcherFilterStack : public RequestMatcherInterface {
       }
       if (rc == nullptr) {
         calld->SetState(CallData::CallState::PENDING);
-        pending_.push(PendingCall{calld});
+        pending_.Push(shard, PendingCall{calld});
         return;
       }
     }
@@ -416,14 +485,16 @@ class Server::RealRequestMatcherFilterStack : public RequestMatcherInterface {
     Timestamp created = Timestamp::Now();
     Duration Age() { return Timestamp::Now() - created; }
   };
-  std::queue<PendingCall> pending_;
+  PendingCallShards<PendingCall> pending_;
   std::vector<LockedMultiProducerSingleConsumerQueue> requests_per_cq_;
 };
 
 class Server::RealRequestMatcherPromises : public RequestMatcherInterface {
  public:
   explicit RealRequestMatcherPromises(Server* server)
-      : server_(server), requests_per_cq_(server->cqs_.size()) {}
+      : server_(server),
+        pending_(server->cqs_.size()),
+        requests_per_cq_(server->cqs_.size()) {}
 
   ~RealRequestMatcherPromises() override {
     for (LockedMultiProducerSingleConsumerQueue& queue : requests_per_cq_) {
@@ -432,9 +503,12 @@ class Server::RealRequestMatcherPromises : public RequestMatcherInterface {
   }
 
   void ZombifyPending() override {
-    while (!pending_.empty()) {
-      pending_.front()->Finish(absl::InternalError("Server closed"));
-      pending_.pop();
+    for (size_t i = 0; i < pending_.size(); i++) {
+      auto& shard = pending_[i];
+      MutexLock lock(&shard.mu);
+      while (!shard.calls.empty()) {
+        pending_.Pop(shard)->Finish(absl::InternalError("Server closed"));
+      }
     }
   }
 
@@ -456,25 +530,32 @@ class Server::RealRequestMatcherPromises : public RequestMatcherInterface {
                                       RequestedCall* call) override {
     if (requests_per_cq_[request_queue_index].Push(&call->mpscq_node)) {
       // this was the first queued request: we need to lock and start
-      // matching calls
+      // matching calls, from the shard of this cq and then from the others
       struct NextPendingCall {
         RequestedCall* rc = nullptr;
         PendingCall pending;
       };
-      while (true) {
+      size_t shard_index = request_queue_index;
+      size_t empty_shards = 0;
+      while (empty_shards < pending_.size()) {
         NextPendingCall pending_call;
         {
-          MutexLock lock(&server_->mu_call_);
-          if (!pending_.empty()) {
+          auto& shard = pending_[shard_index];
+          MutexLock lock(&shard.mu);
+          if (!shard.calls.empty()) {
             pending_call.rc = reinterpret_cast<RequestedCall*>(
                 requests_per_cq_[request_queue_index].Pop());
-            if (pending_call.rc != nullptr) {
-              pending_call.pending = std::move(pending_.front());
-              pending_.pop();
-            }
+            // All the requests were matched.
+            if (pending_call.rc == nullptr) return;
+            pending_call.pending = pending_.Pop(shard);
           }
         }
-        if (pending_call.rc == nullptr) break;
+        if (pending_call.rc == nullptr) {
+          ++empty_shards;
+          shard_index = (shard_index + 1) % pending_.size();
+          continue;
+        }
+        empty_shards = 0;
         if (!pending_call.pending->Finish(server(), request_queue_index,
                                           pending_call.rc)) {
           requests_per_cq_[request_queue_index].Push(
@@ -500,7 +581,7 @@ class Server::RealRequestMatcherPromises : public RequestMatcherInterface {
     }
     // No cq to take the request found; queue it on the slow list.
     // We need to ensure that all the queues are empty.  We do this under
-    // the server mu_call_ lock to ensure that if something is added to
+    // the lock of the pending shard to ensure that if something is added to
     // an empty request queue, it will block until the call is actually
     // added to the pending list.
     RequestedCall* rc = nullptr;
@@ -508,11 +589,11 @@ class Server::RealRequestMatcherPromises : public RequestMatcherInterface {
     size_t loop_count;
     {
       std::vector<std::shared_ptr<ActivityWaiter>> removed_pending;
-      MutexLock lock(&server_->mu_call_);
-      while (!pending_.empty() &&
-             pending_.front()->Age() > server_->max_time_in_pending_queue_) {
-        removed_pending.push_back(std::move(pending_.front()));
-        pending_.pop();
+      auto& shard = pending_[start_request_queue_index];
+      MutexLock lock(&shard.mu);
+      while (!shard.calls.empty() && shard.calls.front()->Age() >
+                                         server_->max_time_in_pending_queue_) {
+        removed_pending.push_back(pending_.Pop(shard));
       }
       for (loop_count = 0; loop_count < requests_per_cq_.size(); loop_count++) {
         cq_idx =
@@ -521,14 +602,14 @@ class Server::RealRequestMatcherPromises : public RequestMatcherInterface {
         if (rc != nullptr) break;
       }
       if (rc == nullptr) {
-        if (server_->pending_backlog_protector_.Reject(pending_.size(),
-                                                       server_->bitgen_)) {
+        if (server_->pending_backlog_protector_.Reject(pending_.count(),
+                                                       shard.bitgen)) {
           return Immediate(absl::ResourceExhaustedError(
               "Too many pending requests for this server"));
         }
         auto w = std::make_shared<ActivityWaiter>(
             GetContext<Activity>()->MakeOwningWaker());
-        pending_.push(w);
+        pending_.Push(shard, w);
         return OnCancel(
             [w]() -> Poll<absl::StatusOr<MatchResult>> {
               std::unique_ptr<absl::StatusOr<MatchResult>> r(
@@ -581,7 +662,7 @@ class Server::RealRequestMatcherPromises : public RequestMatcherInterface {
     const Timestamp created = Timestamp::Now();
   };
   using PendingCall = std::shared_ptr<ActivityWaiter>;
-  std::queue<PendingCall> pending_;
+  PendingCallShards<PendingCall> pending_;
   std::vector<LockedMultiProducerSingleConsumerQueue> requests_per_cq_;
 };
 
@@ -962,6 +1043,12 @@ void Server::SetBatchMethodAllocator(
                                                       std::move(allocator));
 }
 
+void Server::SetUnregisteredCallDestination(
+    RefCountedPtr<CallDestination> destination) {
+  CHECK(!started_);
+  unregistered_call_destination_ = std::move(destination);
+}
+
 void Server::RegisterCompletionQueue(grpc_completion_queue* cq) {
   for (grpc_completion_queue* queue : cqs_) {
     if (queue == cq) return;
@@ -1305,9 +1392,16 @@ Arena* Server::ChannelData::CreateArena() { return channel_->CreateArena(); }
 absl::StatusOr<CallInitiator> Server::ChannelData::CreateCall(
     ClientMetadataHandle client_initial_metadata, Arena* arena) {
   SetRegisteredMethodOnMetadata(*client_initial_metadata);
+  const bool registered =
+      client_initial_metadata->get(GrpcRegisteredMethod()).value_or(nullptr) !=
+      nullptr;
   auto call = MakeServerCall(std::move(client_initial_metadata), server_.get(),
                              channel_.get(), arena);
-  InitCall(call);
+  if (!registered && server_->unregistered_call_destination_ != nullptr) {
+    server_->unregistered_call_destination_->HandleCall(CallHandler(call));
+  } else {
+    InitCall(call);
+  }
   return CallInitiator(std::move(call));
 }
 
@@ -33,7 +33,6 @@
 #include "absl/container/flat_hash_map.h"
 #include "absl/container/flat_hash_set.h"
 #include "absl/hash/hash.h"
-#include "absl/random/random.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
@@ -65,6 +64,7 @@
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/surface/channel.h"
 #include "src/core/lib/surface/completion_queue.h"
+#include "src/core/lib/transport/call_destination.h"
 #include "src/core/lib/transport/metadata_batch.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/server/server_interface.h"
@@ -135,6 +135,10 @@ class Server : public ServerInterface,
 
   void Orphan() ABSL_LOCKS_EXCLUDED(mu_global_) override;
 
+  // Keeps the server object (but not its listeners or calls) alive for
+  // transport setup that completes after the C API call that started it.
+  RefCountedPtr<Server> RefForTransportSetup() { return Ref(); }
+
   const ChannelArgs& channel_args() const override { return channel_args_; }
   channelz::ServerNode* channelz_node() const override {
     return channelz_node_.get();
@@ -184,6 +188,15 @@ class Server : public ServerInterface,
   void SetBatchMethodAllocator(grpc_completion_queue* cq,
                                std::function<BatchCallAllocation()> allocator);
 
+  // Hands the calls to unregistered methods to \a destination once their
+  // initial metadata went through the server filters, instead of matching
+  // them with the calls requested by the application (eg a
+  // ForwardingCallDestination, to proxy them). Only applies to the calls of
+  // the transports that are not filter stack transports. Must be called
+  // before Start().
+  void SetUnregisteredCallDestination(
+      RefCountedPtr<CallDestination> destination);
+
   RegisteredMethod* RegisterMethod(
       const char* method, const char* host,
       grpc_server_register_method_payload_handling payload_handling,
@@ -477,6 +490,9 @@ class Server : public ServerInterface,
 
   // Request matcher for unregistered methods.
   std::unique_ptr<RequestMatcherInterface> unregistered_request_matcher_;
+  // If set, takes the calls to unregistered methods instead of
+  // unregistered_request_matcher_.
+  RefCountedPtr<CallDestination> unregistered_call_destination_;
 
   // The shutdown refs counter tracks whether or not shutdown has been called
   // and whether there are any AllocatingRequestMatcher requests that have been
@@ -488,7 +504,7 @@ class Server : public ServerInterface,
   bool shutdown_published_ ABSL_GUARDED_BY(mu_global_) = false;
   std::vector<ShutdownTag> shutdown_tags_ ABSL_GUARDED_BY(mu_global_);
 
-  RandomEarlyDetection pending_backlog_protector_ ABSL_GUARDED_BY(mu_call_){
+  const RandomEarlyDetection pending_backlog_protector_{
       static_cast<uint64_t>(
           std::max(0, channel_args_.GetInt(GRPC_ARG_SERVER_MAX_PENDING_REQUESTS)
                           .value_or(1000))),
@@ -497,7 +513,6 @@ class Server : public ServerInterface,
           channel_args_.GetInt(GRPC_ARG_SERVER_MAX_PENDING_REQUESTS_HARD_LIMIT)
               .value_or(3000)))};
   const Duration max_time_in_pending_queue_;
-  absl::BitGen bitgen_ ABSL_GUARDED_BY(mu_call_);
 
   std::list<ChannelData*> channels_;
 
@@ -360,6 +360,7 @@ class XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
 
     std::vector<std::string> domains;
     std::vector<Route> routes;
+    XdsRouting::RouteIndex route_index;
   };
 
   class VirtualHostListIterator final
@@ -1210,6 +1211,8 @@ XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
             ServiceConfigImpl::Create(result->args, json.c_str()).value();
       }
     }
+    virtual_host.route_index = XdsRouting::RouteIndex(
+        VirtualHost::RouteListIterator(&virtual_host.routes));
   }
   return config_selector;
 }
@@ -1236,7 +1239,7 @@ XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
                      " in RouteConfiguration"));
   }
   auto& virtual_host = virtual_hosts_[vhost_index.value()];
-  auto route_index = XdsRouting::GetRouteForRequest(
+  auto route_index = virtual_host.route_index.GetRouteForRequest(
       VirtualHost::RouteListIterator(&virtual_host.routes), path, metadata);
   if (route_index.has_value()) {
     auto& route = virtual_host.routes[route_index.value()];
@@ -0,0 +1,440 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/tsi/ssl/ktls/ssl_ktls.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <memory>
+#include <vector>
+
+#include <openssl/crypto.h>
+#include <openssl/hmac.h>
+#include <openssl/obj_mac.h>
+
+#include "absl/strings/escaping.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+
+#include <grpc/support/log.h>
+#include <grpc/support/port_platform.h>
+
+#include "src/core/tsi/transport_security.h"
+
+#if OPENSSL_VERSION_NUMBER >= 0x10101000 && \
+    !defined(LIBRESSL_VERSION_NUMBER) && defined(GPR_LINUX)
+#if defined(__has_include)
+#if __has_include(<linux/tls.h>)
+#define GRPC_SSL_KTLS 1
+#endif
+#endif
+#endif
+
+#ifdef GRPC_SSL_KTLS
+#include <errno.h>
+#include <linux/tls.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+#ifndef SOL_TLS
+#define SOL_TLS 282
+#endif
+#ifndef TCP_ULP
+#define TCP_ULP 31
+#endif
+#endif  // GRPC_SSL_KTLS
+
+namespace tsi {
+
+namespace {
+
+constexpr size_t kMaxHashSize = EVP_MAX_MD_SIZE;
+constexpr size_t kTls13IvSize = 12;
+
+bool Hmac(const EVP_MD* md, absl::string_view key, absl::string_view data,
+          std::string* out) {
+  unsigned char buf[kMaxHashSize];
+  unsigned int len = 0;
+  if (HMAC(md, key.data(), static_cast<int>(key.size()),
+           reinterpret_cast<const unsigned char*>(data.data()), data.size(),
+           buf, &len) == nullptr) {
+    return false;
+  }
+  out->assign(reinterpret_cast<const char*>(buf), len);
+  OPENSSL_cleanse(buf, sizeof(buf));
+  return true;
+}
+
+}  // namespace
+
+bool SslKtlsHkdfExpandLabel(const EVP_MD* md, absl::string_view secret,
+                            absl::string_view label, size_t length,
+                            std::string* out) {
+  const std::string full_label = absl::StrCat("tls13 ", label);
+  if (length > 0xffff || full_label.size() > 0xff) return false;
+  std::string info;
+  info.push_back(static_cast<char>(length >> 8));
+  info.push_back(static_cast<char>(length & 0xff));
+  info.push_back(static_cast<char>(full_label.size()));
+  info.append(full_label);
+  info.push_back(0);  // Empty context.
+  // HKDF-Expand from RFC 5869, with |secret| as the PRK.
+  out->clear();
+  std::string t;
+  for (uint8_t i = 1; out->size() < length; i++) {
+    if (i == 0) return false;  // More than 255 blocks.
+    std::string input = absl::StrCat(t, info);
+    input.push_back(static_cast<char>(i));
+    if (!Hmac(md, secret, input, &t)) return false;
+    out->append(t);
+  }
+  out->resize(length);
+  return true;
+}
+
+bool SslKtlsTls12Prf(const EVP_MD* md, absl::string_view secret,
+                     absl::string_view label, absl::string_view seed,
+                     size_t length, std::string* out) {
+  // P_hash(secret, label + seed).
+  const std::string label_and_seed = absl::StrCat(label, seed);
+  out->clear();
+  std::string a = label_and_seed;
+  std::string block;
+  while (out->size() < length) {
+    if (!Hmac(md, secret, a, &a)) return false;
+    if (!Hmac(md, secret, absl::StrCat(a, label_and_seed), &block)) {
+      return false;
+    }
+    out->append(block);
+  }
+  out->resize(length);
+  return true;
+}
+
+#ifdef GRPC_SSL_KTLS
+
+namespace {
+
+constexpr absl::string_view kClientTrafficSecretLabel =
+    "CLIENT_TRAFFIC_SECRET_0";
+constexpr absl::string_view kServerTrafficSecretLabel =
+    "SERVER_TRAFFIC_SECRET_0";
+
+// TLS 1.3 application traffic secrets captured during the handshake.
+struct TrafficSecrets {
+  ~TrafficSecrets() {
+    OPENSSL_cleanse(&client[0], client.size());
+    OPENSSL_cleanse(&server[0], server.size());
+  }
+
+  std::string client;
+  std::string server;
+};
+
+void TrafficSecretsFree(void* /*parent*/, void* ptr, CRYPTO_EX_DATA* /*ad*/,
+                        int /*index*/, long /*argl*/, void* /*argp*/) {
+  delete static_cast<TrafficSecrets*>(ptr);
+}
+
+int TrafficSecretsIndex() {
+  static const int index =
+      SSL_get_ex_new_index(0, nullptr, nullptr, nullptr, TrafficSecretsFree);
+  return index;
+}
+
+// Detaches the captured traffic secrets from |ssl|, so that they are wiped
+// as soon as the caller is done with them rather than when |ssl| is freed.
+std::unique_ptr<TrafficSecrets> TakeTrafficSecrets(SSL* ssl) {
+  std::unique_ptr<TrafficSecrets> secrets(static_cast<TrafficSecrets*>(
+      SSL_get_ex_data(ssl, TrafficSecretsIndex())));
+  if (secrets != nullptr) SSL_set_ex_data(ssl, TrafficSecretsIndex(), nullptr);
+  return secrets;
+}
+
+// AEAD ciphers the kernel can take over.
+struct KtlsCipher {
+  int nid;
+  uint16_t kernel_cipher;
+  size_t key_size;
+  // Length of the implicit nonce ("fixed IV") in the TLS 1.2 key block.
+  size_t tls12_fixed_iv_size;
+  // Hash of the TLS 1.2 PRF and of the TLS 1.3 cipher suite.
+  const EVP_MD* (*md)();
+};
+
+const KtlsCipher* FindCipher(const SSL_CIPHER* cipher) {
+  static const KtlsCipher kCiphers[] = {
+      {NID_aes_128_gcm, TLS_CIPHER_AES_GCM_128, 16, 4, EVP_sha256},
+      {NID_aes_256_gcm, TLS_CIPHER_AES_GCM_256, 32, 4, EVP_sha384},
+#ifdef TLS_CIPHER_CHACHA20_POLY1305
+      {NID_chacha20_poly1305, TLS_CIPHER_CHACHA20_POLY1305, 32, 12,
+       EVP_sha256},
+#endif
+  };
+  if (cipher == nullptr) return nullptr;
+  const int nid = SSL_CIPHER_get_cipher_nid(cipher);
+  for (const KtlsCipher& c : kCiphers) {
+    if (c.nid == nid) return &c;
+  }
+  return nullptr;
+}
+
+// Key material of one direction.
+struct DirectionKeys {
+  ~DirectionKeys() {
+    OPENSSL_cleanse(&key[0], key.size());
+    OPENSSL_cleanse(&iv[0], iv.size());
+  }
+
+  std::string key;
+  // TLS 1.2: the fixed IV. TLS 1.3: the full per-connection IV.
+  std::string iv;
+  uint64_t seq = 0;
+};
+
+void StoreBigEndian64(uint64_t value, unsigned char* out) {
+  for (int i = 7; i >= 0; i--) {
+    out[i] = static_cast<unsigned char>(value & 0xff);
+    value >>= 8;
+  }
+}
+
+bool InstallKeys(int fd, int direction, uint16_t version,
+                 const KtlsCipher& cipher, const DirectionKeys& keys) {
+  union {
+    tls12_crypto_info_aes_gcm_128 aes_gcm_128;
+    tls12_crypto_info_aes_gcm_256 aes_gcm_256;
+#ifdef TLS_CIPHER_CHACHA20_POLY1305
+    tls12_crypto_info_chacha20_poly1305 chacha20_poly1305;
+#endif
+  } info;
+  memset(&info, 0, sizeof(info));
+  unsigned char rec_seq[8];
+  StoreBigEndian64(keys.seq, rec_seq);
+  const bool tls13 = version == TLS_1_3_VERSION;
+  socklen_t info_size = 0;
+  // For AES-GCM the kernel splits the nonce into a 4 byte salt and an 8 byte
+  // IV. In TLS 1.2 that IV is the explicit nonce sent with each record, which
+  // is taken to be the record sequence number.
+  auto fill_gcm = [&](auto* gcm) {
+    gcm->info.version = version;
+    gcm->info.cipher_type = cipher.kernel_cipher;
+    memcpy(gcm->key, keys.key.data(), sizeof(gcm->key));
+    memcpy(gcm->salt, keys.iv.data(), sizeof(gcm->salt));
+    if (tls13) {
+      memcpy(gcm->iv, keys.iv.data() + sizeof(gcm->salt), sizeof(gcm->iv));
+    } else {
+      memcpy(gcm->iv, rec_seq, sizeof(gcm->iv));
+    }
+    memcpy(gcm->rec_seq, rec_seq, sizeof(gcm->rec_seq));
+    info_size = sizeof(*gcm);
+  };
+  switch (cipher.kernel_cipher) {
+    case TLS_CIPHER_AES_GCM_128:
+      fill_gcm(&info.aes_gcm_128);
+      break;
+    case TLS_CIPHER_AES_GCM_256:
+      fill_gcm(&info.aes_gcm_256);
+      break;
+#ifdef TLS_CIPHER_CHACHA20_POLY1305
+    case TLS_CIPHER_CHACHA20_POLY1305: {
+      auto* chacha = &info.chacha20_poly1305;
+      chacha->info.version = version;
+      chacha->info.cipher_type = cipher.kernel_cipher;
+      memcpy(chacha->key, keys.key.data(), sizeof(chacha->key));
+      memcpy(chacha->iv, keys.iv.data(), sizeof(chacha->iv));
+      memcpy(chacha->rec_seq, rec_seq, sizeof(chacha->rec_seq));
+      info_size = sizeof(*chacha);
+      break;
+    }
+#endif
+    default:
+      return false;
+  }
+  const int r = setsockopt(fd, SOL_TLS, direction, &info, info_size);
+  const int saved_errno = errno;
+  OPENSSL_cleanse(&info, sizeof(info));
+  if (r != 0 && GRPC_TRACE_FLAG_ENABLED(tsi_tracing_enabled)) {
+    gpr_log(GPR_INFO, "setsockopt(SOL_TLS, %s) failed: %s",
+            direction == TLS_TX ? "TLS_TX" : "TLS_RX", strerror(saved_errno));
+  }
+  return r == 0;
+}
+
+bool DeriveTls12Keys(SSL* ssl, const KtlsCipher& cipher,
+                     DirectionKeys* client, DirectionKeys* server) {
+  unsigned char master_key[SSL_MAX_MASTER_KEY_LENGTH];
+  const size_t master_key_size = SSL_SESSION_get_master_key(
+      SSL_get_session(ssl), master_key, sizeof(master_key));
+  unsigned char client_random[SSL3_RANDOM_SIZE];
+  unsigned char server_random[SSL3_RANDOM_SIZE];
+  if (master_key_size == 0 ||
+      SSL_get_client_random(ssl, client_random, sizeof(client_random)) !=
+          sizeof(client_random) ||
+      SSL_get_server_random(ssl, server_random, sizeof(server_random)) !=
+          sizeof(server_random)) {
+    return false;
+  }
+  // key_block = client_write_key, server_write_key, client_write_IV,
+  // server_write_IV. AEAD suites have no MAC keys.
+  std::string key_block;
+  const bool ok = SslKtlsTls12Prf(
+      cipher.md(),
+      absl::string_view(reinterpret_cast<const char*>(master_key),
+                        master_key_size),
+      "key expansion",
+      absl::StrCat(
+          absl::string_view(reinterpret_cast<const char*>(server_random),
+                            sizeof(server_random)),
+          absl::string_view(reinterpret_cast<const char*>(client_random),
+                            sizeof(client_random))),
+      2 * (cipher.key_size + cipher.tls12_fixed_iv_size), &key_block);
+  OPENSSL_cleanse(master_key, sizeof(master_key));
+  if (ok) {
+    absl::string_view block = key_block;
+    client->key = std::string(block.substr(0, cipher.key_size));
+    block.remove_prefix(cipher.key_size);
+    server->key = std::string(block.substr(0, cipher.key_size));
+    block.remove_prefix(cipher.key_size);
+    client->iv = std::string(block.substr(0, cipher.tls12_fixed_iv_size));
+    block.remove_prefix(cipher.tls12_fixed_iv_size);
+    server->iv = std::string(block.substr(0, cipher.tls12_fixed_iv_size));
+  }
+  OPENSSL_cleanse(&key_block[0], key_block.size());
+  return ok;
+}
+
+bool DeriveTls13Keys(const KtlsCipher& cipher, absl::string_view secret,
+                     DirectionKeys* keys) {
+  if (secret.empty()) return false;
+  return SslKtlsHkdfExpandLabel(cipher.md(), secret, "key", cipher.key_size,
+                                &keys->key) &&
+         SslKtlsHkdfExpandLabel(cipher.md(), secret, "iv", kTls13IvSize,
+                                &keys->iv);
+}
+
+}  // namespace
+
+bool SslKtlsSupported() { return true; }
+
+void SslKtlsRecordKeyLogLine(const SSL* ssl, const char* line) {
+  std::vector<absl::string_view> fields = absl::StrSplit(line, ' ');
+  if (fields.size() != 3) return;
+  const bool client = fields[0] == kClientTrafficSecretLabel;
+  if (!client && fields[0] != kServerTrafficSecretLabel) return;
+  SSL* mutable_ssl = const_cast<SSL*>(ssl);
+  auto* secrets = static_cast<TrafficSecrets*>(
+      SSL_get_ex_data(mutable_ssl, TrafficSecretsIndex()));
+  if (secrets == nullptr) {
+    secrets = new TrafficSecrets();
+    if (!SSL_set_ex_data(mutable_ssl, TrafficSecretsIndex(), secrets)) {
+      delete secrets;
+      return;
+    }
+  }
+  (client ? secrets->client : secrets->server) =
+      absl::HexStringToBytes(fields[2]);
+}
+
+tsi_result SslEnableKernelTls(SSL* ssl, int fd, bool has_unused_bytes,
+                              bool* tx, bool* rx) {
+  if (ssl == nullptr || fd < 0 || tx == nullptr || rx == nullptr) {
+    return TSI_INVALID_ARGUMENT;
+  }
+  // The secrets are not needed past this point, whatever the outcome.
+  std::unique_ptr<TrafficSecrets> secrets = TakeTrafficSecrets(ssl);
+  bool want_tx = *tx;
+  bool want_rx = *rx && !has_unused_bytes;
+  *tx = false;
+  *rx = false;
+  const KtlsCipher* cipher = FindCipher(SSL_get_current_cipher(ssl));
+  if (cipher == nullptr) return TSI_OK;
+  const bool is_server = SSL_is_server(ssl);
+  const int ssl_version = SSL_version(ssl);
+  DirectionKeys client;
+  DirectionKeys server;
+  uint16_t version;
+  if (ssl_version == TLS1_2_VERSION) {
+    // Each side's Finished message was record 0 under the new keys.
+    client.seq = 1;
+    server.seq = 1;
+    version = TLS_1_2_VERSION;
+  } else if (ssl_version == TLS1_3_VERSION) {
+    // Application traffic keys start at record 0, but the server may send
+    // NewSessionTicket messages under them at any point after the handshake.
+    // Without a way to ask the SSL library how many it wrote, the server's
+    // direction is only offloaded where that count is available.
+    client.seq = 0;
+#ifdef OPENSSL_IS_BORINGSSL
+    server.seq = is_server ? SSL_get_write_sequence(ssl) : 0;
+    if (!is_server) want_rx = false;
+#else
+    if (is_server) {
+      want_tx = false;
+    } else {
+      want_rx = false;
+    }
+#endif
+    version = TLS_1_3_VERSION;
+  } else {
+    return TSI_OK;
+  }
+  if (!want_tx && !want_rx) return TSI_OK;
+  if (version == TLS_1_2_VERSION) {
+    if (!DeriveTls12Keys(ssl, *cipher, &client, &server)) return TSI_OK;
+  } else {
+    if (secrets == nullptr) return TSI_OK;
+    if ((is_server ? want_rx : want_tx) &&
+        !DeriveTls13Keys(*cipher, secrets->client, &client)) {
+      return TSI_OK;
+    }
+    if ((is_server ? want_tx : want_rx) &&
+        !DeriveTls13Keys(*cipher, secrets->server, &server)) {
+      return TSI_OK;
+    }
+  }
+  if (setsockopt(fd, SOL_TCP, TCP_ULP, "tls", sizeof("tls")) != 0) {
+    if (GRPC_TRACE_FLAG_ENABLED(tsi_tracing_enabled)) {
+      gpr_log(GPR_INFO, "Kernel TLS is not available: %s", strerror(errno));
+    }
+    return TSI_OK;
+  }
+  const DirectionKeys& tx_keys = is_server ? server : client;
+  const DirectionKeys& rx_keys = is_server ? client : server;
+  if (want_tx) *tx = InstallKeys(fd, TLS_TX, version, *cipher, tx_keys);
+  if (want_rx) *rx = InstallKeys(fd, TLS_RX, version, *cipher, rx_keys);
+  if (GRPC_TRACE_FLAG_ENABLED(tsi_tracing_enabled)) {
+    gpr_log(GPR_INFO, "Kernel TLS on fd %d: tx=%d rx=%d", fd, *tx, *rx);
+  }
+  return TSI_OK;
+}
+
+#else  // GRPC_SSL_KTLS
+
+bool SslKtlsSupported() { return false; }
+
+void SslKtlsRecordKeyLogLine(const SSL* /*ssl*/, const char* /*line*/) {}
+
+tsi_result SslEnableKernelTls(SSL* /*ssl*/, int /*fd*/,
+                              bool /*has_unused_bytes*/, bool* tx, bool* rx) {
+  if (tx != nullptr) *tx = false;
+  if (rx != nullptr) *rx = false;
+  return TSI_UNIMPLEMENTED;
+}
+
+#endif  // GRPC_SSL_KTLS
+
+}  // namespace tsi
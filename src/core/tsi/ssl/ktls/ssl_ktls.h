@@ -0,0 +1,80 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_TSI_SSL_KTLS_SSL_KTLS_H
+#define GRPC_SRC_CORE_TSI_SSL_KTLS_SSL_KTLS_H
+
+#include <stddef.h>
+
+#include <string>
+
+#include <openssl/evp.h>
+#include <openssl/ssl.h>
+
+#include "absl/strings/string_view.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/tsi/transport_security_interface.h"
+
+namespace tsi {
+
+// Support for handing the TLS record layer of an established connection to
+// the kernel (kTLS), so that the socket reads and writes plaintext.
+//
+// The kernel needs the traffic keys and the next record sequence number of
+// each direction. TLS 1.2 keys are derived from the master secret, which the
+// SSL library keeps in the session. TLS 1.3 traffic secrets are not kept
+// around after the handshake, so they are captured from the key log callback
+// while the handshake runs: see SslKtlsRecordKeyLogLine(). They are wiped by
+// SslEnableKernelTls().
+//
+// Once the kernel receives records, alerts and post-handshake messages (such
+// as KeyUpdate) from the peer surface as read errors of the TCP endpoint.
+
+// Returns true if this build can install keys into the kernel at all.
+bool SslKtlsSupported();
+
+// Remembers the TLS 1.3 application traffic secrets contained in a key log
+// line (NSS key log format) on |ssl|. Lines for other secrets are ignored.
+// Meant to be called from the SSL_CTX key log callback.
+void SslKtlsRecordKeyLogLine(const SSL* ssl, const char* line);
+
+// Tries to install the record keys of the established connection |ssl| on the
+// TCP socket |fd|. On input, |*tx| and |*rx| say which directions the caller
+// wants to offload; on output they say which directions the kernel has taken
+// over. Directions whose record sequence number is not known to be in sync
+// with the socket are never offloaded. |has_unused_bytes| must be true if
+// bytes already read from the socket are still waiting to be decrypted.
+//
+// A direction that was offloaded must no longer go through |ssl|. The TLS 1.3
+// traffic secrets captured on |ssl| are wiped in any case.
+tsi_result SslEnableKernelTls(SSL* ssl, int fd, bool has_unused_bytes,
+                              bool* tx, bool* rx);
+
+// Exposed for testing.
+
+// HKDF-Expand-Label(secret, label, "", length) from RFC 8446 section 7.1.
+bool SslKtlsHkdfExpandLabel(const EVP_MD* md, absl::string_view secret,
+                            absl::string_view label, size_t length,
+                            std::string* out);
+
+// The TLS 1.2 PRF from RFC 5246 section 5.
+bool SslKtlsTls12Prf(const EVP_MD* md, absl::string_view secret,
+                     absl::string_view label, absl::string_view seed,
+                     size_t length, std::string* out);
+
+}  // namespace tsi
+
+#endif  // GRPC_SRC_CORE_TSI_SSL_KTLS_SSL_KTLS_H
@@ -0,0 +1,170 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/tsi/ssl/session_ticket/ssl_session_ticket_key_ring.h"
+
+#include <string.h>
+
+#include <utility>
+
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#include <openssl/rand.h>
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L && !defined(OPENSSL_IS_BORINGSSL)
+#include <openssl/core_names.h>
+#include <openssl/params.h>
+#endif
+
+#include "absl/log/check.h"
+#include "absl/strings/str_cat.h"
+
+#include <grpc/support/log.h>
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
+
+namespace tsi {
+
+namespace {
+
+// The SSL contexts hold a ref to the key ring in their ex data.
+int SslContextExIndex() {
+  static const int index = SSL_CTX_get_ex_new_index(
+      0, nullptr, nullptr, nullptr,
+      [](void* /*parent*/, void* ptr, CRYPTO_EX_DATA* /*ad*/, int /*index*/,
+         long /*argl*/, void* /*argp*/) {
+        if (ptr != nullptr) {
+          static_cast<SslSessionTicketKeyRing*>(ptr)->Unref();
+        }
+      });
+  return index;
+}
+
+}  // namespace
+
+SslSessionTicketKeyRing::SslSessionTicketKeyRing() {
+  KeyList keys(1);
+  CHECK_EQ(RAND_bytes(reinterpret_cast<uint8_t*>(keys.data()), sizeof(Key)),
+           1);
+  keys_ = std::make_shared<const KeyList>(std::move(keys));
+}
+
+absl::Status SslSessionTicketKeyRing::SetKeys(absl::string_view keys) {
+  static_assert(sizeof(Key) == kSslSessionTicketKeySize, "");
+  if (keys.empty() || keys.size() % kSslSessionTicketKeySize != 0) {
+    return absl::InvalidArgumentError(absl::StrCat(
+        "Session ticket keys must be ", kSslSessionTicketKeySize,
+        " bytes long, got ", keys.size(), " bytes"));
+  }
+  KeyList key_list(keys.size() / kSslSessionTicketKeySize);
+  memcpy(key_list.data(), keys.data(), keys.size());
+  auto new_keys = std::make_shared<const KeyList>(std::move(key_list));
+  grpc_core::MutexLock lock(&mu_);
+  keys_ = std::move(new_keys);
+  return absl::OkStatus();
+}
+
+std::shared_ptr<const SslSessionTicketKeyRing::KeyList>
+SslSessionTicketKeyRing::keys() {
+  grpc_core::MutexLock lock(&mu_);
+  return keys_;
+}
+
+SslSessionTicketKeyRing* SslSessionTicketKeyRing::FromSsl(SSL* ssl) {
+  return static_cast<SslSessionTicketKeyRing*>(
+      SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), SslContextExIndex()));
+}
+
+template <typename HmacInit>
+int SslSessionTicketKeyRing::TicketKeyCallback(SSL* ssl, uint8_t* key_name,
+                                               uint8_t* iv,
+                                               EVP_CIPHER_CTX* cipher_ctx,
+                                               int encrypt,
+                                               HmacInit hmac_init) {
+  SslSessionTicketKeyRing* key_ring = FromSsl(ssl);
+  if (key_ring == nullptr) return -1;
+  std::shared_ptr<const KeyList> keys = key_ring->keys();
+  if (encrypt == 1) {
+    const Key& key = keys->front();
+    if (RAND_bytes(iv, EVP_CIPHER_iv_length(EVP_aes_256_cbc())) != 1) {
+      return -1;
+    }
+    memcpy(key_name, key.name, sizeof(key.name));
+    if (EVP_EncryptInit_ex(cipher_ctx, EVP_aes_256_cbc(), nullptr, key.aes_key,
+                           iv) != 1 ||
+        !hmac_init(key.hmac_secret, sizeof(key.hmac_secret))) {
+      return -1;
+    }
+    return 1;
+  }
+  for (const Key& key : *keys) {
+    if (memcmp(key_name, key.name, sizeof(key.name)) != 0) continue;
+    if (EVP_DecryptInit_ex(cipher_ctx, EVP_aes_256_cbc(), nullptr, key.aes_key,
+                           iv) != 1 ||
+        !hmac_init(key.hmac_secret, sizeof(key.hmac_secret))) {
+      return -1;
+    }
+    // Renew the tickets of the keys that are being rotated out.
+    return &key == &keys->front() ? 1 : 2;
+  }
+  // The ticket was issued with a key that is unknown or gone: fall back to a
+  // full handshake.
+  grpc_core::global_stats().IncrementTlsSessionTicketKeyMisses();
+  return 0;
+}
+
+tsi_result SslSessionTicketKeyRing::AttachToSslContext(SSL_CTX* ssl_context) {
+  SslSessionTicketKeyRing* key_ring = Ref().release();
+  if (SSL_CTX_set_ex_data(ssl_context, SslContextExIndex(), key_ring) != 1) {
+    key_ring->Unref();
+    gpr_log(GPR_ERROR, "Could not attach the session ticket key ring.");
+    return TSI_INTERNAL_ERROR;
+  }
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L && !defined(OPENSSL_IS_BORINGSSL)
+  auto* callback = +[](SSL* ssl, unsigned char* key_name, unsigned char* iv,
+                       EVP_CIPHER_CTX* cipher_ctx, EVP_MAC_CTX* mac_ctx,
+                       int encrypt) {
+    return TicketKeyCallback(
+        ssl, key_name, iv, cipher_ctx, encrypt,
+        [mac_ctx](const uint8_t* secret, size_t secret_size) {
+          OSSL_PARAM params[] = {
+              OSSL_PARAM_construct_octet_string(
+                  OSSL_MAC_PARAM_KEY, const_cast<uint8_t*>(secret),
+                  secret_size),
+              OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST,
+                                               const_cast<char*>("SHA256"), 0),
+              OSSL_PARAM_construct_end()};
+          return EVP_MAC_CTX_set_params(mac_ctx, params) == 1;
+        });
+  };
+  SSL_CTX_set_tlsext_ticket_key_evp_cb(ssl_context, callback);
+#else
+  auto* callback = +[](SSL* ssl, uint8_t* key_name, uint8_t* iv,
+                       EVP_CIPHER_CTX* cipher_ctx, HMAC_CTX* hmac_ctx,
+                       int encrypt) {
+    return TicketKeyCallback(
+        ssl, key_name, iv, cipher_ctx, encrypt,
+        [hmac_ctx](const uint8_t* secret, size_t secret_size) {
+          return HMAC_Init_ex(hmac_ctx, secret, static_cast<int>(secret_size),
+                              EVP_sha256(), nullptr) == 1;
+        });
+  };
+  SSL_CTX_set_tlsext_ticket_key_cb(ssl_context, callback);
+#endif
+  return TSI_OK;
+}
+
+}  // namespace tsi
@@ -0,0 +1,93 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_TSI_SSL_SESSION_TICKET_SSL_SESSION_TICKET_KEY_RING_H
+#define GRPC_SRC_CORE_TSI_SSL_SESSION_TICKET_SSL_SESSION_TICKET_KEY_RING_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <vector>
+
+#include <openssl/ssl.h>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/tsi/transport_security_interface.h"
+
+namespace tsi {
+
+// Size of a session ticket key: a 16 byte key name, followed by a 32 byte
+// HMAC-SHA256 secret and a 32 byte AES-256-CBC key.
+constexpr size_t kSslSessionTicketKeySize = 80;
+
+// The keys a TLS server encrypts and decrypts its session tickets with.
+//
+// The first key encrypts the tickets that the server issues, and all of them
+// decrypt the tickets that clients present. Loading the same keys in all the
+// replicas of a server lets clients resume their sessions on any of them, and
+// rotating keys in (as the second key, then the first one) and out lets
+// tickets stay valid while the new keys reach every replica. Tickets that are
+// decrypted with another key than the first one are renewed.
+//
+// Until keys are set, the key ring holds a single random key, just like the
+// SSL library does when it is not given any keys.
+class SslSessionTicketKeyRing
+    : public grpc_core::RefCounted<SslSessionTicketKeyRing> {
+ public:
+  SslSessionTicketKeyRing();
+
+  // Replaces the keys with the kSslSessionTicketKeySize sized keys stored
+  // back to back in |keys|. Thread safe. Returns an error, keeping the current
+  // keys, if |keys| is empty or its size is not a multiple of
+  // kSslSessionTicketKeySize.
+  absl::Status SetKeys(absl::string_view keys);
+
+  // Makes |ssl_context| encrypt and decrypt session tickets with the keys of
+  // this key ring. |ssl_context| holds a ref to the key ring.
+  tsi_result AttachToSslContext(SSL_CTX* ssl_context);
+
+ private:
+  struct Key {
+    uint8_t name[16];
+    uint8_t hmac_secret[32];
+    uint8_t aes_key[32];
+  };
+  using KeyList = std::vector<Key>;
+
+  static SslSessionTicketKeyRing* FromSsl(SSL* ssl);
+  std::shared_ptr<const KeyList> keys();
+
+  // Initializes |cipher_ctx| and |hmac_init| for the ticket whose key name is
+  // |key_name|, or for a new ticket if |encrypt| is 1. Returns the value
+  // expected from the SSL library ticket key callbacks.
+  template <typename HmacInit>
+  static int TicketKeyCallback(SSL* ssl, uint8_t* key_name, uint8_t* iv,
+                               EVP_CIPHER_CTX* cipher_ctx, int encrypt,
+                               HmacInit hmac_init);
+
+  grpc_core::Mutex mu_;
+  std::shared_ptr<const KeyList> keys_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace tsi
+
+#endif  // GRPC_SRC_CORE_TSI_SSL_SESSION_TICKET_SSL_SESSION_TICKET_KEY_RING_H
@@ -58,14 +58,20 @@
 #include <grpc/support/sync.h>
 #include <grpc/support/thd_id.h>
 
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/crash.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/security/credentials/tls/grpc_tls_crl_provider.h"
 #include "src/core/tsi/ssl/key_logging/ssl_key_logging.h"
+#include "src/core/tsi/ssl/ktls/ssl_ktls.h"
 #include "src/core/tsi/ssl/session_cache/ssl_session_cache.h"
 #include "src/core/tsi/ssl_transport_security_utils.h"
 #include "src/core/tsi/ssl_types.h"
 #include "src/core/tsi/transport_security.h"
+#include "src/core/tsi/transport_security_grpc.h"
 
 // --- Constants. ---
 
@@ -145,6 +151,18 @@ struct tsi_ssl_frame_protector {
   size_t buffer_size;
   size_t buffer_offset;
 };
+struct tsi_ssl_zero_copy_grpc_protector {
+  tsi_zero_copy_grpc_protector base;
+  SSL* ssl;
+  BIO* network_io;
+  size_t max_protected_frame_size;
+  // The largest plaintext put into a single frame.
+  size_t max_payload_size;
+  // Holds runs of small slices gathered into one frame.
+  unsigned char* gather_buffer;
+  // Protect and unprotect may run concurrently but share |ssl|.
+  grpc_core::Mutex mu;
+};
 // --- Library Initialization. ---
 
 static gpr_once g_init_openssl_once = GPR_ONCE_INIT;
@@ -1337,6 +1355,72 @@ static const tsi_frame_protector_vtable frame_protector_vtable = {
     ssl_protector_destroy,
 };
 
+// --- tsi_zero_copy_grpc_protector methods implementation. ---
+
+static tsi_result ssl_zero_copy_grpc_protector_protect(
+    tsi_zero_copy_grpc_protector* self, grpc_slice_buffer* unprotected_slices,
+    grpc_slice_buffer* protected_slices) {
+  if (self == nullptr || unprotected_slices == nullptr ||
+      protected_slices == nullptr) {
+    gpr_log(GPR_ERROR,
+            "Invalid nullptr arguments to ssl_zero_copy_grpc_protector "
+            "protect.");
+    return TSI_INVALID_ARGUMENT;
+  }
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  grpc_core::MutexLock lock(&impl->mu);
+  return grpc_core::SslZeroCopyProtectorProtect(
+      impl->ssl, impl->network_io, impl->max_payload_size,
+      impl->gather_buffer, unprotected_slices, protected_slices);
+}
+
+static tsi_result ssl_zero_copy_grpc_protector_unprotect(
+    tsi_zero_copy_grpc_protector* self, grpc_slice_buffer* protected_slices,
+    grpc_slice_buffer* unprotected_slices, int* min_progress_size) {
+  if (self == nullptr || unprotected_slices == nullptr ||
+      protected_slices == nullptr) {
+    gpr_log(GPR_ERROR,
+            "Invalid nullptr arguments to ssl_zero_copy_grpc_protector "
+            "unprotect.");
+    return TSI_INVALID_ARGUMENT;
+  }
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  grpc_core::MutexLock lock(&impl->mu);
+  return grpc_core::SslZeroCopyProtectorUnprotect(
+      impl->ssl, impl->network_io, protected_slices, unprotected_slices,
+      min_progress_size);
+}
+
+static void ssl_zero_copy_grpc_protector_destroy(
+    tsi_zero_copy_grpc_protector* self) {
+  if (self == nullptr) return;
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  gpr_free(impl->gather_buffer);
+  if (impl->ssl != nullptr) SSL_free(impl->ssl);
+  if (impl->network_io != nullptr) BIO_free(impl->network_io);
+  delete impl;
+}
+
+static tsi_result ssl_zero_copy_grpc_protector_max_frame_size(
+    tsi_zero_copy_grpc_protector* self, size_t* max_frame_size) {
+  if (self == nullptr || max_frame_size == nullptr) return TSI_INVALID_ARGUMENT;
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  *max_frame_size = impl->max_protected_frame_size;
+  return TSI_OK;
+}
+
+static const tsi_zero_copy_grpc_protector_vtable
+    ssl_zero_copy_grpc_protector_vtable = {
+        ssl_zero_copy_grpc_protector_protect,
+        ssl_zero_copy_grpc_protector_unprotect,
+        ssl_zero_copy_grpc_protector_destroy,
+        ssl_zero_copy_grpc_protector_max_frame_size,
+};
+
 // --- tsi_server_handshaker_factory methods implementation. ---
 
 static void tsi_ssl_handshaker_factory_destroy(
@@ -1490,7 +1574,57 @@ static tsi_result ssl_handshaker_result_extract_peer(
 static tsi_result ssl_handshaker_result_get_frame_protector_type(
     const tsi_handshaker_result* /*self*/,
     tsi_frame_protector_type* frame_protector_type) {
-  *frame_protector_type = TSI_FRAME_PROTECTOR_NORMAL;
+  *frame_protector_type =
+      grpc_core::IsTlsZeroCopyFrameProtectorEnabled()
+          ? TSI_FRAME_PROTECTOR_NORMAL_OR_ZERO_COPY
+          : TSI_FRAME_PROTECTOR_NORMAL;
+  return TSI_OK;
+}
+
+// Clamps the requested maximum protected frame size, if any, to the range
+// supported by the SSL frame protectors and returns it.
+static size_t ssl_clamp_max_protected_frame_size(
+    size_t* max_output_protected_frame_size) {
+  if (max_output_protected_frame_size == nullptr) {
+    return TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
+  }
+  if (*max_output_protected_frame_size >
+      TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND) {
+    *max_output_protected_frame_size =
+        TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
+  } else if (*max_output_protected_frame_size <
+             TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND) {
+    *max_output_protected_frame_size =
+        TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND;
+  }
+  return *max_output_protected_frame_size;
+}
+
+static tsi_result ssl_handshaker_result_create_zero_copy_grpc_protector(
+    const tsi_handshaker_result* self, size_t* max_output_protected_frame_size,
+    tsi_zero_copy_grpc_protector** protector) {
+  tsi_ssl_handshaker_result* impl =
+      reinterpret_cast<tsi_ssl_handshaker_result*>(
+          const_cast<tsi_handshaker_result*>(self));
+  if (impl->ssl == nullptr || impl->network_io == nullptr) {
+    return TSI_FAILED_PRECONDITION;
+  }
+  tsi_ssl_zero_copy_grpc_protector* protector_impl =
+      new tsi_ssl_zero_copy_grpc_protector();
+  protector_impl->max_protected_frame_size =
+      ssl_clamp_max_protected_frame_size(max_output_protected_frame_size);
+  protector_impl->max_payload_size = protector_impl->max_protected_frame_size -
+                                     TSI_SSL_MAX_PROTECTION_OVERHEAD;
+  protector_impl->gather_buffer = static_cast<unsigned char*>(
+      gpr_malloc(protector_impl->max_payload_size));
+
+  // Transfer ownership of ssl and network_io to the frame protector.
+  protector_impl->ssl = impl->ssl;
+  impl->ssl = nullptr;
+  protector_impl->network_io = impl->network_io;
+  impl->network_io = nullptr;
+  protector_impl->base.vtable = &ssl_zero_copy_grpc_protector_vtable;
+  *protector = &protector_impl->base;
   return TSI_OK;
 }
 
@@ -1498,7 +1632,7 @@ static tsi_result ssl_handshaker_result_create_frame_protector(
     const tsi_handshaker_result* self, size_t* max_output_protected_frame_size,
     tsi_frame_protector** protector) {
   size_t actual_max_output_protected_frame_size =
-      TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
+      ssl_clamp_max_protected_frame_size(max_output_protected_frame_size);
   tsi_ssl_handshaker_result* impl =
       reinterpret_cast<tsi_ssl_handshaker_result*>(
           const_cast<tsi_handshaker_result*>(self));
@@ -1506,18 +1640,6 @@ static tsi_result ssl_handshaker_result_create_frame_protector(
       static_cast<tsi_ssl_frame_protector*>(
           gpr_zalloc(sizeof(*protector_impl)));
 
-  if (max_output_protected_frame_size != nullptr) {
-    if (*max_output_protected_frame_size >
-        TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND) {
-      *max_output_protected_frame_size =
-          TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
-    } else if (*max_output_protected_frame_size <
-               TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND) {
-      *max_output_protected_frame_size =
-          TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND;
-    }
-    actual_max_output_protected_frame_size = *max_output_protected_frame_size;
-  }
   protector_impl->buffer_size =
       actual_max_output_protected_frame_size - TSI_SSL_MAX_PROTECTION_OVERHEAD;
   protector_impl->buffer =
@@ -1549,6 +1671,19 @@ static tsi_result ssl_handshaker_result_get_unused_bytes(
   return TSI_OK;
 }
 
+static tsi_result ssl_handshaker_result_enable_kernel_tls(
+    const tsi_handshaker_result* self, int fd, bool* tx, bool* rx) {
+  const tsi_ssl_handshaker_result* impl =
+      reinterpret_cast<const tsi_ssl_handshaker_result*>(self);
+  if (impl->ssl == nullptr) {
+    *tx = false;
+    *rx = false;
+    return TSI_FAILED_PRECONDITION;
+  }
+  return tsi::SslEnableKernelTls(impl->ssl, fd, impl->unused_bytes_size > 0,
+                                 tx, rx);
+}
+
 static void ssl_handshaker_result_destroy(tsi_handshaker_result* self) {
   tsi_ssl_handshaker_result* impl =
       reinterpret_cast<tsi_ssl_handshaker_result*>(self);
@@ -1561,10 +1696,11 @@ static void ssl_handshaker_result_destroy(tsi_handshaker_result* self) {
 static const tsi_handshaker_result_vtable handshaker_result_vtable = {
     ssl_handshaker_result_extract_peer,
     ssl_handshaker_result_get_frame_protector_type,
-    nullptr,  // create_zero_copy_grpc_protector
+    ssl_handshaker_result_create_zero_copy_grpc_protector,
     ssl_handshaker_result_create_frame_protector,
     ssl_handshaker_result_get_unused_bytes,
     ssl_handshaker_result_destroy,
+    ssl_handshaker_result_enable_kernel_tls,
 };
 
 static tsi_result ssl_handshaker_result_create(
@@ -1626,6 +1762,22 @@ static tsi_result ssl_handshaker_get_result(tsi_ssl_handshaker* impl) {
   return impl->result;
 }
 
+// Counts the completed handshakes, and the ones that resumed a session.
+static void ssl_handshaker_record_stats(SSL* ssl) {
+  bool resumed = SSL_session_reused(ssl);
+  if (SSL_is_server(ssl)) {
+    grpc_core::global_stats().IncrementTlsServerHandshakes();
+    if (resumed) {
+      grpc_core::global_stats().IncrementTlsServerResumedHandshakes();
+    }
+  } else {
+    grpc_core::global_stats().IncrementTlsClientHandshakes();
+    if (resumed) {
+      grpc_core::global_stats().IncrementTlsClientResumedHandshakes();
+    }
+  }
+}
+
 static tsi_result ssl_handshaker_do_handshake(tsi_ssl_handshaker* impl,
                                               std::string* error) {
   if (ssl_handshaker_get_result(impl) != TSI_HANDSHAKE_IN_PROGRESS) {
@@ -1828,6 +1980,7 @@ static tsi_result ssl_handshaker_next(tsi_handshaker* self,
       if (error != nullptr) *error = "More unused bytes than received bytes.";
       return TSI_INTERNAL_ERROR;
     }
+    ssl_handshaker_record_stats(impl->ssl);
     status = ssl_handshaker_result_create(impl, unused_bytes, unused_bytes_size,
                                           handshaker_result, error);
     if (status == TSI_OK) {
@@ -2166,13 +2319,17 @@ static int server_handshaker_factory_new_session_callback(
 }
 
 /// This callback is invoked at client or server when ssl/tls handshakes
-/// complete and keylogging is enabled.
+/// complete and keylogging or kernel TLS offload is enabled.
 template <typename T>
 static void ssl_keylogging_callback(const SSL* ssl, const char* info) {
+  if (grpc_core::IsTlsKernelOffloadEnabled()) {
+    tsi::SslKtlsRecordKeyLogLine(ssl, info);
+  }
   SSL_CTX* ssl_context = SSL_get_SSL_CTX(ssl);
   CHECK_NE(ssl_context, nullptr);
   void* arg = SSL_CTX_get_ex_data(ssl_context, g_ssl_ctx_ex_factory_index);
   T* factory = static_cast<T*>(arg);
+  if (factory == nullptr || factory->key_logger == nullptr) return;
   factory->key_logger->LogSessionKeys(ssl_context, info);
 }
 
@@ -2248,8 +2405,12 @@ tsi_result tsi_create_ssl_client_handshaker_factory_with_options(
 #if OPENSSL_VERSION_NUMBER >= 0x10101000 && !defined(LIBRESSL_VERSION_NUMBER)
   if (options->key_logger != nullptr) {
     impl->key_logger = options->key_logger->Ref();
+  }
+  if (options->key_logger != nullptr ||
+      grpc_core::IsTlsKernelOffloadEnabled()) {
     // SSL_CTX_set_keylog_callback is set here to register callback
-    // when ssl/tls handshakes complete.
+    // when ssl/tls handshakes complete. Kernel TLS offload needs the TLS 1.3
+    // traffic secrets, which are only available through this callback.
     SSL_CTX_set_keylog_callback(
         ssl_context,
         ssl_keylogging_callback<tsi_ssl_client_handshaker_factory>);
@@ -2470,7 +2631,11 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
         break;
       }
 
-      if (options->session_ticket_key != nullptr) {
+      if (options->session_ticket_key_ring != nullptr) {
+        result = options->session_ticket_key_ring->AttachToSslContext(
+            impl->ssl_contexts[i]);
+        if (result != TSI_OK) break;
+      } else if (options->session_ticket_key != nullptr) {
         if (SSL_CTX_set_tlsext_ticket_keys(
                 impl->ssl_contexts[i],
                 const_cast<char*>(options->session_ticket_key),
@@ -2568,8 +2733,13 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
         // Need to set factory at g_ssl_ctx_ex_factory_index
         SSL_CTX_set_ex_data(impl->ssl_contexts[i], g_ssl_ctx_ex_factory_index,
                             impl);
+      }
+      if (options->key_logger != nullptr ||
+          grpc_core::IsTlsKernelOffloadEnabled()) {
         // SSL_CTX_set_keylog_callback is set here to register callback
-        // when ssl/tls handshakes complete.
+        // when ssl/tls handshakes complete. Kernel TLS offload needs the
+        // TLS 1.3 traffic secrets, which are only available through this
+        // callback.
         SSL_CTX_set_keylog_callback(
             impl->ssl_contexts[i],
             ssl_keylogging_callback<tsi_ssl_server_handshaker_factory>);
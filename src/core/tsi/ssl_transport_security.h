@@ -30,6 +30,7 @@
 #include <grpc/support/port_platform.h>
 
 #include "src/core/tsi/ssl/key_logging/ssl_key_logging.h"
+#include "src/core/tsi/ssl/session_ticket/ssl_session_ticket_key_ring.h"
 #include "src/core/tsi/ssl_transport_security_utils.h"
 #include "src/core/tsi/transport_security_interface.h"
 
@@ -327,6 +328,10 @@ struct tsi_ssl_server_handshaker_options {
   const char* session_ticket_key;
   // session_ticket_key_size is a size of session ticket encryption key.
   size_t session_ticket_key_size;
+  // session_ticket_key_ring is an optional set of rotating keys for
+  // encrypting session tickets, which takes precedence over
+  // session_ticket_key. If parameter is not specified it must be NULL.
+  tsi::SslSessionTicketKeyRing* session_ticket_key_ring;
   // The min and max TLS versions that will be negotiated by the handshaker.
   tsi_tls_version min_tls_version;
   tsi_tls_version max_tls_version;
@@ -367,6 +372,7 @@ struct tsi_ssl_server_handshaker_options {
         num_alpn_protocols(0),
         session_ticket_key(nullptr),
         session_ticket_key_size(0),
+        session_ticket_key_ring(nullptr),
         min_tls_version(tsi_tls_version::TSI_TLS1_2),
         max_tls_version(tsi_tls_version::TSI_TLS1_3),
         key_logger(nullptr),
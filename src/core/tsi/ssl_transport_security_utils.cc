@@ -18,6 +18,8 @@
 
 #include "src/core/tsi/ssl_transport_security_utils.h"
 
+#include <algorithm>
+
 #include <openssl/crypto.h>
 #include <openssl/err.h>
 #include <openssl/ssl.h>
@@ -29,6 +31,8 @@
 
 #include <grpc/support/port_platform.h>
 
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_internal.h"
 #include "src/core/tsi/transport_security_interface.h"
 
 namespace grpc_core {
@@ -88,6 +92,29 @@ tsi_result DoSslWrite(SSL* ssl, unsigned char* unprotected_bytes,
   return TSI_OK;
 }
 
+// Maps the failed SSL_read or SSL_peek return value |ret| to a TSI result.
+// Running out of data to read is not an error.
+static tsi_result SslReadErrorToTsiResult(SSL* ssl, int ret) {
+  int error = SSL_get_error(ssl, ret);
+  switch (error) {
+    case SSL_ERROR_ZERO_RETURN:  // Received a close_notify alert.
+    case SSL_ERROR_WANT_READ:    // We need more data to finish the frame.
+      return TSI_OK;
+    case SSL_ERROR_WANT_WRITE:
+      gpr_log(GPR_ERROR,
+              "Peer tried to renegotiate SSL connection. This is unsupported.");
+      return TSI_UNIMPLEMENTED;
+    case SSL_ERROR_SSL:
+      gpr_log(GPR_ERROR, "Corruption detected.");
+      LogSslErrorStack();
+      return TSI_DATA_CORRUPTED;
+    default:
+      gpr_log(GPR_ERROR, "SSL_read failed with error %s.",
+              SslErrorString(error));
+      return TSI_PROTOCOL_FAILURE;
+  }
+}
+
 tsi_result DoSslRead(SSL* ssl, unsigned char* unprotected_bytes,
                      size_t* unprotected_bytes_size) {
   CHECK_LE(*unprotected_bytes_size, static_cast<size_t>(INT_MAX));
@@ -95,26 +122,8 @@ tsi_result DoSslRead(SSL* ssl, unsigned char* unprotected_bytes,
   int read_from_ssl = SSL_read(ssl, unprotected_bytes,
                                static_cast<int>(*unprotected_bytes_size));
   if (read_from_ssl <= 0) {
-    read_from_ssl = SSL_get_error(ssl, read_from_ssl);
-    switch (read_from_ssl) {
-      case SSL_ERROR_ZERO_RETURN:  // Received a close_notify alert.
-      case SSL_ERROR_WANT_READ:    // We need more data to finish the frame.
-        *unprotected_bytes_size = 0;
-        return TSI_OK;
-      case SSL_ERROR_WANT_WRITE:
-        gpr_log(
-            GPR_ERROR,
-            "Peer tried to renegotiate SSL connection. This is unsupported.");
-        return TSI_UNIMPLEMENTED;
-      case SSL_ERROR_SSL:
-        gpr_log(GPR_ERROR, "Corruption detected.");
-        LogSslErrorStack();
-        return TSI_DATA_CORRUPTED;
-      default:
-        gpr_log(GPR_ERROR, "SSL_read failed with error %s.",
-                SslErrorString(read_from_ssl));
-        return TSI_PROTOCOL_FAILURE;
-    }
+    *unprotected_bytes_size = 0;
+    return SslReadErrorToTsiResult(ssl, read_from_ssl);
   }
   *unprotected_bytes_size = static_cast<size_t>(read_from_ssl);
   return TSI_OK;
@@ -252,6 +261,133 @@ tsi_result SslProtectorUnprotect(const unsigned char* protected_frames_bytes,
   return result;
 }
 
+// --- tsi_zero_copy_grpc_protector util methods implementation. ---
+
+// Moves the TLS frames that |ssl| wrote to |network_io| into a new slice of
+// |protected_slices|.
+static tsi_result MoveProtectedFramesToSlices(
+    BIO* network_io, grpc_slice_buffer* protected_slices) {
+  int pending = static_cast<int>(BIO_pending(network_io));
+  if (pending <= 0) return TSI_OK;
+  grpc_slice frames = GRPC_SLICE_MALLOC(static_cast<size_t>(pending));
+  int read_from_ssl =
+      BIO_read(network_io, GRPC_SLICE_START_PTR(frames), pending);
+  if (read_from_ssl != pending) {
+    gpr_log(GPR_ERROR, "Could not read from BIO after SSL_write.");
+    CSliceUnref(frames);
+    return TSI_INTERNAL_ERROR;
+  }
+  grpc_slice_buffer_add(protected_slices, frames);
+  return TSI_OK;
+}
+
+// Decrypts the TLS records that |ssl| has complete frames for, each into a
+// slice of |unprotected_slices| sized to fit its plaintext.
+static tsi_result MoveUnprotectedRecordsToSlices(
+    SSL* ssl, grpc_slice_buffer* unprotected_slices) {
+  while (true) {
+    int pending = SSL_pending(ssl);
+    if (pending <= 0) {
+      // Peeking decrypts the next record, after which SSL_pending() reports
+      // the size of its plaintext.
+      unsigned char first_byte;
+      ERR_clear_error();
+      int peeked = SSL_peek(ssl, &first_byte, 1);
+      if (peeked <= 0) return SslReadErrorToTsiResult(ssl, peeked);
+      pending = SSL_pending(ssl);
+      if (pending <= 0) pending = peeked;
+    }
+    grpc_slice record = GRPC_SLICE_MALLOC(static_cast<size_t>(pending));
+    size_t record_size = static_cast<size_t>(pending);
+    tsi_result result =
+        DoSslRead(ssl, GRPC_SLICE_START_PTR(record), &record_size);
+    if (result != TSI_OK || record_size == 0) {
+      CSliceUnref(record);
+      return result;
+    }
+    GRPC_SLICE_SET_LENGTH(record, record_size);
+    grpc_slice_buffer_add(unprotected_slices, record);
+  }
+}
+
+tsi_result SslZeroCopyProtectorProtect(SSL* ssl, BIO* network_io,
+                                       size_t max_payload_size,
+                                       unsigned char* gather_buffer,
+                                       grpc_slice_buffer* unprotected_slices,
+                                       grpc_slice_buffer* protected_slices) {
+  CHECK_GT(max_payload_size, 0u);
+  while (unprotected_slices->length > 0) {
+    size_t payload_size =
+        std::min(unprotected_slices->length, max_payload_size);
+    const size_t first_slice_size =
+        GRPC_SLICE_LENGTH(unprotected_slices->slices[0]);
+    tsi_result result;
+    if (first_slice_size >= payload_size) {
+      // Encrypt straight out of the slice.
+      result = DoSslWrite(
+          ssl, GRPC_SLICE_START_PTR(unprotected_slices->slices[0]),
+          payload_size);
+      if (result != TSI_OK) return result;
+      if (first_slice_size == payload_size) {
+        grpc_slice_buffer_remove_first(unprotected_slices);
+      } else {
+        grpc_slice_buffer_sub_first(unprotected_slices, payload_size,
+                                    first_slice_size);
+      }
+    } else {
+      grpc_slice_buffer_move_first_into_buffer(unprotected_slices,
+                                               payload_size, gather_buffer);
+      result = DoSslWrite(ssl, gather_buffer, payload_size);
+      if (result != TSI_OK) return result;
+    }
+    // Each frame is drained right away so that |network_io| never fills up.
+    result = MoveProtectedFramesToSlices(network_io, protected_slices);
+    if (result != TSI_OK) return result;
+  }
+  return TSI_OK;
+}
+
+tsi_result SslZeroCopyProtectorUnprotect(SSL* ssl, BIO* network_io,
+                                         grpc_slice_buffer* protected_slices,
+                                         grpc_slice_buffer* unprotected_slices,
+                                         int* min_progress_size) {
+  tsi_result result = TSI_OK;
+  for (size_t i = 0; i < protected_slices->count; ++i) {
+    const uint8_t* frames = GRPC_SLICE_START_PTR(protected_slices->slices[i]);
+    size_t frames_size = GRPC_SLICE_LENGTH(protected_slices->slices[i]);
+    while (frames_size > 0) {
+      int written_into_ssl = BIO_write(
+          network_io, frames,
+          static_cast<int>(std::min(frames_size, static_cast<size_t>(INT_MAX))));
+      if (written_into_ssl > 0) {
+        frames += written_into_ssl;
+        frames_size -= static_cast<size_t>(written_into_ssl);
+        continue;
+      }
+      // |network_io| is full: make room by decrypting the complete frames it
+      // holds. It is large enough for any single frame.
+      result = MoveUnprotectedRecordsToSlices(ssl, unprotected_slices);
+      if (result != TSI_OK) return result;
+      if (BIO_get_write_guarantee(network_io) == 0) {
+        gpr_log(GPR_ERROR, "Sending protected frame to ssl failed with %d",
+                written_into_ssl);
+        return TSI_INTERNAL_ERROR;
+      }
+    }
+  }
+  grpc_slice_buffer_reset_and_unref(protected_slices);
+  result = MoveUnprotectedRecordsToSlices(ssl, unprotected_slices);
+  if (result != TSI_OK) return result;
+  if (min_progress_size != nullptr) {
+    // The amount |ssl| asked for when it ran out of data, i.e. the rest of
+    // the frame being assembled.
+    size_t read_request = BIO_ctrl_get_read_request(network_io);
+    *min_progress_size = static_cast<int>(
+        std::max<size_t>(1, std::min<size_t>(read_request, INT_MAX)));
+  }
+  return TSI_OK;
+}
+
 bool VerifyCrlSignature(X509_CRL* crl, X509* issuer) {
   if (issuer == nullptr || crl == nullptr) {
     return false;
@@ -26,6 +26,7 @@
 #include "absl/strings/string_view.h"
 
 #include <grpc/grpc_security_constants.h>
+#include <grpc/slice_buffer.h>
 #include <grpc/support/port_platform.h>
 
 #include "src/core/tsi/ssl/key_logging/ssl_key_logging.h"
@@ -143,6 +144,48 @@ tsi_result SslProtectorUnprotect(const unsigned char* protected_frames_bytes,
                                  unsigned char* unprotected_bytes,
                                  size_t* unprotected_bytes_size);
 
+// Builds TLS frames out of all the plaintext in |unprotected_slices| and
+// appends them to |protected_slices|, one slice per batch of frames. Slices
+// holding at least |max_payload_size| bytes are handed to |ssl| in place; only
+// runs of smaller slices are gathered into |gather_buffer| first, so that they
+// do not each end up in a record of their own.
+//
+// ssl: the |SSL| object that protects the data.
+// network_io: the |BIO| object associated with |ssl|.
+// max_payload_size: the maximum number of plaintext bytes in a TLS frame.
+// gather_buffer: scratch space of at least |max_payload_size| bytes.
+// unprotected_slices: the plaintext to be protected. It is emptied on success.
+// protected_slices: the TLS frames built out of the plaintext.
+//
+// return: TSI_OK if all the plaintext was protected. Returns corresponding TSI
+//         errors otherwise.
+tsi_result SslZeroCopyProtectorProtect(SSL* ssl, BIO* network_io,
+                                       size_t max_payload_size,
+                                       unsigned char* gather_buffer,
+                                       grpc_slice_buffer* unprotected_slices,
+                                       grpc_slice_buffer* protected_slices);
+
+// Extracts the plaintext of all the complete TLS frames in |protected_slices|
+// into |unprotected_slices|. Each record is decrypted into a slice of its exact
+// plaintext size. Bytes of an incomplete frame are kept by |ssl| until the
+// rest of the frame arrives.
+//
+// ssl: the |SSL| object that protects the data.
+// network_io: the |BIO| object associated with |ssl|.
+// protected_slices: the TLS frames to extract plaintext from. It is emptied on
+//                   success.
+// unprotected_slices: the plaintext extracted from the TLS frames.
+// min_progress_size: if not null, populated with the number of bytes still
+//                    needed before more plaintext can be extracted.
+//
+// return: TSI_OK if all complete frames were unprotected, including when there
+//         was not enough data to output anything. Returns corresponding TSI
+//         errors otherwise.
+tsi_result SslZeroCopyProtectorUnprotect(SSL* ssl, BIO* network_io,
+                                         grpc_slice_buffer* protected_slices,
+                                         grpc_slice_buffer* unprotected_slices,
+                                         int* min_progress_size);
+
 // Verifies that `crl` was signed by `issuer.
 // return: true if valid, false otherwise.
 bool VerifyCrlSignature(X509_CRL* crl, X509* issuer);
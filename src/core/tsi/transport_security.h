@@ -118,6 +118,10 @@ struct tsi_handshaker_result_vtable {
                                  const unsigned char** bytes,
                                  size_t* bytes_size);
   void (*destroy)(tsi_handshaker_result* self);
+  // May be null if the record layer cannot be handed to the kernel. Must be
+  // called before the frame protector is created.
+  tsi_result (*enable_kernel_tls)(const tsi_handshaker_result* self, int fd,
+                                  bool* tx, bool* rx);
 };
 struct tsi_handshaker_result {
   const tsi_handshaker_result_vtable* vtable;
@@ -34,6 +34,20 @@ tsi_result tsi_handshaker_result_create_zero_copy_grpc_protector(
       self, max_output_protected_frame_size, protector);
 }
 
+tsi_result tsi_handshaker_result_enable_kernel_tls(
+    const tsi_handshaker_result* self, int fd, bool* tx, bool* rx) {
+  if (self == nullptr || self->vtable == nullptr || tx == nullptr ||
+      rx == nullptr) {
+    return TSI_INVALID_ARGUMENT;
+  }
+  if (self->vtable->enable_kernel_tls == nullptr) {
+    *tx = false;
+    *rx = false;
+    return TSI_UNIMPLEMENTED;
+  }
+  return self->vtable->enable_kernel_tls(self, fd, tx, rx);
+}
+
 // --- tsi_zero_copy_grpc_protector common implementation. ---
 
 // Calls specific implementation after state/input validation.
@@ -31,6 +31,17 @@ tsi_result tsi_handshaker_result_create_zero_copy_grpc_protector(
     const tsi_handshaker_result* self, size_t* max_output_protected_frame_size,
     tsi_zero_copy_grpc_protector** protector);
 
+// This method tries to install the record protection keys of the handshake
+// into the kernel for the TCP socket fd (kernel TLS), so that the socket can be
+// read and/or written in plaintext. On input, *tx and *rx say which directions
+// the caller is willing to offload; on output, which directions the kernel has
+// taken over. Data in the offloaded directions must bypass the frame
+// protector. Returns TSI_UNIMPLEMENTED if the handshaker result does not
+// support kernel offload.
+// Must be called before the frame protector is created.
+tsi_result tsi_handshaker_result_enable_kernel_tls(
+    const tsi_handshaker_result* self, int fd, bool* tx, bool* rx);
+
 // -- tsi_zero_copy_grpc_protector object --
 
 // Outputs protected frames.
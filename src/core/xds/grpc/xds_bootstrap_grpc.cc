@@ -98,6 +98,7 @@ namespace {
 
 constexpr absl::string_view kServerFeatureIgnoreResourceDeletion =
     "ignore_resource_deletion";
+constexpr absl::string_view kServerFeatureDeltaAds = "delta_ads";
 
 }  // namespace
 
@@ -106,6 +107,11 @@ bool GrpcXdsBootstrap::GrpcXdsServer::IgnoreResourceDeletion() const {
              kServerFeatureIgnoreResourceDeletion)) != server_features_.end();
 }
 
+bool GrpcXdsBootstrap::GrpcXdsServer::UseDeltaAds() const {
+  return server_features_.find(std::string(kServerFeatureDeltaAds)) !=
+         server_features_.end();
+}
+
 bool GrpcXdsBootstrap::GrpcXdsServer::Equals(const XdsServer& other) const {
   const auto& o = static_cast<const GrpcXdsServer&>(other);
   return (server_uri_ == o.server_uri_ &&
@@ -184,7 +190,8 @@ void GrpcXdsBootstrap::GrpcXdsServer::JsonPostLoad(const Json& json,
         const Json::Array& array = it->second.array();
         for (const Json& feature_json : array) {
           if (feature_json.type() == Json::Type::kString &&
-              (feature_json.string() == kServerFeatureIgnoreResourceDeletion)) {
+              (feature_json.string() == kServerFeatureIgnoreResourceDeletion ||
+               feature_json.string() == kServerFeatureDeltaAds)) {
             server_features_.insert(feature_json.string());
           }
         }
@@ -81,6 +81,7 @@ class GrpcXdsBootstrap final : public XdsBootstrap {
     const std::string& server_uri() const override { return server_uri_; }
 
     bool IgnoreResourceDeletion() const override;
+    bool UseDeltaAds() const override;
 
     bool Equals(const XdsServer& other) const override;
 
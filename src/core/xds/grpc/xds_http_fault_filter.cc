@@ -218,6 +218,11 @@ const grpc_channel_filter* XdsHttpFaultFilter::channel_filter() const {
   return &FaultInjectionFilter::kFilter;
 }
 
+bool XdsHttpFaultFilter::IsActiveForCall(
+    const ServiceConfigCallData& call_config) const {
+  return FaultInjectionFilter::IsActiveForCall(call_config);
+}
+
 ChannelArgs XdsHttpFaultFilter::ModifyChannelArgs(
     const ChannelArgs& args) const {
   return args.Set(GRPC_ARG_PARSE_FAULT_INJECTION_METHOD_CONFIG, 1);
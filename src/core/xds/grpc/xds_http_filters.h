@@ -37,6 +37,7 @@
 #include "src/core/lib/gprpp/validation_errors.h"
 #include "src/core/lib/json/json.h"
 #include "src/core/lib/json/json_writer.h"
+#include "src/core/service_config/service_config_call_data.h"
 #include "src/core/xds/grpc/xds_common_types.h"
 #include "src/core/xds/xds_client/xds_resource_type.h"
 
@@ -98,6 +99,14 @@ class XdsHttpFilterImpl {
   // C-core channel filter implementation.
   virtual const grpc_channel_filter* channel_filter() const = 0;
 
+  // Returns whether the channel filter has anything to do for a call, given
+  // the service config generated for the call's route.  The filters that
+  // return false are left out of the call's stack.
+  virtual bool IsActiveForCall(
+      const ServiceConfigCallData& /*call_config*/) const {
+    return true;
+  }
+
   // Modifies channel args that may affect service config parsing (not
   // visible to the channel as a whole).
   virtual ChannelArgs ModifyChannelArgs(const ChannelArgs& args) const {
@@ -199,6 +199,11 @@ const grpc_channel_filter* XdsHttpStatefulSessionFilter::channel_filter()
   return &StatefulSessionFilter::kFilter;
 }
 
+bool XdsHttpStatefulSessionFilter::IsActiveForCall(
+    const ServiceConfigCallData& call_config) const {
+  return StatefulSessionFilter::IsActiveForCall(call_config);
+}
+
 ChannelArgs XdsHttpStatefulSessionFilter::ModifyChannelArgs(
     const ChannelArgs& args) const {
   return args.Set(GRPC_ARG_PARSE_STATEFUL_SESSION_METHOD_CONFIG, 1);
@@ -45,6 +45,8 @@ class XdsHttpStatefulSessionFilter final : public XdsHttpFilterImpl {
       const XdsResourceType::DecodeContext& context, XdsExtension extension,
       ValidationErrors* errors) const override;
   const grpc_channel_filter* channel_filter() const override;
+  bool IsActiveForCall(
+      const ServiceConfigCallData& call_config) const override;
   ChannelArgs ModifyChannelArgs(const ChannelArgs& args) const override;
   absl::StatusOr<ServiceConfigJsonEntry> GenerateServiceConfig(
       const FilterConfig& hcm_filter_config,
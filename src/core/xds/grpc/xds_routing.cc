@@ -28,8 +28,10 @@
 #include "absl/log/check.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
+#include "absl/strings/ascii.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
+#include "re2/re2.h"
 
 #include <grpc/support/log.h>
 #include <grpc/support/port_platform.h>
@@ -175,6 +177,169 @@ absl::optional<size_t> XdsRouting::GetRouteForRequest(
   return absl::nullopt;
 }
 
+//
+// XdsRouting::RouteIndex
+//
+
+void XdsRouting::RouteIndex::PathTable::Add(std::string key,
+                                            size_t route_index) {
+  auto it = std::lower_bound(key_sizes.begin(), key_sizes.end(), key.size());
+  if (it == key_sizes.end() || *it != key.size()) {
+    key_sizes.insert(it, key.size());
+  }
+  routes[std::move(key)].push_back(route_index);
+}
+
+void XdsRouting::RouteIndex::PathTable::AddMatchingRoutes(
+    absl::string_view path, bool prefix,
+    std::vector<size_t>* route_indexes) const {
+  if (routes.empty()) return;
+  auto add = [&](absl::string_view key) {
+    auto it = routes.find(key);
+    if (it == routes.end()) return;
+    route_indexes->insert(route_indexes->end(), it->second.begin(),
+                          it->second.end());
+  };
+  if (!prefix) {
+    add(path);
+    return;
+  }
+  for (size_t key_size : key_sizes) {
+    if (key_size > path.size()) break;
+    add(path.substr(0, key_size));
+  }
+}
+
+XdsRouting::RouteIndex::RouteIndex(
+    const RouteListIterator& route_list_iterator, int64_t regex_set_max_mem) {
+  // Like the regex matchers, the set uses the default options otherwise.
+  RE2::Options regex_set_options;
+  regex_set_options.set_max_mem(regex_set_max_mem);
+  auto regex_set =
+      std::make_unique<RE2::Set>(regex_set_options, RE2::ANCHOR_BOTH);
+  path_only_.reserve(route_list_iterator.Size());
+  for (size_t i = 0; i < route_list_iterator.Size(); ++i) {
+    const XdsRouteConfigResource::Route::Matchers& matchers =
+        route_list_iterator.GetMatchersForRoute(i);
+    path_only_.push_back(matchers.header_matchers.empty() &&
+                         !matchers.fraction_per_million.has_value());
+    const StringMatcher& path_matcher = matchers.path_matcher;
+    switch (path_matcher.type()) {
+      case StringMatcher::Type::kExact:
+        if (path_matcher.case_sensitive()) {
+          exact_.Add(path_matcher.string_matcher(), i);
+        } else {
+          exact_ignore_case_.Add(
+              absl::AsciiStrToLower(path_matcher.string_matcher()), i);
+        }
+        break;
+      case StringMatcher::Type::kPrefix:
+        if (path_matcher.case_sensitive()) {
+          prefix_.Add(path_matcher.string_matcher(), i);
+        } else {
+          prefix_ignore_case_.Add(
+              absl::AsciiStrToLower(path_matcher.string_matcher()), i);
+        }
+        break;
+      case StringMatcher::Type::kSafeRegex:
+        if (regex_set->Add(path_matcher.regex_matcher()->pattern(), nullptr) ==
+            static_cast<int>(regex_routes_.size())) {
+          regex_routes_.push_back(i);
+        } else {
+          other_routes_.push_back(i);
+        }
+        break;
+      default:
+        other_routes_.push_back(i);
+        break;
+    }
+  }
+  // If the set runs out of memory, the regexes are matched one by one.
+  if (!regex_routes_.empty() && regex_set->Compile()) {
+    regex_set_ = std::move(regex_set);
+  }
+}
+
+void XdsRouting::RouteIndex::AddMatchingRegexRoutes(
+    const RouteListIterator& route_list_iterator, absl::string_view path,
+    std::vector<size_t>* route_indexes) const {
+  for (size_t route_index : regex_routes_) {
+    if (route_list_iterator.GetMatchersForRoute(route_index)
+            .path_matcher.Match(path)) {
+      route_indexes->push_back(route_index);
+    }
+  }
+}
+
+std::vector<size_t> XdsRouting::RouteIndex::GetCandidates(
+    const RouteListIterator& route_list_iterator,
+    absl::string_view path) const {
+  std::vector<size_t> candidates;
+  exact_.AddMatchingRoutes(path, /*prefix=*/false, &candidates);
+  prefix_.AddMatchingRoutes(path, /*prefix=*/true, &candidates);
+  if (!exact_ignore_case_.routes.empty() ||
+      !prefix_ignore_case_.routes.empty()) {
+    std::string lower_case_path = absl::AsciiStrToLower(path);
+    exact_ignore_case_.AddMatchingRoutes(lower_case_path, /*prefix=*/false,
+                                         &candidates);
+    prefix_ignore_case_.AddMatchingRoutes(lower_case_path, /*prefix=*/true,
+                                          &candidates);
+  }
+  if (regex_set_ != nullptr) {
+    std::vector<int> matching_regexes;
+    RE2::Set::ErrorInfo error_info;
+    if (regex_set_->Match(re2::StringPiece(path.data(), path.size()),
+                          &matching_regexes, &error_info)) {
+      for (int regex_index : matching_regexes) {
+        candidates.push_back(regex_routes_[regex_index]);
+      }
+    } else if (error_info.kind != RE2::Set::kNoError) {
+      // The DFA of the set ran out of memory, so its result says nothing
+      // about which regexes match.
+      AddMatchingRegexRoutes(route_list_iterator, path, &candidates);
+    }
+  } else {
+    AddMatchingRegexRoutes(route_list_iterator, path, &candidates);
+  }
+  for (size_t route_index : other_routes_) {
+    if (route_list_iterator.GetMatchersForRoute(route_index)
+            .path_matcher.Match(path)) {
+      candidates.push_back(route_index);
+    }
+  }
+  std::sort(candidates.begin(), candidates.end());
+  return candidates;
+}
+
+absl::optional<size_t> XdsRouting::RouteIndex::GetRouteForRequest(
+    const RouteListIterator& route_list_iterator, absl::string_view path,
+    grpc_metadata_batch* initial_metadata) const {
+  // Check the rest of the matchers of the candidates, like
+  // GetRouteForRequest() does.
+  for (size_t route_index : GetCandidates(route_list_iterator, path)) {
+    if (path_only_[route_index]) return route_index;
+    const XdsRouteConfigResource::Route::Matchers& matchers =
+        route_list_iterator.GetMatchersForRoute(route_index);
+    if (HeadersMatch(matchers.header_matchers, initial_metadata) &&
+        (!matchers.fraction_per_million.has_value() ||
+         UnderFraction(*matchers.fraction_per_million))) {
+      return route_index;
+    }
+  }
+  return absl::nullopt;
+}
+
+absl::optional<size_t> XdsRouting::RouteIndex::GetRouteForPath(
+    const RouteListIterator& route_list_iterator,
+    absl::string_view path) const {
+  std::vector<size_t> candidates = GetCandidates(route_list_iterator, path);
+  // The first candidate is selected whenever it matches on the path alone.
+  if (candidates.empty() || !path_only_[candidates.front()]) {
+    return absl::nullopt;
+  }
+  return candidates.front();
+}
+
 bool XdsRouting::IsValidDomainPattern(absl::string_view domain_pattern) {
   return DomainPatternMatchType(domain_pattern) != INVALID_MATCH;
 }
@@ -20,14 +20,18 @@
 #define GRPC_SRC_CORE_XDS_GRPC_XDS_ROUTING_H
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
+#include "re2/set.h"
 
 #include <grpc/support/port_platform.h>
 
@@ -61,6 +65,80 @@ class XdsRouting final {
         size_t index) const = 0;
   };
 
+  // A compiled form of the path matchers of a route list, built once when a
+  // route config is received. Finds the routes whose path matcher matches a
+  // path with a hash lookup for the exact paths, one per distinct prefix size
+  // for the prefixes and a single RE2::Set match for all the regexes, instead
+  // of evaluating the path matchers of all the routes one after the other.
+  class RouteIndex {
+   public:
+    RouteIndex() = default;
+    explicit RouteIndex(const RouteListIterator& route_list_iterator)
+        : RouteIndex(route_list_iterator, RE2::Options().max_mem()) {}
+    // Same, but with regex_set_max_mem bytes for the regex set instead of
+    // the RE2 default. For tests.
+    RouteIndex(const RouteListIterator& route_list_iterator,
+               int64_t regex_set_max_mem);
+
+    RouteIndex(const RouteIndex&) = delete;
+    RouteIndex& operator=(const RouteIndex&) = delete;
+    RouteIndex(RouteIndex&&) = default;
+    RouteIndex& operator=(RouteIndex&&) = default;
+
+    // Same as XdsRouting::GetRouteForRequest(), for the route list that the
+    // index was built from. The index is immutable, so this may be called
+    // concurrently without synchronization.
+    absl::optional<size_t> GetRouteForRequest(
+        const RouteListIterator& route_list_iterator, absl::string_view path,
+        grpc_metadata_batch* initial_metadata) const;
+
+    // Returns the route that GetRouteForRequest() selects for every request
+    // on path, or nullopt if none matches or the choice depends on the rest
+    // of the request.
+    absl::optional<size_t> GetRouteForPath(
+        const RouteListIterator& route_list_iterator,
+        absl::string_view path) const;
+
+   private:
+    // Routes keyed by exact path or by path prefix.
+    struct PathTable {
+      absl::flat_hash_map<std::string, std::vector<size_t>> routes;
+      // Distinct sizes of the keys in routes, in increasing order. Only
+      // used for prefixes.
+      std::vector<size_t> key_sizes;
+
+      void Add(std::string key, size_t route_index);
+      void AddMatchingRoutes(absl::string_view path, bool prefix,
+                             std::vector<size_t>* route_indexes) const;
+    };
+
+    // Returns the routes whose path matcher matches path, in the order of
+    // the list.
+    std::vector<size_t> GetCandidates(
+        const RouteListIterator& route_list_iterator,
+        absl::string_view path) const;
+    // Adds the routes of regex_routes_ whose regex fully matches path, one
+    // regex at a time.
+    void AddMatchingRegexRoutes(const RouteListIterator& route_list_iterator,
+                                absl::string_view path,
+                                std::vector<size_t>* route_indexes) const;
+
+    PathTable exact_;
+    PathTable exact_ignore_case_;
+    PathTable prefix_;
+    PathTable prefix_ignore_case_;
+    // Null if there are no regex routes or the set ran out of memory when
+    // compiling.
+    std::unique_ptr<RE2::Set> regex_set_;
+    // Route indexes of the patterns in regex_set_, or of the regexes to match
+    // one by one without it.
+    std::vector<size_t> regex_routes_;
+    // Routes whose path matcher is evaluated directly.
+    std::vector<size_t> other_routes_;
+    // Whether each route has neither header matchers nor a runtime fraction.
+    std::vector<bool> path_only_;
+  };
+
   // Returns the index of the selected virtual host in the list.
   static absl::optional<size_t> FindVirtualHostForDomain(
       const VirtualHostListIterator& vhost_iterator, absl::string_view domain);
@@ -50,7 +50,8 @@ class XdsClient;
 // - CSDS response generation
 class XdsApi final {
  public:
-  // Interface defined by caller and passed to ParseAdsResponse().
+  // Interface defined by caller and passed to ParseAdsResponse() and
+  // ParseDeltaAdsResponse().
   class AdsResponseParserInterface {
    public:
     struct AdsResponseFields {
@@ -58,6 +59,8 @@ class XdsApi final {
       std::string version;
       std::string nonce;
       size_t num_resources;
+      // Names of the resources removed by a delta response.
+      std::vector<std::string> removed_resources;
     };
 
     virtual ~AdsResponseParserInterface() = default;
@@ -69,10 +72,12 @@ class XdsApi final {
 
     // Called to parse each individual resource in the ADS response.
     // Note that resource_name is non-empty only when the resource was
-    // wrapped in a Resource wrapper proto.
+    // wrapped in a Resource wrapper proto, and resource_version is non-empty
+    // only in delta responses, where each resource has its own version.
     virtual void ParseResource(upb_Arena* arena, size_t idx,
                                absl::string_view type_url,
                                absl::string_view resource_name,
+                               absl::string_view resource_version,
                                absl::string_view serialized_resource) = 0;
 
     // Called when a resource is wrapped in a Resource wrapper proto but
@@ -155,11 +160,27 @@ class XdsApi final {
                                const std::vector<std::string>& resource_names,
                                absl::Status status, bool populate_node);
 
+  // Creates an incremental (delta) ADS request. Unlike state-of-the-world
+  // requests, it only lists the subscriptions that changed since the
+  // previous request for the type. initial_resource_versions is sent on the
+  // first request of a stream so that the server does not resend the cached
+  // resources that did not change.
+  std::string CreateDeltaAdsRequest(
+      absl::string_view type_url, absl::string_view nonce,
+      const std::vector<std::string>& resource_names_subscribe,
+      const std::vector<std::string>& resource_names_unsubscribe,
+      const std::map<std::string, std::string>& initial_resource_versions,
+      absl::Status status, bool populate_node);
+
   // Returns non-OK when failing to deserialize response message.
   // Otherwise, all events are reported to the parser.
   absl::Status ParseAdsResponse(absl::string_view encoded_response,
                                 AdsResponseParserInterface* parser);
 
+  // Same as ParseAdsResponse(), for an incremental (delta) ADS response.
+  absl::Status ParseDeltaAdsResponse(absl::string_view encoded_response,
+                                     AdsResponseParserInterface* parser);
+
   // Creates an initial LRS request.
   std::string CreateLrsInitialRequest();
 
@@ -47,6 +47,8 @@ class XdsBootstrap {
 
     virtual const std::string& server_uri() const = 0;
     virtual bool IgnoreResourceDeletion() const = 0;
+    // Whether to use the incremental (delta) variant of the ADS protocol.
+    virtual bool UseDeltaAds() const = 0;
 
     virtual bool Equals(const XdsServer& other) const = 0;
 
@@ -20,8 +20,12 @@
 #include <string.h>
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
+#include <iterator>
+#include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -41,8 +45,10 @@
 #include "google/protobuf/timestamp.upb.h"
 #include "upb/base/string_view.h"
 #include "upb/mem/arena.h"
+#include "upb/mem/arena.hpp"
 
 #include <grpc/event_engine/event_engine.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
 #include <grpc/support/port_platform.h>
 
@@ -63,6 +69,7 @@
 #define GRPC_XDS_RECONNECT_MAX_BACKOFF_SECONDS 120
 #define GRPC_XDS_RECONNECT_JITTER 0.2
 #define GRPC_XDS_MIN_CLIENT_LOAD_REPORTING_INTERVAL_MS 1000
+#define GRPC_XDS_MIN_RESOURCES_PER_DECODE_WORKER 16
 
 namespace grpc_core {
 
@@ -143,9 +150,16 @@ class XdsClient::XdsChannel::AdsCall final
  private:
   class AdsReadDelayHandle;
 
-  class AdsResponseParser final : public XdsApi::AdsResponseParserInterface {
+  // Parses ADS responses in three steps: the response is parsed under
+  // XdsClient::mu_, its resources are then decoded without holding the lock
+  // (on several EventEngine threads for large responses), and they are
+  // finally committed to the cache under the lock again, by
+  // OnResourcesDecoded().
+  class AdsResponseParser final : public XdsApi::AdsResponseParserInterface,
+                                  public RefCounted<AdsResponseParser> {
    public:
     struct Result {
+      absl::Status status;
       const XdsResourceType* type;
       std::string type_url;
       std::string version;
@@ -153,31 +167,64 @@ class XdsClient::XdsChannel::AdsCall final
       std::vector<std::string> errors;
       std::map<std::string /*authority*/, std::set<XdsResourceKey>>
           resources_seen;
+      std::vector<std::string> removed_resources;
       uint64_t num_valid_resources = 0;
       uint64_t num_invalid_resources = 0;
       RefCountedPtr<ReadDelayHandle> read_delay_handle;
     };
 
-    explicit AdsResponseParser(AdsCall* ads_call) : ads_call_(ads_call) {}
+    explicit AdsResponseParser(RefCountedPtr<AdsCall> ads_call)
+        : ads_call_(std::move(ads_call)) {}
+
+    void ParseLocked(absl::string_view payload)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
 
     absl::Status ProcessAdsResponseFields(AdsResponseFields fields) override
         ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
 
     void ParseResource(upb_Arena* arena, size_t idx, absl::string_view type_url,
                        absl::string_view resource_name,
+                       absl::string_view resource_version,
                        absl::string_view serialized_resource) override
         ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
 
     void ResourceWrapperParsingFailed(size_t idx,
                                       absl::string_view message) override;
 
+    // Decodes the resources, then calls AdsCall::OnResourcesDecoded().
+    void DecodeResources() ABSL_LOCKS_EXCLUDED(&XdsClient::mu_);
+
+    void CommitResourcesLocked()
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+
     Result TakeResult() { return std::move(result_); }
 
    private:
+    struct Resource {
+      size_t idx;
+      std::string name;
+      std::string version;
+      std::string serialized_resource;
+      // Set if the resource could not be extracted from the response.
+      std::string error;
+      XdsResourceType::DecodeResult decode_result;
+    };
+
     XdsClient* xds_client() const { return ads_call_->xds_client(); }
 
-    AdsCall* ads_call_;
+    void DecodeResourcesWorker() ABSL_LOCKS_EXCLUDED(&XdsClient::mu_);
+
+    void CommitResourceLocked(Resource& resource)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+
+    RefCountedPtr<AdsCall> ads_call_;
     const Timestamp update_time_ = Timestamp::Now();
+    // The defs of the resource type, which may be used without holding
+    // the lock.
+    upb_DefPool* def_pool_ = nullptr;
+    std::vector<Resource> resources_;
+    std::atomic<size_t> next_resource_{0};
+    std::atomic<size_t> pending_workers_{0};
     Result result_;
   };
 
@@ -321,13 +368,43 @@ class XdsClient::XdsChannel::AdsCall final
     std::map<std::string /*authority*/,
              std::map<XdsResourceKey, OrphanablePtr<ResourceTimer>>>
         subscribed_resources;
+
+    // Delta ADS only: the names of the resources that the server knows we
+    // are subscribed to, and whether we sent a request for this type yet.
+    std::set<std::string> delta_subscribed_resource_names;
+    bool delta_request_sent = false;
   };
 
+  bool use_delta_ads() const { return xds_channel()->server_.UseDeltaAds(); }
+
   void SendMessageLocked(const XdsResourceType* type)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+  // Creates the delta ADS request for the changes in the subscriptions of
+  // the given type. Returns an empty string if there is nothing to send.
+  std::string CreateDeltaRequestLocked(const XdsResourceType* type,
+                                       ResourceTypeState& state)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+
+  // Cancels the resource-does-not-exist timer of a resource, if needed.
+  void MarkResourceSeenLocked(const XdsResourceType* type,
+                              const XdsResourceName& name)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+  // Handles the deletion of a resource by the xDS server.
+  void OnResourceDeletedLocked(
+      const XdsResourceType* type, const std::string& authority,
+      const XdsResourceKey& resource_key, ResourceState& resource_state,
+      const RefCountedPtr<ReadDelayHandle>& read_delay_handle)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+  // Handles the resources removed by a delta ADS response.
+  void OnResourcesRemovedLocked(
+      const XdsResourceType* type,
+      const std::vector<std::string>& removed_resources,
+      const RefCountedPtr<ReadDelayHandle>& read_delay_handle)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
 
   void OnRequestSent(bool ok);
   void OnRecvMessage(absl::string_view payload);
+  void OnResourcesDecoded(AdsResponseParser* parser);
   void OnStatusReceived(absl::Status status);
 
   bool IsCurrentCallOnChannel() const;
@@ -816,6 +893,9 @@ XdsClient::XdsChannel::AdsCall::AdsResponseParser::ProcessAdsResponseFields(
   result_.type_url = std::move(fields.type_url);
   result_.version = std::move(fields.version);
   result_.nonce = std::move(fields.nonce);
+  result_.removed_resources = std::move(fields.removed_resources);
+  def_pool_ =
+      ads_call_->xds_client()->resource_type_def_pools_[result_.type].ptr();
   result_.read_delay_handle =
       MakeRefCounted<AdsReadDelayHandle>(ads_call_->Ref());
   return absl::OkStatus();
@@ -847,33 +927,108 @@ void UpdateResourceMetadataNacked(const std::string& version,
 
 }  // namespace
 
+void XdsClient::XdsChannel::AdsCall::AdsResponseParser::ParseLocked(
+    absl::string_view payload) {
+  result_.status =
+      ads_call_->use_delta_ads()
+          ? xds_client()->api_.ParseDeltaAdsResponse(payload, this)
+          : xds_client()->api_.ParseAdsResponse(payload, this);
+}
+
 void XdsClient::XdsChannel::AdsCall::AdsResponseParser::ParseResource(
-    upb_Arena* arena, size_t idx, absl::string_view type_url,
-    absl::string_view resource_name, absl::string_view serialized_resource) {
-  std::string error_prefix = absl::StrCat(
-      "resource index ", idx, ": ",
-      resource_name.empty() ? "" : absl::StrCat(resource_name, ": "));
+    upb_Arena* /*arena*/, size_t idx, absl::string_view type_url,
+    absl::string_view resource_name, absl::string_view resource_version,
+    absl::string_view serialized_resource) {
+  Resource resource;
+  resource.idx = idx;
+  resource.name = std::string(resource_name);
   // Check the type_url of the resource.
   if (result_.type_url != type_url) {
-    result_.errors.emplace_back(
-        absl::StrCat(error_prefix, "incorrect resource type \"", type_url,
-                     "\" (should be \"", result_.type_url, "\")"));
+    resource.error = absl::StrCat(
+        "resource index ", idx, ": ",
+        resource_name.empty() ? "" : absl::StrCat(resource_name, ": "),
+        "incorrect resource type \"", type_url, "\" (should be \"",
+        result_.type_url, "\")");
+  } else {
+    resource.version = std::string(resource_version);
+    resource.serialized_resource = std::string(serialized_resource);
+  }
+  resources_.push_back(std::move(resource));
+}
+
+void XdsClient::XdsChannel::AdsCall::AdsResponseParser::
+    ResourceWrapperParsingFailed(size_t idx, absl::string_view message) {
+  Resource resource;
+  resource.idx = idx;
+  resource.error = absl::StrCat("resource index ", idx, ": ", message);
+  resources_.push_back(std::move(resource));
+}
+
+void XdsClient::XdsChannel::AdsCall::AdsResponseParser::DecodeResources() {
+  // Decode the resources of small responses on the current thread, and
+  // spread those of larger ones over the EventEngine threads.
+  const size_t num_workers = std::max<size_t>(
+      1, std::min<size_t>(gpr_cpu_num_cores(),
+                          resources_.size() /
+                              GRPC_XDS_MIN_RESOURCES_PER_DECODE_WORKER));
+  pending_workers_.store(num_workers, std::memory_order_relaxed);
+  for (size_t i = 1; i < num_workers; ++i) {
+    xds_client()->engine()->Run(
+        [self = Ref(DEBUG_LOCATION, "DecodeResourcesWorker")]() {
+          ApplicationCallbackExecCtx callback_exec_ctx;
+          ExecCtx exec_ctx;
+          self->DecodeResourcesWorker();
+        });
+  }
+  DecodeResourcesWorker();
+}
+
+void XdsClient::XdsChannel::AdsCall::AdsResponseParser::
+    DecodeResourcesWorker() {
+  for (size_t i = next_resource_.fetch_add(1, std::memory_order_relaxed);
+       i < resources_.size();
+       i = next_resource_.fetch_add(1, std::memory_order_relaxed)) {
+    Resource& resource = resources_[i];
+    if (!resource.error.empty()) continue;
+    upb::Arena arena;
+    XdsResourceType::DecodeContext context = {
+        xds_client(), ads_call_->xds_channel()->server_,
+        &grpc_xds_client_trace, def_pool_, arena.ptr()};
+    resource.decode_result =
+        result_.type->Decode(context, resource.serialized_resource);
+  }
+  // The last worker to finish hands the resources over to the ADS call.
+  if (pending_workers_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    ads_call_->OnResourcesDecoded(this);
+  }
+}
+
+void XdsClient::XdsChannel::AdsCall::AdsResponseParser::
+    CommitResourcesLocked() {
+  for (Resource& resource : resources_) {
+    CommitResourceLocked(resource);
+  }
+}
+
+void XdsClient::XdsChannel::AdsCall::AdsResponseParser::CommitResourceLocked(
+    Resource& resource) {
+  if (!resource.error.empty()) {
+    result_.errors.push_back(std::move(resource.error));
     ++result_.num_invalid_resources;
     return;
   }
-  // Parse the resource.
-  XdsResourceType::DecodeContext context = {
-      xds_client(), ads_call_->xds_channel()->server_, &grpc_xds_client_trace,
-      xds_client()->def_pool_.ptr(), arena};
-  XdsResourceType::DecodeResult decode_result =
-      result_.type->Decode(context, serialized_resource);
+  std::string& resource_name = resource.name;
+  std::string error_prefix = absl::StrCat(
+      "resource index ", resource.idx, ": ",
+      resource_name.empty() ? "" : absl::StrCat(resource_name, ": "));
+  XdsResourceType::DecodeResult& decode_result = resource.decode_result;
   // If we didn't already have the resource name from the Resource
   // wrapper, try to get it from the decoding result.
   if (resource_name.empty()) {
     if (decode_result.name.has_value()) {
       resource_name = *decode_result.name;
-      error_prefix =
-          absl::StrCat("resource index ", idx, ": ", resource_name, ": ");
+      error_prefix = absl::StrCat("resource index ", resource.idx, ": ",
+                                  resource_name, ": ");
     } else {
       // We don't have any way of determining the resource name, so
       // there's nothing more we can do here.
@@ -899,17 +1054,7 @@ void XdsClient::XdsChannel::AdsCall::AdsResponseParser::ParseResource(
     return;
   }
   // Cancel resource-does-not-exist timer, if needed.
-  auto timer_it = ads_call_->state_map_.find(result_.type);
-  if (timer_it != ads_call_->state_map_.end()) {
-    auto it = timer_it->second.subscribed_resources.find(
-        parsed_resource_name->authority);
-    if (it != timer_it->second.subscribed_resources.end()) {
-      auto res_it = it->second.find(parsed_resource_name->key);
-      if (res_it != it->second.end()) {
-        res_it->second->MarkSeen();
-      }
-    }
-  }
+  ads_call_->MarkResourceSeenLocked(result_.type, *parsed_resource_name);
   // Lookup the authority in the cache.
   auto authority_it =
       xds_client()->authority_state_map_.find(parsed_resource_name->authority);
@@ -943,9 +1088,13 @@ void XdsClient::XdsChannel::AdsCall::AdsResponseParser::ParseResource(
             "name %s",
             xds_client(),
             ads_call_->xds_channel()->server_.server_uri().c_str(),
-            std::string(type_url).c_str(), std::string(resource_name).c_str());
+            result_.type_url.c_str(), resource_name.c_str());
     resource_state.ignored_deletion = false;
   }
+  // Delta responses have a version per resource.
+  const bool has_resource_version = !resource.version.empty();
+  std::string version = has_resource_version ? std::move(resource.version)
+                                             : result_.version;
   // Update resource state based on whether the resource is valid.
   if (!decode_status.ok()) {
     xds_client()->NotifyWatchersOnErrorLocked(
@@ -953,7 +1102,7 @@ void XdsClient::XdsChannel::AdsCall::AdsResponseParser::ParseResource(
         absl::UnavailableError(
             absl::StrCat("invalid resource: ", decode_status.ToString())),
         result_.read_delay_handle);
-    UpdateResourceMetadataNacked(result_.version, decode_status.ToString(),
+    UpdateResourceMetadataNacked(version, decode_status.ToString(),
                                  update_time_, &resource_state.meta);
     ++result_.num_invalid_resources;
     return;
@@ -967,15 +1116,18 @@ void XdsClient::XdsChannel::AdsCall::AdsResponseParser::ParseResource(
     if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_client_trace)) {
       gpr_log(GPR_INFO,
               "[xds_client %p] %s resource %s identical to current, ignoring.",
-              xds_client(), result_.type_url.c_str(),
-              std::string(resource_name).c_str());
+              xds_client(), result_.type_url.c_str(), resource_name.c_str());
     }
+    // Keep track of the latest version, so that it is the one we send when
+    // resuming a delta ADS stream.
+    if (has_resource_version) resource_state.meta.version = std::move(version);
     return;
   }
   // Update the resource state.
   resource_state.resource = std::move(*decode_result.resource);
   resource_state.meta = CreateResourceMetadataAcked(
-      std::string(serialized_resource), result_.version, update_time_);
+      std::move(resource.serialized_resource), std::move(version),
+      update_time_);
   // Notify watchers.
   auto& watchers_list = resource_state.watchers;
   xds_client()->work_serializer_.Schedule(
@@ -989,13 +1141,6 @@ void XdsClient::XdsChannel::AdsCall::AdsResponseParser::ParseResource(
       DEBUG_LOCATION);
 }
 
-void XdsClient::XdsChannel::AdsCall::AdsResponseParser::
-    ResourceWrapperParsingFailed(size_t idx, absl::string_view message) {
-  result_.errors.emplace_back(
-      absl::StrCat("resource index ", idx, ": ", message));
-  ++result_.num_invalid_resources;
-}
-
 //
 // XdsClient::XdsChannel::AdsCall
 //
@@ -1009,8 +1154,11 @@ XdsClient::XdsChannel::AdsCall::AdsCall(
   CHECK_NE(xds_client(), nullptr);
   // Init the ADS call.
   const char* method =
-      "/envoy.service.discovery.v3.AggregatedDiscoveryService/"
-      "StreamAggregatedResources";
+      use_delta_ads()
+          ? "/envoy.service.discovery.v3.AggregatedDiscoveryService/"
+            "DeltaAggregatedResources"
+          : "/envoy.service.discovery.v3.AggregatedDiscoveryService/"
+            "StreamAggregatedResources";
   streaming_call_ = xds_channel()->transport_->CreateStreamingCall(
       method, std::make_unique<StreamEventHandler>(
                   // Passing the initial ref here.  This ref will go away when
@@ -1067,6 +1215,17 @@ void XdsClient::XdsChannel::AdsCall::SendMessageLocked(
     return;
   }
   auto& state = state_map_[type];
+  if (use_delta_ads()) {
+    std::string serialized_message = CreateDeltaRequestLocked(type, state);
+    if (serialized_message.empty()) return;
+    sent_initial_message_ = true;
+    // Each response is ACKed or NACKed only once.
+    state.nonce.clear();
+    state.status = absl::OkStatus();
+    streaming_call_->SendMessage(std::move(serialized_message));
+    send_message_pending_ = type;
+    return;
+  }
   std::string serialized_message = xds_client()->api_.CreateAdsRequest(
       type->type_url(), xds_channel()->resource_type_version_map_[type],
       state.nonce, ResourceNamesForRequest(type), state.status,
@@ -1086,6 +1245,65 @@ void XdsClient::XdsChannel::AdsCall::SendMessageLocked(
   send_message_pending_ = type;
 }
 
+std::string XdsClient::XdsChannel::AdsCall::CreateDeltaRequestLocked(
+    const XdsResourceType* type, ResourceTypeState& state) {
+  std::vector<std::string> resource_names = ResourceNamesForRequest(type);
+  std::set<std::string> subscribed_resource_names(resource_names.begin(),
+                                                  resource_names.end());
+  std::vector<std::string> subscribe;
+  std::set_difference(subscribed_resource_names.begin(),
+                      subscribed_resource_names.end(),
+                      state.delta_subscribed_resource_names.begin(),
+                      state.delta_subscribed_resource_names.end(),
+                      std::back_inserter(subscribe));
+  std::vector<std::string> unsubscribe;
+  std::set_difference(state.delta_subscribed_resource_names.begin(),
+                      state.delta_subscribed_resource_names.end(),
+                      subscribed_resource_names.begin(),
+                      subscribed_resource_names.end(),
+                      std::back_inserter(unsubscribe));
+  if (state.delta_request_sent && subscribe.empty() && unsubscribe.empty() &&
+      state.nonce.empty() && state.status.ok()) {
+    return "";
+  }
+  // On the first request of the stream, tell the server which versions of
+  // the resources we already have, so that it does not resend them.
+  std::map<std::string, std::string> initial_resource_versions;
+  if (!state.delta_request_sent) {
+    for (const auto& a : state.subscribed_resources) {
+      const std::string& authority = a.first;
+      auto authority_it = xds_client()->authority_state_map_.find(authority);
+      if (authority_it == xds_client()->authority_state_map_.end()) continue;
+      auto type_it = authority_it->second.resource_map.find(type);
+      if (type_it == authority_it->second.resource_map.end()) continue;
+      for (const auto& r : a.second) {
+        auto it = type_it->second.find(r.first);
+        if (it == type_it->second.end() || it->second.resource == nullptr ||
+            it->second.meta.version.empty()) {
+          continue;
+        }
+        initial_resource_versions[XdsClient::ConstructFullXdsResourceName(
+            authority, type->type_url(), r.first)] = it->second.meta.version;
+      }
+    }
+  }
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_client_trace)) {
+    gpr_log(GPR_INFO,
+            "[xds_client %p] xds server %s: sending delta ADS request: "
+            "type=%s subscribe=%" PRIuPTR " unsubscribe=%" PRIuPTR
+            " initial_versions=%" PRIuPTR " nonce=%s error=%s",
+            xds_client(), xds_channel()->server_.server_uri().c_str(),
+            std::string(type->type_url()).c_str(), subscribe.size(),
+            unsubscribe.size(), initial_resource_versions.size(),
+            state.nonce.c_str(), state.status.ToString().c_str());
+  }
+  state.delta_subscribed_resource_names = std::move(subscribed_resource_names);
+  state.delta_request_sent = true;
+  return xds_client()->api_.CreateDeltaAdsRequest(
+      type->type_url(), state.nonce, subscribe, unsubscribe,
+      initial_resource_versions, state.status, !sent_initial_message_);
+}
+
 void XdsClient::XdsChannel::AdsCall::SubscribeLocked(
     const XdsResourceType* type, const XdsResourceName& name, bool delay_send) {
   auto& state = state_map_[type].subscribed_resources[name.authority][name.key];
@@ -1143,33 +1361,48 @@ void XdsClient::XdsChannel::AdsCall::OnRequestSent(bool ok) {
     // order of resource types. We need to fix this if we are seeing some
     // resource type(s) starved due to frequent requests of other resource
     // type(s).
-    auto it = buffered_requests_.begin();
-    if (it != buffered_requests_.end()) {
-      SendMessageLocked(*it);
-      buffered_requests_.erase(it);
+    // With delta ADS, there may be nothing left to send for some types.
+    while (send_message_pending_ == nullptr && !buffered_requests_.empty()) {
+      const XdsResourceType* type = *buffered_requests_.begin();
+      buffered_requests_.erase(buffered_requests_.begin());
+      SendMessageLocked(type);
     }
   }
 }
 
 void XdsClient::XdsChannel::AdsCall::OnRecvMessage(absl::string_view payload) {
+  auto parser = MakeRefCounted<AdsResponseParser>(
+      Ref(DEBUG_LOCATION, "AdsResponseParser"));
+  {
+    MutexLock lock(&xds_client()->mu_);
+    if (!IsCurrentCallOnChannel()) return;
+    // Parse the response.
+    parser->ParseLocked(payload);
+  }
+  // Decode the resources without holding the lock, so that decoding large
+  // responses does not block the other users of the XdsClient.
+  parser->DecodeResources();
+}
+
+void XdsClient::XdsChannel::AdsCall::OnResourcesDecoded(
+    AdsResponseParser* parser) {
   // Needs to be destroyed after the mutex is released.
   RefCountedPtr<ReadDelayHandle> read_delay_handle;
   {
     MutexLock lock(&xds_client()->mu_);
     if (!IsCurrentCallOnChannel()) return;
-    // Parse and validate the response.
-    AdsResponseParser parser(this);
-    absl::Status status = xds_client()->api_.ParseAdsResponse(payload, &parser);
+    // Validate the resources and update the cache.
+    parser->CommitResourcesLocked();
     // This includes a handle that will trigger an ADS read.
-    AdsResponseParser::Result result = parser.TakeResult();
+    AdsResponseParser::Result result = parser->TakeResult();
     read_delay_handle = std::move(result.read_delay_handle);
-    if (!status.ok()) {
+    if (!result.status.ok()) {
       // Ignore unparsable response.
       gpr_log(GPR_ERROR,
               "[xds_client %p] xds server %s: error parsing ADS response (%s) "
               "-- ignoring",
               xds_client(), xds_channel()->server_.server_uri().c_str(),
-              status.ToString().c_str());
+              result.status.ToString().c_str());
     } else {
       seen_response_ = true;
       xds_channel()->SetHealthyLocked();
@@ -1189,8 +1422,11 @@ void XdsClient::XdsChannel::AdsCall::OnRecvMessage(absl::string_view payload) {
                 result.type_url.c_str(), result.version.c_str(),
                 state.nonce.c_str(), state.status.ToString().c_str());
       }
+      // Delete the resources removed by a delta update.
+      OnResourcesRemovedLocked(result.type, result.removed_resources,
+                               read_delay_handle);
       // Delete resources not seen in update if needed.
-      if (result.type->AllResourcesRequiredInSotW()) {
+      if (!use_delta_ads() && result.type->AllResourcesRequiredInSotW()) {
         for (auto& a : xds_client()->authority_state_map_) {
           const std::string& authority = a.first;
           AuthorityState& authority_state = a.second;
@@ -1217,26 +1453,8 @@ void XdsClient::XdsChannel::AdsCall::OnRecvMessage(absl::string_view payload) {
               // that the resource does not exist.  For that case, we rely on
               // the request timeout instead.
               if (resource_state.resource == nullptr) continue;
-              if (xds_channel()->server_.IgnoreResourceDeletion()) {
-                if (!resource_state.ignored_deletion) {
-                  gpr_log(GPR_ERROR,
-                          "[xds_client %p] xds server %s: ignoring deletion "
-                          "for resource type %s name %s",
-                          xds_client(),
-                          xds_channel()->server_.server_uri().c_str(),
-                          result.type_url.c_str(),
-                          XdsClient::ConstructFullXdsResourceName(
-                              authority, result.type_url.c_str(), resource_key)
-                              .c_str());
-                  resource_state.ignored_deletion = true;
-                }
-              } else {
-                resource_state.resource.reset();
-                resource_state.meta.client_status =
-                    XdsApi::ResourceMetadata::DOES_NOT_EXIST;
-                xds_client()->NotifyWatchersOnResourceDoesNotExist(
-                    resource_state.watchers, read_delay_handle);
-              }
+              OnResourceDeletedLocked(result.type, authority, resource_key,
+                                      resource_state, read_delay_handle);
             }
           }
         }
@@ -1295,6 +1513,81 @@ void XdsClient::XdsChannel::AdsCall::OnStatusReceived(absl::Status status) {
   xds_client()->work_serializer_.DrainQueue();
 }
 
+void XdsClient::XdsChannel::AdsCall::MarkResourceSeenLocked(
+    const XdsResourceType* type, const XdsResourceName& name) {
+  auto timer_it = state_map_.find(type);
+  if (timer_it != state_map_.end()) {
+    auto it = timer_it->second.subscribed_resources.find(name.authority);
+    if (it != timer_it->second.subscribed_resources.end()) {
+      auto res_it = it->second.find(name.key);
+      if (res_it != it->second.end()) {
+        res_it->second->MarkSeen();
+      }
+    }
+  }
+}
+
+void XdsClient::XdsChannel::AdsCall::OnResourceDeletedLocked(
+    const XdsResourceType* type, const std::string& authority,
+    const XdsResourceKey& resource_key, ResourceState& resource_state,
+    const RefCountedPtr<ReadDelayHandle>& read_delay_handle) {
+  if (xds_channel()->server_.IgnoreResourceDeletion()) {
+    if (!resource_state.ignored_deletion) {
+      gpr_log(GPR_ERROR,
+              "[xds_client %p] xds server %s: ignoring deletion "
+              "for resource type %s name %s",
+              xds_client(), xds_channel()->server_.server_uri().c_str(),
+              std::string(type->type_url()).c_str(),
+              XdsClient::ConstructFullXdsResourceName(
+                  authority, type->type_url(), resource_key)
+                  .c_str());
+      resource_state.ignored_deletion = true;
+    }
+  } else {
+    resource_state.resource.reset();
+    resource_state.meta.client_status =
+        XdsApi::ResourceMetadata::DOES_NOT_EXIST;
+    xds_client()->NotifyWatchersOnResourceDoesNotExist(resource_state.watchers,
+                                                        read_delay_handle);
+  }
+}
+
+void XdsClient::XdsChannel::AdsCall::OnResourcesRemovedLocked(
+    const XdsResourceType* type,
+    const std::vector<std::string>& removed_resources,
+    const RefCountedPtr<ReadDelayHandle>& read_delay_handle) {
+  for (const std::string& resource_name : removed_resources) {
+    auto parsed_resource_name =
+        xds_client()->ParseXdsResourceName(resource_name, type);
+    if (!parsed_resource_name.ok()) continue;
+    auto authority_it =
+        xds_client()->authority_state_map_.find(parsed_resource_name->authority);
+    if (authority_it == xds_client()->authority_state_map_.end()) continue;
+    AuthorityState& authority_state = authority_it->second;
+    // Skip authorities that are not using this xDS channel.
+    if (authority_state.xds_channels.back() != xds_channel()) continue;
+    auto type_it = authority_state.resource_map.find(type);
+    if (type_it == authority_state.resource_map.end()) continue;
+    auto it = type_it->second.find(parsed_resource_name->key);
+    if (it == type_it->second.end()) continue;
+    ResourceState& resource_state = it->second;
+    MarkResourceSeenLocked(type, *parsed_resource_name);
+    if (resource_state.resource != nullptr) {
+      OnResourceDeletedLocked(type, parsed_resource_name->authority,
+                              parsed_resource_name->key, resource_state,
+                              read_delay_handle);
+    } else if (resource_state.meta.client_status !=
+               XdsApi::ResourceMetadata::DOES_NOT_EXIST) {
+      // Unlike a state-of-the-world response, a delta response tells us
+      // that a resource we never received does not exist.
+      resource_state.meta.client_status =
+          XdsApi::ResourceMetadata::DOES_NOT_EXIST;
+      xds_client()->NotifyWatchersOnResourceDoesNotExist(
+          resource_state.watchers, read_delay_handle);
+    }
+  }
+}
+
 bool XdsClient::XdsChannel::AdsCall::IsCurrentCallOnChannel() const {
   // If the retryable ADS call is null (which only happens when the xds
   // channel is shutting down), all the ADS calls are stale.
@@ -1859,6 +2152,8 @@ void XdsClient::MaybeRegisterResourceTypeLocked(
   }
   resource_types_.emplace(resource_type->type_url(), resource_type);
   resource_type->InitUpbSymtab(this, def_pool_.ptr());
+  resource_type->InitUpbSymtab(
+      this, resource_type_def_pools_[resource_type].ptr());
 }
 
 const XdsResourceType* XdsClient::GetResourceTypeLocked(
@@ -366,6 +366,11 @@ class XdsClient : public DualRefCounted<XdsClient> {
   std::map<absl::string_view /*resource_type*/, const XdsResourceType*>
       resource_types_ ABSL_GUARDED_BY(mu_);
   upb::DefPool def_pool_ ABSL_GUARDED_BY(mu_);
+  // The upb defs used to decode each resource type.  Each pool is populated
+  // when the type is registered and is read-only afterwards, so that the
+  // resources can be decoded without holding mu_.
+  std::map<const XdsResourceType*, upb::DefPool> resource_type_def_pools_
+      ABSL_GUARDED_BY(mu_);
 
   // Map of existing xDS server channels.
   std::map<std::string /*XdsServer key*/, XdsChannel*> xds_channel_map_
@@ -151,5 +151,13 @@ void TlsServerCredentialsOptions::set_send_client_ca_list(
                                                        send_client_ca_list);
 }
 
+void TlsServerCredentialsOptions::set_session_ticket_key_file(
+    const std::string& path, unsigned int refresh_interval_sec) {
+  grpc_tls_credentials_options* options = mutable_c_credentials_options();
+  CHECK_NE(options, nullptr);
+  grpc_tls_credentials_options_set_session_ticket_key_file(
+      options, path.c_str(), refresh_interval_sec);
+}
+
 }  // namespace experimental
 }  // namespace grpc
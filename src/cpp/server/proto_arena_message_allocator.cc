@@ -0,0 +1,165 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <set>
+#include <vector>
+
+#include <grpcpp/support/proto_arena_message_allocator.h>
+
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/transport/call_arena_allocator.h"
+
+namespace grpc {
+namespace internal {
+
+namespace {
+
+// The idle arenas cached by each thread, for all the pools.
+constexpr size_t kMaxCachedEntries = 16;
+
+// The initial estimate of the space used by the messages of a call.
+constexpr size_t kInitialSpaceEstimate = 1024;
+
+std::atomic<uint64_t> g_next_pool_id{1};
+
+// Bumped whenever a pool is destroyed, so that the threads know when to look
+// for the entries of destroyed pools in their caches.
+std::atomic<uint64_t> g_destroyed_pools{0};
+
+grpc_core::Mutex* LivePoolsMu() {
+  static grpc_core::Mutex* mu = new grpc_core::Mutex();
+  return mu;
+}
+
+// Guarded by LivePoolsMu().
+std::set<uint64_t>* LivePools() {
+  static std::set<uint64_t>* pools = new std::set<uint64_t>();
+  return pools;
+}
+
+class EntryCache {
+ public:
+  ~EntryCache() {
+    for (ProtoArenaPool::Entry* entry : entries_) delete entry;
+  }
+
+  // Most recently cached first.
+  ProtoArenaPool::Entry* Take(uint64_t pool_id) {
+    DropEntriesOfDestroyedPools();
+    for (auto it = entries_.rbegin(); it != entries_.rend(); ++it) {
+      if ((*it)->pool_id() == pool_id) {
+        ProtoArenaPool::Entry* entry = *it;
+        entries_.erase(std::next(it).base());
+        return entry;
+      }
+    }
+    return nullptr;
+  }
+
+  void Put(ProtoArenaPool::Entry* entry) {
+    DropEntriesOfDestroyedPools();
+    if (entries_.size() == kMaxCachedEntries) {
+      delete entries_.front();
+      entries_.erase(entries_.begin());
+    }
+    entries_.push_back(entry);
+  }
+
+  void DropEntriesOfDestroyedPools() {
+    const uint64_t destroyed_pools =
+        g_destroyed_pools.load(std::memory_order_acquire);
+    if (destroyed_pools == seen_destroyed_pools_) return;
+    seen_destroyed_pools_ = destroyed_pools;
+    if (entries_.empty()) return;
+    grpc_core::MutexLock lock(LivePoolsMu());
+    const std::set<uint64_t>& live_pools = *LivePools();
+    entries_.erase(
+        std::remove_if(entries_.begin(), entries_.end(),
+                       [&live_pools](ProtoArenaPool::Entry* entry) {
+                         if (live_pools.count(entry->pool_id()) != 0) {
+                           return false;
+                         }
+                         delete entry;
+                         return true;
+                       }),
+        entries_.end());
+  }
+
+  size_t size() const { return entries_.size(); }
+
+ private:
+  std::vector<ProtoArenaPool::Entry*> entries_;
+  uint64_t seen_destroyed_pools_ = 0;
+};
+
+EntryCache& ThreadEntryCache() {
+  static thread_local EntryCache cache;
+  return cache;
+}
+
+}  // namespace
+
+ProtoArenaPool::ProtoArenaPool()
+    : id_(g_next_pool_id.fetch_add(1, std::memory_order_relaxed)),
+      size_estimator_(new grpc_core::CallSizeEstimator(kInitialSpaceEstimate)) {
+  grpc_core::MutexLock lock(LivePoolsMu());
+  LivePools()->insert(id_);
+}
+
+ProtoArenaPool::~ProtoArenaPool() {
+  {
+    grpc_core::MutexLock lock(LivePoolsMu());
+    LivePools()->erase(id_);
+  }
+  g_destroyed_pools.fetch_add(1, std::memory_order_release);
+  ThreadEntryCache().DropEntriesOfDestroyedPools();
+  delete size_estimator_;
+}
+
+ProtoArenaPool::Entry* ProtoArenaPool::TakeCachedEntry() {
+  Entry* entry = ThreadEntryCache().Take(id_);
+  if (entry != nullptr && entry->block_size() < BlockSize()) {
+    // The messages got larger since the entry was created.
+    delete entry;
+    return nullptr;
+  }
+  return entry;
+}
+
+size_t ProtoArenaPool::BlockSize() const {
+  return size_estimator_->CallSizeEstimate();
+}
+
+void ProtoArenaPool::ReturnEntry(Entry* entry, size_t space_used) {
+  size_estimator_->UpdateCallSizeEstimate(space_used);
+  ThreadEntryCache().Put(entry);
+}
+
+size_t ProtoArenaPool::CachedEntriesForTesting() {
+  ThreadEntryCache().DropEntriesOfDestroyedPools();
+  return ThreadEntryCache().size();
+}
+
+}  // namespace internal
+}  // namespace grpc
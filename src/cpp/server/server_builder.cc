@@ -166,6 +166,11 @@ void ServerBuilder::experimental_type::EnableCallMetricRecording(
   builder_->server_metric_recorder_ = server_metric_recorder;
 }
 
+void ServerBuilder::experimental_type::SetNonBlockingMethod(
+    const std::string& method_name, std::chrono::nanoseconds latency_budget) {
+  builder_->non_blocking_methods_[method_name] = latency_budget;
+}
+
 ServerBuilder& ServerBuilder::SetOption(
     std::unique_ptr<ServerBuilderOption> option) {
   options_.push_back(std::move(option));
@@ -406,6 +411,12 @@ std::unique_ptr<grpc::Server> ServerBuilder::BuildAndStart() {
 
   server->RegisterContextAllocator(std::move(context_allocator_));
 
+  for (const auto& method : non_blocking_methods_) {
+    server->inline_reaction_budgets_.emplace(
+        method.first, std::make_unique<internal::InlineReactionBudget>(
+                          method.first, method.second));
+  }
+
   for (const auto& value : services_) {
     if (!server->RegisterService(value->host.get(), value->service)) {
       return nullptr;
@@ -556,10 +556,12 @@ class Server::CallbackRequest final
   // characteristics of the method being requested. For generic services, method
   // is nullptr since these services don't have pre-defined methods.
   CallbackRequest(Server* server, grpc::internal::RpcServiceMethod* method,
+                  grpc::internal::InlineReactionBudget* inline_reaction_budget,
                   grpc::CompletionQueue* cq,
                   grpc_core::Server::RegisteredCallAllocation* data)
       : server_(server),
         method_(method),
+        inline_reaction_budget_(inline_reaction_budget),
         has_request_payload_(method->method_type() ==
                                  grpc::internal::RpcMethod::NORMAL_RPC ||
                              method->method_type() ==
@@ -711,7 +713,8 @@ class Server::CallbackRequest final
                           : req_->server_->generic_handler_.get();
       handler->RunHandler(grpc::internal::MethodHandler::HandlerParameter(
           call_, req_->ctx_, req_->request_, req_->request_status_,
-          req_->handler_data_, [this] { delete req_; }));
+          req_->handler_data_, [this] { delete req_; },
+          req_->inline_reaction_budget_));
     }
   };
 
@@ -733,6 +736,7 @@ class Server::CallbackRequest final
 
   Server* const server_;
   grpc::internal::RpcServiceMethod* const method_;
+  grpc::internal::InlineReactionBudget* const inline_reaction_budget_ = nullptr;
   const bool has_request_payload_;
   grpc_byte_buffer* request_payload_ = nullptr;
   void* request_ = nullptr;
@@ -1073,13 +1077,19 @@ bool Server::RegisterService(const std::string* addr, grpc::Service* service) {
     } else {
       has_callback_methods_ = true;
       grpc::internal::RpcServiceMethod* method_value = method.get();
+      grpc::internal::InlineReactionBudget* inline_reaction_budget = nullptr;
+      auto it = inline_reaction_budgets_.find(method->name());
+      if (it != inline_reaction_budgets_.end()) {
+        inline_reaction_budget = it->second.get();
+      }
       grpc::CompletionQueue* cq = CallbackCQ();
       grpc_server_register_completion_queue(server_, cq->cq(), nullptr);
       grpc_core::Server::FromC(server_)->SetRegisteredMethodAllocator(
-          cq->cq(), method_registration_tag, [this, cq, method_value] {
+          cq->cq(), method_registration_tag,
+          [this, cq, method_value, inline_reaction_budget] {
             grpc_core::Server::RegisteredCallAllocation result;
-            new CallbackRequest<grpc::CallbackServerContext>(this, method_value,
-                                                             cq, &result);
+            new CallbackRequest<grpc::CallbackServerContext>(
+                this, method_value, inline_reaction_budget, cq, &result);
             return result;
           });
     }
@@ -409,6 +409,7 @@ CORE_SOURCE_FILES = [
     'src/core/handshaker/http_connect/http_connect_handshaker.cc',
     'src/core/handshaker/http_connect/http_proxy_mapper.cc',
     'src/core/handshaker/proxy_mapper_registry.cc',
+    'src/core/handshaker/security/handshake_executor.cc',
     'src/core/handshaker/security/secure_endpoint.cc',
     'src/core/handshaker/security/security_handshaker.cc',
     'src/core/handshaker/security/tsi_error.cc',
@@ -445,10 +446,12 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/cf_engine/cfstream_endpoint.cc',
     'src/core/lib/event_engine/cf_engine/dns_service_resolver.cc',
     'src/core/lib/event_engine/channel_args_endpoint_config.cc',
+    'src/core/lib/event_engine/coarse_timer_queue.cc',
     'src/core/lib/event_engine/default_event_engine.cc',
     'src/core/lib/event_engine/default_event_engine_factory.cc',
     'src/core/lib/event_engine/event_engine.cc',
     'src/core/lib/event_engine/forkable.cc',
+    'src/core/lib/event_engine/posix_engine/busy_poll.cc',
     'src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc',
     'src/core/lib/event_engine/posix_engine/ev_poll_posix.cc',
     'src/core/lib/event_engine/posix_engine/event_poller_posix_default.cc',
@@ -463,6 +466,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/posix_engine/timer.cc',
     'src/core/lib/event_engine/posix_engine/timer_heap.cc',
     'src/core/lib/event_engine/posix_engine/timer_manager.cc',
+    'src/core/lib/event_engine/posix_engine/timer_wheel.cc',
     'src/core/lib/event_engine/posix_engine/traced_buffer_list.cc',
     'src/core/lib/event_engine/posix_engine/wakeup_fd_eventfd.cc',
     'src/core/lib/event_engine/posix_engine/wakeup_fd_pipe.cc',
@@ -473,6 +477,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/slice_buffer.cc',
     'src/core/lib/event_engine/tcp_socket_utils.cc',
     'src/core/lib/event_engine/thread_local.cc',
+    'src/core/lib/event_engine/thread_pool/numa_topology.cc',
     'src/core/lib/event_engine/thread_pool/thread_count.cc',
     'src/core/lib/event_engine/thread_pool/thread_pool_factory.cc',
     'src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.cc',
@@ -647,6 +652,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/security/authorization/grpc_server_authz_filter.cc',
     'src/core/lib/security/authorization/matchers.cc',
     'src/core/lib/security/authorization/rbac_policy.cc',
+    'src/core/lib/security/authorization/rbac_program.cc',
     'src/core/lib/security/authorization/stdout_logger.cc',
     'src/core/lib/security/certificate_provider/certificate_provider_registry.cc',
     'src/core/lib/security/context/security_context.cc',
@@ -731,6 +737,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/transport/batch_builder.cc',
     'src/core/lib/transport/bdp_estimator.cc',
     'src/core/lib/transport/call_arena_allocator.cc',
+    'src/core/lib/transport/call_destination.cc',
     'src/core/lib/transport/call_filters.cc',
     'src/core/lib/transport/call_final_info.cc',
     'src/core/lib/transport/call_spine.cc',
@@ -826,9 +833,11 @@ CORE_SOURCE_FILES = [
     'src/core/tsi/fake_transport_security.cc',
     'src/core/tsi/local_transport_security.cc',
     'src/core/tsi/ssl/key_logging/ssl_key_logging.cc',
+    'src/core/tsi/ssl/ktls/ssl_ktls.cc',
     'src/core/tsi/ssl/session_cache/ssl_session_boringssl.cc',
     'src/core/tsi/ssl/session_cache/ssl_session_cache.cc',
     'src/core/tsi/ssl/session_cache/ssl_session_openssl.cc',
+    'src/core/tsi/ssl/session_ticket/ssl_session_ticket_key_ring.cc',
     'src/core/tsi/ssl_transport_security.cc',
     'src/core/tsi/ssl_transport_security_utils.cc',
     'src/core/tsi/transport_security.cc',
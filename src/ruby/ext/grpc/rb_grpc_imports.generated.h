@@ -255,6 +255,9 @@ extern grpc_tls_credentials_options_set_verify_server_cert_type grpc_tls_credent
 typedef void(*grpc_tls_credentials_options_set_send_client_ca_list_type)(grpc_tls_credentials_options* options, bool send_client_ca_list);
 extern grpc_tls_credentials_options_set_send_client_ca_list_type grpc_tls_credentials_options_set_send_client_ca_list_import;
 #define grpc_tls_credentials_options_set_send_client_ca_list grpc_tls_credentials_options_set_send_client_ca_list_import
+typedef void(*grpc_tls_credentials_options_set_session_ticket_key_file_type)(grpc_tls_credentials_options* options, const char* path, unsigned int refresh_interval_sec);
+extern grpc_tls_credentials_options_set_session_ticket_key_file_type grpc_tls_credentials_options_set_session_ticket_key_file_import;
+#define grpc_tls_credentials_options_set_session_ticket_key_file grpc_tls_credentials_options_set_session_ticket_key_file_import
 typedef grpc_ssl_session_cache*(*grpc_ssl_session_cache_create_lru_type)(size_t capacity);
 extern grpc_ssl_session_cache_create_lru_type grpc_ssl_session_cache_create_lru_import;
 #define grpc_ssl_session_cache_create_lru grpc_ssl_session_cache_create_lru_import
@@ -0,0 +1,314 @@
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/client_channel/dynamic_filters.h"
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+#include <grpc/slice.h>
+
+#include "src/core/ext/filters/fault_injection/fault_injection_filter.h"
+#include "src/core/ext/filters/fault_injection/fault_injection_service_config_parser.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/channel/channel_stack.h"
+#include "src/core/lib/channel/context.h"
+#include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/gpr/time_precise.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/iomgr/call_combiner.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/transport/transport.h"
+#include "src/core/service_config/service_config_call_data.h"
+#include "src/core/service_config/service_config_impl.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+// Filters that count the calls created and the batches started on them.
+struct FilterStats {
+  int calls = 0;
+  int batches = 0;
+};
+
+template <int kId, bool kTerminal>
+class CountingFilter {
+ public:
+  static const grpc_channel_filter kFilter;
+  static FilterStats stats;
+
+ private:
+  static void StartTransportStreamOpBatch(
+      grpc_call_element* elem, grpc_transport_stream_op_batch* batch) {
+    ++stats.batches;
+    if (!kTerminal) grpc_call_next_op(elem, batch);
+  }
+
+  static grpc_error_handle InitCallElem(
+      grpc_call_element* /*elem*/, const grpc_call_element_args* /*args*/) {
+    ++stats.calls;
+    return absl::OkStatus();
+  }
+
+  static void DestroyCallElem(grpc_call_element* /*elem*/,
+                              const grpc_call_final_info* /*final_info*/,
+                              grpc_closure* /*then_schedule_closure*/) {}
+
+  static grpc_error_handle InitChannelElem(
+      grpc_channel_element* /*elem*/, grpc_channel_element_args* /*args*/) {
+    return absl::OkStatus();
+  }
+
+  static void DestroyChannelElem(grpc_channel_element* /*elem*/) {}
+};
+
+template <int kId, bool kTerminal>
+const grpc_channel_filter CountingFilter<kId, kTerminal>::kFilter = {
+    StartTransportStreamOpBatch,
+    nullptr,
+    nullptr,
+    grpc_channel_next_op,
+    0,
+    InitCallElem,
+    grpc_call_stack_ignore_set_pollset_or_pollset_set,
+    DestroyCallElem,
+    0,
+    InitChannelElem,
+    grpc_channel_stack_no_post_init,
+    DestroyChannelElem,
+    grpc_channel_next_get_info,
+    "counting_filter"};
+
+template <int kId, bool kTerminal>
+FilterStats CountingFilter<kId, kTerminal>::stats;
+
+using FilterA = CountingFilter<0, false>;
+using FilterB = CountingFilter<1, false>;
+using Terminal = CountingFilter<2, true>;
+
+class DynamicFiltersTest : public ::testing::Test {
+ protected:
+  DynamicFiltersTest() {
+    FilterA::stats = FilterStats();
+    FilterB::stats = FilterStats();
+    Terminal::stats = FilterStats();
+  }
+
+  static ChannelArgs Args() {
+    return CoreConfiguration::Get()
+        .channel_args_preconditioning()
+        .PreconditionChannelArgs(nullptr)
+        .Set(GRPC_ARG_PARSE_FAULT_INJECTION_METHOD_CONFIG, 1);
+  }
+
+  // The filters of a stack, in order.
+  static std::vector<const grpc_channel_filter*> Filters(
+      const DynamicFilters& stack) {
+    std::vector<const grpc_channel_filter*> filters;
+    for (size_t i = 0; i < stack.channel_stack()->count; ++i) {
+      filters.push_back(
+          grpc_channel_stack_element(stack.channel_stack(), i)->filter);
+    }
+    return filters;
+  }
+
+  // The instance id of each filter of a stack, in order.
+  static std::vector<size_t> InstanceIds(const DynamicFilters& stack) {
+    std::vector<size_t> ids;
+    for (size_t i = 0; i < stack.channel_stack()->count; ++i) {
+      ids.push_back(grpc_channel_stack_filter_instance_number(
+          stack.channel_stack(),
+          grpc_channel_stack_element(stack.channel_stack(), i)));
+    }
+    return ids;
+  }
+
+  // Creates a call on stack and starts a batch on it.
+  void RunCall(RefCountedPtr<DynamicFilters> stack) {
+    ExecCtx exec_ctx;
+    grpc_call_context_element context[GRPC_CONTEXT_COUNT] = {};
+    CallCombiner call_combiner;
+    DynamicFilters* channel_stack = stack.get();
+    DynamicFilters::Call::Args args = {std::move(stack),
+                                       nullptr,
+                                       grpc_slice_from_static_string("/s/m"),
+                                       gpr_get_cycle_counter(),
+                                       Timestamp::InfFuture(),
+                                       arena_.get(),
+                                       context,
+                                       &call_combiner};
+    grpc_error_handle error;
+    auto call = channel_stack->CreateCall(std::move(args), &error);
+    ASSERT_TRUE(error.ok()) << error;
+    grpc_transport_stream_op_batch_payload payload(context);
+    grpc_transport_stream_op_batch batch;
+    batch.payload = &payload;
+    batch.cancel_stream = true;
+    payload.cancel_stream.cancel_error = absl::CancelledError();
+    call->StartTransportStreamOpBatch(&batch);
+    call.reset();
+    ExecCtx::Get()->Flush();
+  }
+
+  // Whether the fault injection filter is active for a call whose method
+  // config has the given fault injection policies.
+  bool FaultInjectionIsActive(absl::string_view elements) {
+    auto service_config = ServiceConfigImpl::Create(
+        Args(), absl::StrCat("{\"methodConfig\": [{\"name\": [{}], "
+                             "\"faultInjectionPolicy\": [",
+                             elements, "]}]}"));
+    CHECK(service_config.ok()) << service_config.status();
+    grpc_call_context_element call_context[GRPC_CONTEXT_COUNT] = {};
+    ServiceConfigCallData call_config(arena_.get(), call_context);
+    call_config.SetServiceConfig(
+        *service_config, (*service_config)
+                             ->GetMethodParsedConfigVector(
+                                 grpc_slice_from_static_string("/s/m")));
+    return FaultInjectionFilter::IsActiveForCall(call_config);
+  }
+
+  MemoryAllocator memory_allocator_ = MemoryAllocator(
+      ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator("test"));
+  ScopedArenaPtr arena_ = MakeScopedArena(4096, &memory_allocator_);
+};
+
+TEST_F(DynamicFiltersTest, NothingInactive) {
+  auto stack = DynamicFilters::Create(
+      Args(), {&FilterA::kFilter, &FilterB::kFilter, &Terminal::kFilter});
+  EXPECT_EQ(stack->WithoutInactiveFilters(
+                [](const grpc_channel_filter*) { return true; }),
+            stack);
+}
+
+TEST_F(DynamicFiltersTest, LeavesOutAllFiltersOfAnInactiveType) {
+  auto stack = DynamicFilters::Create(
+      Args(), {&FilterA::kFilter, &FilterB::kFilter, &FilterA::kFilter,
+               &FilterB::kFilter, &Terminal::kFilter});
+  auto without_a = stack->WithoutInactiveFilters(
+      [](const grpc_channel_filter* filter) {
+        return filter != &FilterA::kFilter;
+      });
+  EXPECT_EQ(Filters(*without_a),
+            (std::vector<const grpc_channel_filter*>{
+                &FilterB::kFilter, &FilterB::kFilter, &Terminal::kFilter}));
+  // The filters that are kept keep their instance ids.
+  EXPECT_EQ(InstanceIds(*without_a), (std::vector<size_t>{0, 1, 0}));
+}
+
+TEST_F(DynamicFiltersTest, KeepsTheLastFilter) {
+  auto stack =
+      DynamicFilters::Create(Args(), {&FilterA::kFilter, &Terminal::kFilter});
+  auto pruned = stack->WithoutInactiveFilters(
+      [](const grpc_channel_filter*) { return false; });
+  EXPECT_EQ(Filters(*pruned),
+            (std::vector<const grpc_channel_filter*>{&Terminal::kFilter}));
+}
+
+TEST_F(DynamicFiltersTest, CachesPrunedStacks) {
+  auto stack = DynamicFilters::Create(
+      Args(), {&FilterA::kFilter, &FilterB::kFilter, &Terminal::kFilter});
+  auto is_not = [](const grpc_channel_filter* inactive) {
+    return [inactive](const grpc_channel_filter* filter) {
+      return filter != inactive;
+    };
+  };
+  auto without_a = stack->WithoutInactiveFilters(is_not(&FilterA::kFilter));
+  auto without_b = stack->WithoutInactiveFilters(is_not(&FilterB::kFilter));
+  EXPECT_NE(without_a, stack);
+  EXPECT_NE(without_b, stack);
+  EXPECT_NE(without_a, without_b);
+  EXPECT_EQ(stack->WithoutInactiveFilters(is_not(&FilterA::kFilter)),
+            without_a);
+  EXPECT_EQ(stack->WithoutInactiveFilters(is_not(&FilterB::kFilter)),
+            without_b);
+}
+
+TEST_F(DynamicFiltersTest, CallRunsOnThePrunedStack) {
+  auto stack = DynamicFilters::Create(
+      Args(), {&FilterA::kFilter, &FilterB::kFilter, &Terminal::kFilter});
+  RunCall(stack->WithoutInactiveFilters(
+      [](const grpc_channel_filter* filter) {
+        return filter != &FilterA::kFilter;
+      }));
+  EXPECT_EQ(FilterA::stats.calls, 0);
+  EXPECT_EQ(FilterA::stats.batches, 0);
+  EXPECT_EQ(FilterB::stats.calls, 1);
+  EXPECT_EQ(FilterB::stats.batches, 1);
+  EXPECT_EQ(Terminal::stats.calls, 1);
+  EXPECT_EQ(Terminal::stats.batches, 1);
+  RunCall(stack);
+  EXPECT_EQ(FilterA::stats.calls, 1);
+  EXPECT_EQ(FilterA::stats.batches, 1);
+}
+
+// The fault injection filters of a stack index the policies of the method
+// config by instance id, so they stay together as long as any policy can
+// inject a fault.
+TEST_F(DynamicFiltersTest, FaultInjectionInstancesWithOneActive) {
+  auto stack = DynamicFilters::Create(
+      Args(), {&FaultInjectionFilter::kFilter, &FilterA::kFilter,
+               &FaultInjectionFilter::kFilter, &Terminal::kFilter});
+  auto is_active = [](bool fault_injection_active) {
+    return [fault_injection_active](const grpc_channel_filter* filter) {
+      return filter != &FaultInjectionFilter::kFilter ||
+             fault_injection_active;
+    };
+  };
+  // Only the second instance has something to do.
+  const bool one_active =
+      FaultInjectionIsActive("{}, {\"abortCode\": \"UNAVAILABLE\"}");
+  EXPECT_TRUE(one_active);
+  auto kept = stack->WithoutInactiveFilters(is_active(one_active));
+  EXPECT_EQ(kept, stack);
+  EXPECT_EQ(InstanceIds(*kept), (std::vector<size_t>{0, 0, 1, 0}));
+  // Neither has.
+  const bool none_active = FaultInjectionIsActive("{}, {}");
+  EXPECT_FALSE(none_active);
+  auto pruned = stack->WithoutInactiveFilters(is_active(none_active));
+  EXPECT_EQ(Filters(*pruned),
+            (std::vector<const grpc_channel_filter*>{&FilterA::kFilter,
+                                                      &Terminal::kFilter}));
+  RunCall(pruned);
+  EXPECT_EQ(FilterA::stats.calls, 1);
+  EXPECT_EQ(Terminal::stats.batches, 1);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
@@ -0,0 +1,110 @@
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/client_channel/pending_connectivity_updates.h"
+
+#include <string>
+
+#include "absl/status/status.h"
+#include "absl/strings/cord.h"
+#include "absl/types/optional.h"
+#include "gtest/gtest.h"
+
+#include <grpc/impl/connectivity_state.h>
+
+#include "src/core/lib/transport/transport.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+absl::Status KeepaliveThrottlingStatus(int keepalive_time) {
+  absl::Status status = absl::UnavailableError("GOAWAY received");
+  status.SetPayload(kKeepaliveThrottlingKey,
+                    absl::Cord(std::to_string(keepalive_time)));
+  return status;
+}
+
+TEST(PendingConnectivityUpdatesTest, SameStateMergesIntoNewestUpdate) {
+  PendingConnectivityUpdates updates;
+  EXPECT_TRUE(updates.Push(GRPC_CHANNEL_TRANSIENT_FAILURE,
+                           absl::UnavailableError("first")));
+  EXPECT_FALSE(updates.Push(GRPC_CHANNEL_TRANSIENT_FAILURE,
+                            absl::UnavailableError("second")));
+  EXPECT_FALSE(updates.Push(GRPC_CHANNEL_TRANSIENT_FAILURE,
+                            absl::UnavailableError("third")));
+  ASSERT_EQ(updates.size(), 1);
+  PendingConnectivityUpdates::Update update = updates.Pop();
+  EXPECT_EQ(update.state, GRPC_CHANNEL_TRANSIENT_FAILURE);
+  // The merged update carries the status of the latest one.
+  EXPECT_EQ(update.status, absl::UnavailableError("third"));
+}
+
+TEST(PendingConnectivityUpdatesTest, StateChangesAreKeptInOrder) {
+  PendingConnectivityUpdates updates;
+  EXPECT_TRUE(updates.Push(GRPC_CHANNEL_CONNECTING, absl::OkStatus()));
+  EXPECT_TRUE(updates.Push(GRPC_CHANNEL_READY, absl::OkStatus()));
+  // Only the newest waiting update is merged into.
+  EXPECT_TRUE(updates.Push(GRPC_CHANNEL_CONNECTING, absl::OkStatus()));
+  ASSERT_EQ(updates.size(), 3);
+  EXPECT_EQ(updates.Pop().state, GRPC_CHANNEL_CONNECTING);
+  EXPECT_EQ(updates.Pop().state, GRPC_CHANNEL_READY);
+  EXPECT_EQ(updates.Pop().state, GRPC_CHANNEL_CONNECTING);
+}
+
+TEST(PendingConnectivityUpdatesTest, DeliveredUpdateIsNotMergedInto) {
+  PendingConnectivityUpdates updates;
+  EXPECT_TRUE(updates.Push(GRPC_CHANNEL_CONNECTING, absl::OkStatus()));
+  updates.Pop();
+  EXPECT_TRUE(updates.Push(GRPC_CHANNEL_CONNECTING, absl::OkStatus()));
+  EXPECT_EQ(updates.size(), 1);
+}
+
+TEST(PendingConnectivityUpdatesTest, KeepaliveThrottlingIsNotMergedAway) {
+  PendingConnectivityUpdates updates;
+  EXPECT_TRUE(updates.Push(GRPC_CHANNEL_IDLE, KeepaliveThrottlingStatus(20)));
+  // The throttling information would be lost if this update replaced the
+  // status of the waiting one.
+  EXPECT_TRUE(updates.Push(GRPC_CHANNEL_IDLE, absl::OkStatus()));
+  ASSERT_EQ(updates.size(), 2);
+  absl::optional<absl::Cord> keepalive_time =
+      updates.Pop().status.GetPayload(kKeepaliveThrottlingKey);
+  ASSERT_TRUE(keepalive_time.has_value());
+  EXPECT_EQ(*keepalive_time, "20");
+  EXPECT_TRUE(updates.Pop().status.ok());
+}
+
+TEST(PendingConnectivityUpdatesTest, KeepaliveThrottlingMergesIntoPlainUpdate) {
+  PendingConnectivityUpdates updates;
+  EXPECT_TRUE(updates.Push(GRPC_CHANNEL_IDLE, absl::OkStatus()));
+  EXPECT_FALSE(updates.Push(GRPC_CHANNEL_IDLE, KeepaliveThrottlingStatus(20)));
+  ASSERT_EQ(updates.size(), 1);
+  absl::optional<absl::Cord> keepalive_time =
+      updates.Pop().status.GetPayload(kKeepaliveThrottlingKey);
+  ASSERT_TRUE(keepalive_time.has_value());
+  EXPECT_EQ(*keepalive_time, "20");
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
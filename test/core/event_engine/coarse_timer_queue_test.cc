@@ -0,0 +1,209 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/coarse_timer_queue.h"
+
+#include <chrono>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/functional/any_invocable.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <grpc/event_engine/event_engine.h>
+
+#include "src/core/lib/gprpp/time.h"
+#include "test/core/event_engine/mock_event_engine.h"
+
+using testing::_;
+using testing::NiceMock;
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+
+// Records the timers the queue arms so the test can fire them by hand.
+class ManualTimerEngine : public NiceMock<MockEventEngine> {
+ public:
+  ManualTimerEngine() {
+    ON_CALL(*this, RunAfter(_, testing::An<absl::AnyInvocable<void()>>()))
+        .WillByDefault([this](Duration when, absl::AnyInvocable<void()> cb) {
+          TaskHandle handle{next_key_++, 0};
+          timers_.emplace(handle.keys[0], Timer{when, std::move(cb)});
+          return handle;
+        });
+    ON_CALL(*this, Cancel(_)).WillByDefault([this](TaskHandle handle) {
+      ++cancels_;
+      return timers_.erase(handle.keys[0]) != 0;
+    });
+  }
+
+  size_t pending() const { return timers_.size(); }
+  int cancels() const { return cancels_; }
+
+  // Runs every pending timer.
+  void FireAll() {
+    for (auto& cb : StartFiringAll()) cb();
+  }
+
+  // Returns the closures of every pending timer without running them, as if
+  // they had started firing: they can no longer be cancelled.
+  std::vector<absl::AnyInvocable<void()>> StartFiringAll() {
+    std::vector<absl::AnyInvocable<void()>> callbacks;
+    for (auto& timer : timers_) callbacks.push_back(std::move(timer.second.cb));
+    timers_.clear();
+    return callbacks;
+  }
+
+  std::vector<Duration> Delays() const {
+    std::vector<Duration> delays;
+    for (const auto& timer : timers_) delays.push_back(timer.second.when);
+    return delays;
+  }
+
+ private:
+  struct Timer {
+    Duration when;
+    absl::AnyInvocable<void()> cb;
+  };
+  intptr_t next_key_ = 1;
+  int cancels_ = 0;
+  absl::flat_hash_map<intptr_t, Timer> timers_;
+};
+
+class CoarseTimerQueueTest : public testing::Test {
+ protected:
+  CoarseTimerQueueTest()
+      : engine_(std::make_shared<ManualTimerEngine>()),
+        queue_(grpc_core::MakeRefCounted<CoarseTimerQueue>(engine_)) {
+    time_cache_.TestOnlySetNow(
+        grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(1000));
+  }
+
+  grpc_core::ScopedTimeCache time_cache_;
+  std::shared_ptr<ManualTimerEngine> engine_;
+  grpc_core::RefCountedPtr<CoarseTimerQueue> queue_;
+};
+
+}  // namespace
+
+TEST_F(CoarseTimerQueueTest, TimersInTheSameMillisecondShareAnEngineTimer) {
+  int runs = 0;
+  for (int i = 0; i < 100; i++) {
+    queue_->RunAfter(std::chrono::microseconds(4500), [&runs] { ++runs; });
+  }
+  queue_->RunAfter(std::chrono::milliseconds(20), [&runs] { ++runs; });
+  EXPECT_EQ(engine_->pending(), 2);
+  // Delays are rounded up to the next millisecond, never down.
+  EXPECT_THAT(engine_->Delays(),
+              testing::UnorderedElementsAre(std::chrono::milliseconds(5),
+                                            std::chrono::milliseconds(20)));
+  engine_->FireAll();
+  EXPECT_EQ(runs, 101);
+}
+
+TEST_F(CoarseTimerQueueTest, CancelOnlyReachesTheEngineForTheLastTimer) {
+  int runs = 0;
+  std::vector<EventEngine::TaskHandle> handles;
+  for (int i = 0; i < 3; i++) {
+    handles.push_back(
+        queue_->RunAfter(std::chrono::seconds(1), [&runs] { ++runs; }));
+  }
+  EXPECT_TRUE(queue_->Cancel(handles[0]));
+  EXPECT_TRUE(queue_->Cancel(handles[1]));
+  EXPECT_FALSE(queue_->Cancel(handles[1]));
+  EXPECT_EQ(engine_->cancels(), 0);
+  EXPECT_EQ(engine_->pending(), 1);
+  EXPECT_TRUE(queue_->Cancel(handles[2]));
+  EXPECT_EQ(engine_->cancels(), 1);
+  EXPECT_EQ(engine_->pending(), 0);
+  EXPECT_EQ(runs, 0);
+}
+
+TEST_F(CoarseTimerQueueTest, CancelRacingWithTheEngineTimer) {
+  int runs = 0;
+  auto handle = queue_->RunAfter(std::chrono::seconds(1), [&runs] { ++runs; });
+  auto firing = engine_->StartFiringAll();
+  // The engine timer cannot be cancelled anymore, so the bucket is left to
+  // fire, and timers armed for the same deadline go to a new bucket.
+  EXPECT_TRUE(queue_->Cancel(handle));
+  EXPECT_EQ(engine_->cancels(), 1);
+  queue_->RunAfter(std::chrono::seconds(1), [&runs] { runs += 10; });
+  EXPECT_EQ(engine_->pending(), 1);
+  for (auto& cb : firing) cb();
+  EXPECT_EQ(runs, 0);
+  engine_->FireAll();
+  EXPECT_EQ(runs, 10);
+}
+
+TEST_F(CoarseTimerQueueTest, CancelledTimersAreSkippedWhenTheBucketFires) {
+  struct Counter : public EventEngine::Closure {
+    void Run() override { ++runs; }
+    int runs = 0;
+  };
+  Counter closures[4];
+  EventEngine::TaskHandle handles[4];
+  for (int i = 0; i < 4; i++) {
+    handles[i] = queue_->RunAfter(std::chrono::seconds(1), &closures[i]);
+  }
+  EXPECT_TRUE(queue_->Cancel(handles[1]));
+  EXPECT_TRUE(queue_->Cancel(handles[3]));
+  engine_->FireAll();
+  EXPECT_EQ(closures[0].runs, 1);
+  EXPECT_EQ(closures[1].runs, 0);
+  EXPECT_EQ(closures[2].runs, 1);
+  EXPECT_EQ(closures[3].runs, 0);
+  EXPECT_FALSE(queue_->Cancel(handles[0]));
+  EXPECT_FALSE(queue_->Cancel(EventEngine::TaskHandle::kInvalid));
+}
+
+TEST_F(CoarseTimerQueueTest, EntriesAreRecycled) {
+  // Enough outstanding timers to need several slabs, spread over many buckets.
+  std::vector<EventEngine::TaskHandle> handles;
+  for (int i = 0; i < 1000; i++) {
+    handles.push_back(
+        queue_->RunAfter(std::chrono::milliseconds(i % 50 + 1), [] {}));
+  }
+  EXPECT_EQ(engine_->pending(), 50);
+  for (const auto& handle : handles) EXPECT_TRUE(queue_->Cancel(handle));
+  EXPECT_EQ(engine_->pending(), 0);
+  // Stale handles to recycled entries are rejected.
+  for (int i = 0; i < 1000; i++) {
+    auto handle = queue_->RunAfter(std::chrono::seconds(1), [] {});
+    EXPECT_FALSE(queue_->Cancel(handles[i]));
+    EXPECT_TRUE(queue_->Cancel(handle));
+  }
+  EXPECT_EQ(engine_->pending(), 0);
+}
+
+TEST(CoarseTimerQueueRegistryTest, SharedPerEventEngine) {
+  auto engine = std::make_shared<ManualTimerEngine>();
+  auto other_engine = std::make_shared<ManualTimerEngine>();
+  auto queue = CoarseTimerQueue::Get(engine);
+  EXPECT_EQ(queue, CoarseTimerQueue::Get(engine));
+  EXPECT_NE(queue, CoarseTimerQueue::Get(other_engine));
+  EXPECT_EQ(queue->event_engine(), engine.get());
+}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
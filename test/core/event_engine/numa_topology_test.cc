@@ -0,0 +1,144 @@
+// Copyright 2024 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/thread_pool/numa_topology.h"
+
+#include <stdio.h>
+#include <sys/stat.h>
+
+#include <string>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using testing::ElementsAre;
+using testing::IsEmpty;
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+
+// Builds a fake /sys/devices/system/node tree.
+class FakeSysfs {
+ public:
+  FakeSysfs() : root_(absl::StrCat(testing::TempDir(), "/numa_sysfs_", ++n_)) {
+    for (const char* dir : {"", "/devices", "/devices/system",
+                            "/devices/system/node"}) {
+      mkdir(absl::StrCat(root_, dir).c_str(), 0755);
+    }
+  }
+
+  void SetOnline(const std::string& nodes) {
+    Write("/devices/system/node/online", nodes);
+  }
+
+  void SetNodeCpus(int node, const std::string& cpus) {
+    const std::string dir = absl::StrCat("/devices/system/node/node", node);
+    mkdir(absl::StrCat(root_, dir).c_str(), 0755);
+    Write(absl::StrCat(dir, "/cpulist"), cpus);
+  }
+
+  const std::string& root() const { return root_; }
+
+ private:
+  void Write(const std::string& path, const std::string& contents) {
+    FILE* file = fopen(absl::StrCat(root_, path).c_str(), "w");
+    ASSERT_NE(file, nullptr);
+    fputs(contents.c_str(), file);
+    fclose(file);
+  }
+
+  static int n_;
+  const std::string root_;
+};
+
+int FakeSysfs::n_ = 0;
+
+}  // namespace
+
+TEST(NumaTopologyTest, ParseCpuList) {
+  EXPECT_THAT(*ParseCpuList("0-3,8,10-11\n"),
+              ElementsAre(0, 1, 2, 3, 8, 10, 11));
+  EXPECT_THAT(*ParseCpuList("5"), ElementsAre(5));
+  EXPECT_THAT(*ParseCpuList("\n"), IsEmpty());
+  EXPECT_FALSE(ParseCpuList("3-1").has_value());
+  EXPECT_FALSE(ParseCpuList("a-b").has_value());
+  EXPECT_FALSE(ParseCpuList("1,,2").has_value());
+}
+
+TEST(NumaTopologyTest, DualSocket) {
+  FakeSysfs sysfs;
+  sysfs.SetOnline("0-1\n");
+  sysfs.SetNodeCpus(0, "0-3,8-11\n");
+  sysfs.SetNodeCpus(1, "4-7,12-15\n");
+  NumaTopology topology = NumaTopology::FromSysfs(sysfs.root());
+  ASSERT_EQ(topology.num_nodes(), 2);
+  EXPECT_THAT(topology.cpus(0), ElementsAre(0, 1, 2, 3, 8, 9, 10, 11));
+  EXPECT_THAT(topology.cpus(1), ElementsAre(4, 5, 6, 7, 12, 13, 14, 15));
+}
+
+TEST(NumaTopologyTest, OnlyAllowedCpusAreKept) {
+  FakeSysfs sysfs;
+  sysfs.SetOnline("0-2\n");
+  sysfs.SetNodeCpus(0, "0-3\n");
+  sysfs.SetNodeCpus(1, "4-7\n");
+  sysfs.SetNodeCpus(2, "8-11\n");
+  // Eg a process pinned with taskset or a cpuset to part of the machine.
+  NumaTopology topology =
+      NumaTopology::FromSysfs(sysfs.root(), std::vector<int>{2, 3, 8, 9});
+  ASSERT_EQ(topology.num_nodes(), 2);
+  EXPECT_THAT(topology.cpus(0), ElementsAre(2, 3));
+  EXPECT_THAT(topology.cpus(1), ElementsAre(8, 9));
+}
+
+TEST(NumaTopologyTest, MemoryOnlyNodesAreSkipped) {
+  FakeSysfs sysfs;
+  sysfs.SetOnline("0,2-3\n");
+  sysfs.SetNodeCpus(0, "0-1\n");
+  sysfs.SetNodeCpus(2, "\n");
+  sysfs.SetNodeCpus(3, "2-3\n");
+  NumaTopology topology = NumaTopology::FromSysfs(sysfs.root());
+  ASSERT_EQ(topology.num_nodes(), 2);
+  EXPECT_THAT(topology.cpus(1), ElementsAre(2, 3));
+}
+
+TEST(NumaTopologyTest, UnreadableSysfsIsOneNode) {
+  FakeSysfs sysfs;
+  NumaTopology topology = NumaTopology::FromSysfs(sysfs.root());
+  EXPECT_EQ(topology.num_nodes(), 1);
+  EXPECT_THAT(topology.cpus(0), IsEmpty());
+  EXPECT_FALSE(topology.BindCurrentThread(0));
+}
+
+TEST(NumaTopologyTest, ThisMachine) {
+  const NumaTopology& topology = NumaTopology::Get();
+  ASSERT_GE(topology.num_nodes(), 1);
+  if (topology.num_nodes() > 1) {
+    // Every node has cpus that this process may run on.
+    for (size_t node = 0; node < topology.num_nodes(); node++) {
+      EXPECT_THAT(topology.cpus(node), ::testing::Not(IsEmpty()));
+    }
+  }
+}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
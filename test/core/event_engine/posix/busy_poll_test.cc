@@ -0,0 +1,179 @@
+// Copyright 2024 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/busy_poll.h"
+
+#include "gtest/gtest.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/config/config_vars.h"
+#include "src/core/lib/iomgr/port.h"
+
+#ifdef GRPC_LINUX_EPOLL
+
+#include <sched.h>
+#include <stdint.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+
+class BusyPollTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    grpc_core::ConfigVars::Overrides overrides;
+    overrides.epoll_busy_poll_us = 200000;
+    grpc_core::ConfigVars::SetOverrides(overrides);
+    epfd_ = epoll_create1(EPOLL_CLOEXEC);
+    ASSERT_GE(epfd_, 0);
+    event_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    ASSERT_GE(event_fd_, 0);
+    struct epoll_event ev = {};
+    ev.events = EPOLLIN;
+    ev.data.fd = event_fd_;
+    ASSERT_EQ(epoll_ctl(epfd_, EPOLL_CTL_ADD, event_fd_, &ev), 0);
+  }
+
+  void TearDown() override {
+    close(event_fd_);
+    close(epfd_);
+    grpc_core::ConfigVars::Reset();
+  }
+
+  void Signal() {
+    uint64_t one = 1;
+    ASSERT_EQ(write(event_fd_, &one, sizeof(one)), sizeof(one));
+  }
+
+  int epfd_ = -1;
+  int event_fd_ = -1;
+};
+
+// Moves the calling thread to cpu.
+void PinToCpu(int cpu) {
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  CPU_SET(cpu, &cpus);
+  ASSERT_EQ(sched_setaffinity(0, sizeof(cpus), &cpus), 0);
+}
+
+// Returns the cpu time, in microseconds, used by the calling thread while
+// waiting on an empty epoll set for timeout_ms.
+int64_t CpuMicrosWaiting(int timeout_ms) {
+  int epfd = epoll_create1(EPOLL_CLOEXEC);
+  EXPECT_GE(epfd, 0);
+  struct timespec start;
+  struct timespec end;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &start);
+  struct epoll_event events[4];
+  EXPECT_EQ(EpollWaitMaybeBusyPoll(epfd, events, 4, timeout_ms), 0);
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &end);
+  close(epfd);
+  return (end.tv_sec - start.tv_sec) * 1000000 +
+         (end.tv_nsec - start.tv_nsec) / 1000;
+}
+
+}  // namespace
+
+TEST_F(BusyPollTest, ReturnsEventsArrivingWhileSpinning) {
+  std::thread signaller([this] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    Signal();
+  });
+  struct epoll_event events[4];
+  EXPECT_EQ(EpollWaitMaybeBusyPoll(epfd_, events, 4, -1), 1);
+  EXPECT_EQ(events[0].data.fd, event_fd_);
+  signaller.join();
+}
+
+TEST_F(BusyPollTest, ReturnsEventsArrivingAfterSpinning) {
+  grpc_core::ConfigVars::Overrides overrides;
+  overrides.epoll_busy_poll_us = 1000;
+  grpc_core::ConfigVars::SetOverrides(overrides);
+  std::thread signaller([this] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    Signal();
+  });
+  struct epoll_event events[4];
+  EXPECT_EQ(EpollWaitMaybeBusyPoll(epfd_, events, 4, -1), 1);
+  signaller.join();
+}
+
+TEST_F(BusyPollTest, SpinningStopsAtTheTimeout) {
+  struct epoll_event events[4];
+  const auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(EpollWaitMaybeBusyPoll(epfd_, events, 4, 20), 0);
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  EXPECT_GE(elapsed, std::chrono::milliseconds(19));
+  EXPECT_LT(elapsed, std::chrono::milliseconds(190));
+}
+
+TEST_F(BusyPollTest, BudgetIsPerCore) {
+  cpu_set_t allowed;
+  ASSERT_EQ(sched_getaffinity(0, sizeof(allowed), &allowed), 0);
+  std::vector<int> cpus;
+  for (int cpu = 0; cpu < CPU_SETSIZE && cpus.size() < 2; ++cpu) {
+    if (CPU_ISSET(cpu, &allowed)) cpus.push_back(cpu);
+  }
+  if (cpus.size() < 2) {
+    GTEST_SKIP() << "Needs two cpus";
+  }
+  grpc_core::ConfigVars::Overrides overrides;
+  overrides.epoll_busy_poll_us = 1000000;
+  grpc_core::ConfigVars::SetOverrides(overrides);
+  // Takes the only busy polling slot of the first cpu (the default of
+  // GRPC_EPOLL_BUSY_POLL_MAX_THREADS) until signalled.
+  std::thread spinner([this, &cpus] {
+    PinToCpu(cpus[0]);
+    struct epoll_event events[4];
+    EXPECT_EQ(EpollWaitMaybeBusyPoll(epfd_, events, 4, -1), 1);
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  // A poller on the other cpu still spins...
+  PinToCpu(cpus[1]);
+  EXPECT_GE(CpuMicrosWaiting(50), 20000);
+  // ...but one on the first cpu blocks right away.
+  PinToCpu(cpus[0]);
+  EXPECT_LT(CpuMicrosWaiting(50), 10000);
+  Signal();
+  spinner.join();
+  sched_setaffinity(0, sizeof(allowed), &allowed);
+}
+
+TEST_F(BusyPollTest, ZeroTimeoutDoesNotSpin) {
+  struct epoll_event events[4];
+  EXPECT_EQ(EpollWaitMaybeBusyPoll(epfd_, events, 4, 0), 0);
+  Signal();
+  EXPECT_EQ(EpollWaitMaybeBusyPoll(epfd_, events, 4, 0), 1);
+}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_LINUX_EPOLL
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <stdlib.h>
 #include <string.h>
 #include <sys/socket.h>
 #include <unistd.h>
@@ -144,6 +145,22 @@ TEST(PosixEngineListenerUtils, ListenerContainerAddAllLocalAddressesTest) {
 }
 #endif  // GRPC_HAVE_IFADDRS
 
+TEST(PosixEngineListenerUtils, ListenerWithoutBusyPollPermissionTest) {
+  EXPECT_EXIT(
+      {
+        // Raising SO_BUSY_POLL needs CAP_NET_ADMIN, which root loses when it
+        // switches to another user.
+        if (geteuid() == 0 && setuid(65534) != 0) exit(2);
+        TestListenerSocketsContainer listener_sockets;
+        PosixTcpOptions options;
+        options.busy_poll_usec = 1000000;
+        auto result =
+            ListenerContainerAddWildcardAddresses(listener_sockets, options, 0);
+        exit(result.ok() && listener_sockets.Size() >= 1 ? 0 : 1);
+      },
+      ::testing::ExitedWithCode(0), "");
+}
+
 }  // namespace experimental
 }  // namespace grpc_event_engine
 
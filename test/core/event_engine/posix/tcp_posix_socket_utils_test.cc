@@ -172,6 +172,34 @@ TEST(TcpPosixSocketUtilsTest, SocketOptionsTest) {
   close(sock);
 }
 
+TEST(TcpPosixSocketUtilsTest, SocketBusyPollTest) {
+  int sock = socket(PF_INET, SOCK_STREAM, 0);
+  if (sock < 0) {
+    // Try ipv6
+    sock = socket(AF_INET6, SOCK_STREAM, 0);
+  }
+  EXPECT_GT(sock, 0);
+  PosixSocketWrapper posix_sock(sock);
+  // Not setting the option is always fine.
+  EXPECT_TRUE(posix_sock.SetSocketBusyPoll(0).ok());
+#ifdef SO_BUSY_POLL
+  absl::Status status = posix_sock.SetSocketBusyPoll(50);
+  int busy_poll_usec = -1;
+  socklen_t len = sizeof(busy_poll_usec);
+  ASSERT_EQ(
+      getsockopt(sock, SOL_SOCKET, SO_BUSY_POLL, &busy_poll_usec, &len), 0);
+  if (status.ok()) {
+    EXPECT_EQ(busy_poll_usec, 50);
+  } else {
+    // Without CAP_NET_ADMIN, the option can't go above net.core.busy_read.
+    EXPECT_NE(busy_poll_usec, 50);
+  }
+#else
+  EXPECT_FALSE(posix_sock.SetSocketBusyPoll(50).ok());
+#endif
+  close(sock);
+}
+
 }  // namespace experimental
 }  // namespace grpc_event_engine
 
@@ -0,0 +1,284 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "absl/types/optional.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <grpc/event_engine/event_engine.h>
+
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/lib/gprpp/time.h"
+
+using testing::Mock;
+using testing::Return;
+using testing::StrictMock;
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+
+class MockClosure : public experimental::EventEngine::Closure {
+ public:
+  MOCK_METHOD(void, Run, ());
+};
+
+class MockHost : public TimerListHost {
+ public:
+  virtual ~MockHost() {}
+  MOCK_METHOD(grpc_core::Timestamp, Now, ());
+  MOCK_METHOD(void, Kick, ());
+};
+
+// Host with a manually driven clock.
+class FakeHost : public TimerListHost {
+ public:
+  grpc_core::Timestamp Now() override { return now; }
+  void Kick() override {}
+
+  grpc_core::Timestamp now =
+      grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(0);
+};
+
+class CountingClosure : public experimental::EventEngine::Closure {
+ public:
+  void Run() override { ++runs; }
+  int runs = 0;
+};
+
+enum class CheckResult { kTimersFired, kCheckedAndEmpty, kNotChecked };
+
+CheckResult FinishCheck(
+    absl::optional<std::vector<experimental::EventEngine::Closure*>> result) {
+  if (!result.has_value()) return CheckResult::kNotChecked;
+  if (result->empty()) return CheckResult::kCheckedAndEmpty;
+  for (auto closure : *result) {
+    closure->Run();
+  }
+  return CheckResult::kTimersFired;
+}
+
+}  // namespace
+
+TEST(TimerWheelTest, Add) {
+  Timer timers[20];
+  StrictMock<MockClosure> closures[20];
+
+  const auto kStart =
+      grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(100);
+
+  StrictMock<MockHost> host;
+  EXPECT_CALL(host, Now()).WillOnce(Return(kStart));
+  TimerWheel timer_wheel(&host);
+
+  for (int i = 0; i < 10; i++) {
+    timer_wheel.TimerInit(&timers[i],
+                          kStart + grpc_core::Duration::Milliseconds(10),
+                          &closures[i]);
+  }
+  for (int i = 10; i < 20; i++) {
+    timer_wheel.TimerInit(&timers[i],
+                          kStart + grpc_core::Duration::Milliseconds(1010),
+                          &closures[i]);
+  }
+
+  // Only the first batch should be ready.
+  EXPECT_CALL(host, Now())
+      .WillOnce(Return(kStart + grpc_core::Duration::Milliseconds(500)));
+  for (int i = 0; i < 10; i++) {
+    EXPECT_CALL(closures[i], Run());
+  }
+  grpc_core::Timestamp next = grpc_core::Timestamp::InfFuture();
+  EXPECT_EQ(FinishCheck(timer_wheel.TimerCheck(&next)),
+            CheckResult::kTimersFired);
+  for (int i = 0; i < 10; i++) {
+    Mock::VerifyAndClearExpectations(&closures[i]);
+  }
+  // The reported wakeup may be early (when the wheel must cascade), but never
+  // late.
+  EXPECT_GT(next, kStart + grpc_core::Duration::Milliseconds(500));
+  EXPECT_LE(next, kStart + grpc_core::Duration::Milliseconds(1010));
+
+  EXPECT_CALL(host, Now())
+      .WillOnce(Return(kStart + grpc_core::Duration::Milliseconds(600)));
+  EXPECT_EQ(FinishCheck(timer_wheel.TimerCheck(nullptr)),
+            CheckResult::kCheckedAndEmpty);
+
+  EXPECT_CALL(host, Now())
+      .WillOnce(Return(kStart + grpc_core::Duration::Milliseconds(1500)));
+  for (int i = 10; i < 20; i++) {
+    EXPECT_CALL(closures[i], Run());
+  }
+  EXPECT_EQ(FinishCheck(timer_wheel.TimerCheck(nullptr)),
+            CheckResult::kTimersFired);
+  for (int i = 10; i < 20; i++) {
+    Mock::VerifyAndClearExpectations(&closures[i]);
+  }
+
+  EXPECT_CALL(host, Now())
+      .WillOnce(Return(kStart + grpc_core::Duration::Milliseconds(1600)));
+  EXPECT_EQ(FinishCheck(timer_wheel.TimerCheck(nullptr)),
+            CheckResult::kCheckedAndEmpty);
+}
+
+// Timers whose deadline already passed fire on the next check.
+TEST(TimerWheelTest, PastDeadline) {
+  FakeHost host;
+  host.now = grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(1000);
+  TimerWheel timer_wheel(&host);
+  Timer timer;
+  CountingClosure closure;
+  timer_wheel.TimerInit(
+      &timer, grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(10),
+      &closure);
+  EXPECT_EQ(FinishCheck(timer_wheel.TimerCheck(nullptr)),
+            CheckResult::kTimersFired);
+  EXPECT_EQ(closure.runs, 1);
+  EXPECT_FALSE(timer_wheel.TimerCancel(&timer));
+}
+
+// Cleaning up a wheel with pending timers.
+TEST(TimerWheelTest, Destruction) {
+  Timer timers[5];
+  StrictMock<MockClosure> closures[5];
+
+  testing::NiceMock<MockHost> host;
+  ON_CALL(host, Now())
+      .WillByDefault(
+          Return(grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(0)));
+  TimerWheel timer_wheel(&host);
+
+  timer_wheel.TimerInit(
+      &timers[0], grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(100),
+      &closures[0]);
+  timer_wheel.TimerInit(
+      &timers[1], grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(3),
+      &closures[1]);
+  timer_wheel.TimerInit(
+      &timers[2], grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(100),
+      &closures[2]);
+  timer_wheel.TimerInit(
+      &timers[3], grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(3),
+      &closures[3]);
+  timer_wheel.TimerInit(
+      &timers[4], grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(1),
+      &closures[4]);
+  EXPECT_CALL(host, Now())
+      .WillOnce(
+          Return(grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(2)));
+  EXPECT_CALL(closures[4], Run());
+  EXPECT_EQ(FinishCheck(timer_wheel.TimerCheck(nullptr)),
+            CheckResult::kTimersFired);
+  Mock::VerifyAndClearExpectations(&closures[4]);
+  EXPECT_FALSE(timer_wheel.TimerCancel(&timers[4]));
+  EXPECT_TRUE(timer_wheel.TimerCancel(&timers[0]));
+  EXPECT_TRUE(timer_wheel.TimerCancel(&timers[3]));
+  EXPECT_TRUE(timer_wheel.TimerCancel(&timers[1]));
+  EXPECT_TRUE(timer_wheel.TimerCancel(&timers[2]));
+}
+
+// Far away deadlines (including ones at the top of the representable range)
+// are filed on the outer levels and can still be cancelled.
+TEST(TimerWheelTest, LongRunningServiceCleanup) {
+  Timer timers[3];
+  StrictMock<MockClosure> closures[3];
+  const grpc_core::Duration k25Days = grpc_core::Duration::Hours(25 * 24);
+
+  FakeHost host;
+  host.now =
+      grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(k25Days.millis());
+  const grpc_core::Timestamp start = host.now;
+  TimerWheel timer_wheel(&host);
+
+  timer_wheel.TimerInit(&timers[0], start + k25Days, &closures[0]);
+  timer_wheel.TimerInit(
+      &timers[1], start + grpc_core::Duration::Milliseconds(3), &closures[1]);
+  timer_wheel.TimerInit(&timers[2],
+                        grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+                            std::numeric_limits<int64_t>::max() - 1),
+                        &closures[2]);
+
+  host.now = start + grpc_core::Duration::Milliseconds(4);
+  EXPECT_CALL(closures[1], Run());
+  EXPECT_EQ(FinishCheck(timer_wheel.TimerCheck(nullptr)),
+            CheckResult::kTimersFired);
+  EXPECT_TRUE(timer_wheel.TimerCancel(&timers[0]));
+  EXPECT_FALSE(timer_wheel.TimerCancel(&timers[1]));
+  EXPECT_TRUE(timer_wheel.TimerCancel(&timers[2]));
+}
+
+// Timers spread over several levels fire exactly once, never before their
+// deadline, and no later than the first check at or after it.
+TEST(TimerWheelTest, CascadesInOrder) {
+  constexpr int kNumTimers = 2000;
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int64_t> delay(0, 5 * 60 * 1000);
+
+  FakeHost host;
+  host.now = grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(12345);
+  TimerWheel timer_wheel(&host);
+  std::vector<Timer> timers(kNumTimers);
+  std::vector<CountingClosure> closures(kNumTimers);
+  std::vector<grpc_core::Timestamp> deadlines(kNumTimers);
+  for (int i = 0; i < kNumTimers; i++) {
+    deadlines[i] =
+        host.now + grpc_core::Duration::Milliseconds(delay(rng));
+    timer_wheel.TimerInit(&timers[i], deadlines[i], &closures[i]);
+  }
+  // Cancel every third timer.
+  for (int i = 0; i < kNumTimers; i += 3) {
+    EXPECT_TRUE(timer_wheel.TimerCancel(&timers[i]));
+  }
+
+  std::uniform_int_distribution<int64_t> step(1, 3000);
+  const grpc_core::Timestamp end =
+      host.now + grpc_core::Duration::Minutes(6);
+  while (host.now < end) {
+    grpc_core::Timestamp next = grpc_core::Timestamp::InfFuture();
+    host.now = host.now + grpc_core::Duration::Milliseconds(step(rng));
+    auto fired = timer_wheel.TimerCheck(&next);
+    ASSERT_TRUE(fired.has_value());
+    for (auto* closure : *fired) closure->Run();
+    EXPECT_GT(next, host.now);
+    for (int i = 0; i < kNumTimers; i++) {
+      if (i % 3 == 0) continue;
+      if (deadlines[i] <= host.now) {
+        ASSERT_EQ(closures[i].runs, 1) << "timer " << i << " late";
+      } else {
+        ASSERT_EQ(closures[i].runs, 0) << "timer " << i << " early";
+        // No wakeup may be scheduled past a pending deadline.
+        ASSERT_LE(next, deadlines[i]);
+      }
+    }
+  }
+  for (int i = 0; i < kNumTimers; i += 3) {
+    EXPECT_EQ(closures[i].runs, 0);
+  }
+}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
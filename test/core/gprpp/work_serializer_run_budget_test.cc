@@ -0,0 +1,117 @@
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/experiments/config.h"
+#include "src/core/lib/experiments/experiments.h"
+#include "src/core/lib/gprpp/debug_location.h"
+#include "src/core/lib/gprpp/notification.h"
+#include "src/core/lib/gprpp/work_serializer.h"
+#include "test/core/event_engine/event_engine_test_utils.h"
+#include "test/core/test_util/test_config.h"
+
+using grpc_event_engine::experimental::GetDefaultEventEngine;
+using grpc_event_engine::experimental::WaitForSingleOwner;
+
+namespace grpc_core {
+namespace {
+
+// Tests that the thread draining the queue leaves the remaining callbacks to
+// EventEngine once it has run for longer than its time slice.
+TEST(WorkSerializerRunBudgetTest, LongDrainHandsOffQueue) {
+  ASSERT_FALSE(IsWorkSerializerDispatchEnabled());
+  ASSERT_TRUE(IsWorkSerializerRunBudgetEnabled());
+  auto lock = std::make_unique<WorkSerializer>(GetDefaultEventEngine());
+  std::thread::id first_thread;
+  std::thread::id last_thread;
+  Notification done;
+  lock->Run(
+      [&]() {
+        first_thread = std::this_thread::get_id();
+        // Outlasts the time slice of the thread draining the queue.
+        lock->Run([]() { absl::SleepFor(absl::Milliseconds(10)); },
+                  DEBUG_LOCATION);
+        lock->Run(
+            [&]() {
+              last_thread = std::this_thread::get_id();
+              done.Notify();
+            },
+            DEBUG_LOCATION);
+      },
+      DEBUG_LOCATION);
+  done.WaitForNotification();
+  // Without the run budget, this thread would have drained the whole queue.
+  EXPECT_EQ(first_thread, std::this_thread::get_id());
+  EXPECT_NE(last_thread, std::this_thread::get_id());
+  lock.reset();
+  WaitForSingleOwner(GetDefaultEventEngine());
+}
+
+// Tests that the callbacks run in order across the hand-offs.
+TEST(WorkSerializerRunBudgetTest, HandOffsKeepCallbacksInOrder) {
+  auto lock = std::make_unique<WorkSerializer>(GetDefaultEventEngine());
+  constexpr int kNumCallbacks = 1000;
+  std::vector<int> order;
+  Notification done;
+  lock->Run(
+      [&]() {
+        // Goes over the callback budget of the slice several times.
+        for (int i = 0; i < kNumCallbacks; ++i) {
+          const bool last = i == kNumCallbacks - 1;
+          lock->Run(
+              [&order, &done, i, last]() {
+                order.push_back(i);
+                if (last) done.Notify();
+              },
+              DEBUG_LOCATION);
+        }
+      },
+      DEBUG_LOCATION);
+  done.WaitForNotification();
+  ASSERT_EQ(order.size(), kNumCallbacks);
+  for (int i = 0; i < kNumCallbacks; ++i) {
+    EXPECT_EQ(order[i], i);
+  }
+  lock.reset();
+  WaitForSingleOwner(GetDefaultEventEngine());
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  // The run budget bounds the drains of the thread that enqueued first,
+  // which only happen without work_serializer_dispatch.  Force both
+  // experiments so that these tests do not depend on the rollout.
+  grpc_core::ForceEnableExperiment("work_serializer_dispatch", false);
+  grpc_core::ForceEnableExperiment("work_serializer_run_budget", true);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int retval = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return retval;
+}
@@ -0,0 +1,151 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/handshaker/security/handshake_executor.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/resource_quota/connection_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "test/core/event_engine/mock_event_engine.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+using ::grpc_event_engine::experimental::MockEventEngine;
+using ::testing::_;
+
+class HandshakeExecutorTest : public ::testing::Test {
+ protected:
+  HandshakeExecutorTest()
+      : event_engine_(std::make_shared<MockEventEngine>()),
+        connection_quota_(MakeRefCounted<ConnectionQuota>()) {
+    // Hold on to the closures handed to the EventEngine so that the test
+    // decides when the running slots get a thread.
+    EXPECT_CALL(*event_engine_,
+                Run(::testing::Matcher<absl::AnyInvocable<void()>>(_)))
+        .WillRepeatedly([this](absl::AnyInvocable<void()> closure) {
+          closures_.push_back(std::move(closure));
+        });
+  }
+
+  void RunClosures() {
+    while (!closures_.empty()) {
+      auto closure = std::move(closures_.front());
+      closures_.erase(closures_.begin());
+      closure();
+    }
+  }
+
+  std::shared_ptr<MockEventEngine> event_engine_;
+  ConnectionQuotaRefPtr connection_quota_;
+  std::vector<absl::AnyInvocable<void()>> closures_;
+};
+
+TEST_F(HandshakeExecutorTest, RunsAtMostMaxConcurrentSteps) {
+  auto executor =
+      MakeRefCounted<HandshakeExecutor>(2, connection_quota_, event_engine_);
+  std::vector<int> ran;
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_TRUE(executor->Run([&ran, i]() { ran.push_back(i); }));
+  }
+  // Only two steps got a thread, the other three wait for them.
+  EXPECT_EQ(closures_.size(), 2);
+  EXPECT_TRUE(ran.empty());
+  // The first thread keeps running the queued steps once its own is done.
+  RunClosures();
+  EXPECT_THAT(ran, ::testing::ElementsAre(0, 2, 3, 4, 1));
+  // The running slots are free again.
+  EXPECT_TRUE(executor->Run([&ran]() { ran.push_back(5); }));
+  EXPECT_EQ(closures_.size(), 1);
+  RunClosures();
+  EXPECT_EQ(ran.size(), 6);
+}
+
+TEST_F(HandshakeExecutorTest, ShedsStepsWhenTheQueueIsFull) {
+  connection_quota_->SetMaxQueuedHandshakes(2);
+  auto executor =
+      MakeRefCounted<HandshakeExecutor>(1, connection_quota_, event_engine_);
+  auto memory_quota = MakeResourceQuota("test")->memory_quota();
+  int ran = 0;
+  EXPECT_TRUE(executor->Run([&ran]() { ++ran; }));
+  EXPECT_TRUE(executor->Run([&ran]() { ++ran; }));
+  EXPECT_TRUE(
+      connection_quota_->AllowIncomingConnection(memory_quota, "ipv4:1.2.3.4"));
+  EXPECT_TRUE(executor->Run([&ran]() { ++ran; }));
+  // Two steps are queued: new steps are shed and connections are refused.
+  EXPECT_FALSE(executor->Run([&ran]() { ++ran; }));
+  EXPECT_FALSE(
+      connection_quota_->AllowIncomingConnection(memory_quota, "ipv4:1.2.3.4"));
+  RunClosures();
+  EXPECT_EQ(ran, 3);
+  EXPECT_TRUE(
+      connection_quota_->AllowIncomingConnection(memory_quota, "ipv4:1.2.3.4"));
+}
+
+TEST_F(HandshakeExecutorTest, ZeroQueueShedsOnlyWhileSaturated) {
+  connection_quota_->SetMaxQueuedHandshakes(0);
+  auto executor =
+      MakeRefCounted<HandshakeExecutor>(1, connection_quota_, event_engine_);
+  auto memory_quota = MakeResourceQuota("test")->memory_quota();
+  int ran = 0;
+  // Nothing is queued, so connections are accepted even before any step ran.
+  EXPECT_TRUE(
+      connection_quota_->AllowIncomingConnection(memory_quota, "ipv4:1.2.3.4"));
+  EXPECT_TRUE(executor->Run([&ran]() { ++ran; }));
+  // The only slot is busy and no step may wait for it.
+  EXPECT_FALSE(executor->Run([&ran]() { ++ran; }));
+  EXPECT_TRUE(
+      connection_quota_->AllowIncomingConnection(memory_quota, "ipv4:1.2.3.4"));
+  RunClosures();
+  EXPECT_EQ(ran, 1);
+  // The slot is free again.
+  EXPECT_TRUE(executor->Run([&ran]() { ++ran; }));
+  RunClosures();
+  EXPECT_EQ(ran, 2);
+}
+
+TEST_F(HandshakeExecutorTest, NegativeQueueLimitIsIgnored) {
+  connection_quota_->SetMaxQueuedHandshakes(-1);
+  auto executor =
+      MakeRefCounted<HandshakeExecutor>(1, connection_quota_, event_engine_);
+  auto memory_quota = MakeResourceQuota("test")->memory_quota();
+  int ran = 0;
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_TRUE(executor->Run([&ran]() { ++ran; }));
+  }
+  EXPECT_TRUE(
+      connection_quota_->AllowIncomingConnection(memory_quota, "ipv4:1.2.3.4"));
+  RunClosures();
+  EXPECT_EQ(ran, 10);
+  // The limit can still be configured afterwards.
+  connection_quota_->SetMaxQueuedHandshakes(1);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
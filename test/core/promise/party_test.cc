@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <atomic>
 #include <memory>
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -228,6 +229,33 @@ TYPED_TEST(PartySyncTest, UnrefWhileRunning) {
           delete_paths_taken[2].load());
 }
 
+TYPED_TEST(PartySyncTest, AddParticipantsBeyondInlineSlots) {
+  TypeParam sync(1);
+  EXPECT_TRUE(sync.AddParticipantsAndRef(
+      party_detail::kInlineParticipants, [](size_t* slots) {
+        for (size_t i = 0; i < party_detail::kInlineParticipants; i++) {
+          EXPECT_EQ(slots[i], i);
+        }
+      }));
+  EXPECT_FALSE(sync.AddParticipantsAndRef(4, [](size_t* slots) {
+    for (size_t i = 0; i < 4; i++) {
+      EXPECT_EQ(slots[i], party_detail::kInlineParticipants + i);
+    }
+  }));
+  std::vector<size_t> polled;
+  EXPECT_FALSE(sync.RunParty([&polled](int slot) {
+    polled.push_back(slot);
+    return true;
+  }));
+  ASSERT_EQ(polled.size(), party_detail::kInlineParticipants + 4);
+  for (size_t i = 0; i < polled.size(); i++) {
+    EXPECT_EQ(polled[i], i);
+  }
+  EXPECT_FALSE(sync.Unref());
+  EXPECT_FALSE(sync.Unref());
+  EXPECT_TRUE(sync.Unref());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // PartyTest
 
@@ -529,6 +557,58 @@ TEST_F(PartyTest, AfterCurrentPollWorks) {
   n.WaitForNotification();
 }
 
+TEST_F(PartyTest, PollsParticipantsByPriority) {
+  auto party = MakeRefCounted<TestParty>();
+  Notification n;
+  std::vector<std::string> order;
+  auto record = [&order](std::string name) {
+    return [&order, name]() {
+      order.push_back(name);
+      return Empty{};
+    };
+  };
+  {
+    Party::BulkSpawner spawner(party.get());
+    spawner.Spawn(
+        "bulk", record("bulk"), [&n](Empty) { n.Notify(); },
+        PartyPriority::kBulk);
+    spawner.Spawn("normal", record("normal"), [](Empty) {});
+    spawner.Spawn(
+        "urgent", record("urgent"), [](Empty) {}, PartyPriority::kUrgent);
+  }
+  n.WaitForNotification();
+  EXPECT_EQ(order, std::vector<std::string>({"urgent", "normal", "bulk"}));
+}
+
+TEST_F(PartyTest, CanSpawnMoreThanSixteenParticipants) {
+  auto party = MakeRefCounted<TestParty>();
+  constexpr size_t kParticipants = 40;
+  Waker wakers[kParticipants];
+  Notification started[kParticipants];
+  Notification done[kParticipants];
+  for (size_t i = 0; i < kParticipants; i++) {
+    party->Spawn(
+        "TestSpawn",
+        [i, &wakers, &started, polled = false]() mutable -> Poll<Empty> {
+          if (polled) return Empty{};
+          polled = true;
+          wakers[i] = GetContext<Activity>()->MakeOwningWaker();
+          started[i].Notify();
+          return Pending{};
+        },
+        [i, &done](Empty) { done[i].Notify(); });
+  }
+  for (size_t i = 0; i < kParticipants; i++) {
+    started[i].WaitForNotification();
+  }
+  // Wake them up from the last one, so that the overflow participants are
+  // woken up first.
+  for (size_t i = kParticipants; i > 0; i--) {
+    wakers[i - 1].Wakeup();
+    done[i - 1].WaitForNotification();
+  }
+}
+
 TEST_F(PartyTest, ThreadStressTest) {
   auto party = MakeRefCounted<TestParty>();
   std::vector<std::thread> threads;
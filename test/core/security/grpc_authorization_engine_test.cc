@@ -25,6 +25,8 @@
 
 #include "src/core/lib/json/json.h"
 #include "src/core/lib/security/authorization/audit_logging.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/transport/metadata_batch.h"
 #include "test/core/test_util/audit_logging_utils.h"
 #include "test/core/test_util/evaluate_args_test_util.h"
 
@@ -342,6 +344,84 @@ TEST_F(GrpcAuthorizationEngineTest, MultipleAuditLoggerInvoked) {
               kPolicyName, kSpiffeId, kRpcMethod)));
 }
 
+TEST_F(GrpcAuthorizationEngineTest, MatchesExactPathAndHeaderLists) {
+  std::vector<std::unique_ptr<Rbac::Permission>> paths;
+  for (const char* path : {"/foo.Bar/Other", "/foo.Bar/Echo"}) {
+    paths.push_back(std::make_unique<Rbac::Permission>(
+        Rbac::Permission::MakePathPermission(
+            StringMatcher::Create(StringMatcher::Type::kExact, path).value())));
+  }
+  std::vector<std::unique_ptr<Rbac::Principal>> headers;
+  for (const char* value : {"a", "b"}) {
+    headers.push_back(std::make_unique<Rbac::Principal>(
+        Rbac::Principal::MakeHeaderPrincipal(
+            HeaderMatcher::Create("key", HeaderMatcher::Type::kExact, value)
+                .value())));
+  }
+  std::map<std::string, Rbac::Policy> policies;
+  policies["policy1"] =
+      Rbac::Policy(Rbac::Permission::MakeOrPermission(std::move(paths)),
+                   Rbac::Principal::MakeOrPrincipal(std::move(headers)));
+  GrpcAuthorizationEngine engine(
+      Rbac("authz", Rbac::Action::kAllow, std::move(policies)));
+  EXPECT_EQ(engine.Evaluate(evaluate_args_util_.MakeEvaluateArgs()).type,
+            AuthorizationEngine::Decision::Type::kDeny);
+  evaluate_args_util_.AddPairToMetadata("key", "b");
+  AuthorizationEngine::Decision decision =
+      engine.Evaluate(evaluate_args_util_.MakeEvaluateArgs());
+  EXPECT_EQ(decision.type, AuthorizationEngine::Decision::Type::kAllow);
+  EXPECT_EQ(decision.matching_policy_name, "policy1");
+  // The path is not matched when it is missing.
+  EXPECT_EQ(engine.Evaluate(EvaluateArgs(nullptr, nullptr)).type,
+            AuthorizationEngine::Decision::Type::kDeny);
+}
+
+TEST_F(GrpcAuthorizationEngineTest, PrincipalsAreEvaluatedOncePerChannel) {
+  std::map<std::string, Rbac::Policy> policies;
+  policies["policy1"] = Rbac::Policy(
+      Rbac::Permission::MakeAnyPermission(),
+      Rbac::Principal::MakeAuthenticatedPrincipal(absl::nullopt));
+  GrpcAuthorizationEngine engine(
+      Rbac("authz", Rbac::Action::kAllow, std::move(policies)));
+  EvaluateArgs::PerChannelArgs channel_args(nullptr, ChannelArgs());
+  channel_args.transport_security_type = GRPC_SSL_TRANSPORT_SECURITY_TYPE;
+  EXPECT_EQ(engine.Evaluate(EvaluateArgs(nullptr, &channel_args)).type,
+            AuthorizationEngine::Decision::Type::kAllow);
+  // The peer of a channel does not change: the result of the principal is
+  // memoized.
+  channel_args.transport_security_type = "";
+  EXPECT_EQ(engine.Evaluate(EvaluateArgs(nullptr, &channel_args)).type,
+            AuthorizationEngine::Decision::Type::kAllow);
+  // Other channels get their own results.
+  EvaluateArgs::PerChannelArgs other_channel_args(nullptr, ChannelArgs());
+  EXPECT_EQ(engine.Evaluate(EvaluateArgs(nullptr, &other_channel_args)).type,
+            AuthorizationEngine::Decision::Type::kDeny);
+}
+
+TEST_F(GrpcAuthorizationEngineTest, PrepareChannelEvaluatesChannelRules) {
+  std::map<std::string, Rbac::Policy> policies;
+  policies["policy1"] = Rbac::Policy(
+      Rbac::Permission::MakePathPermission(
+          StringMatcher::Create(StringMatcher::Type::kExact, kRpcMethod)
+              .value()),
+      Rbac::Principal::MakeAuthenticatedPrincipal(absl::nullopt));
+  GrpcAuthorizationEngine engine(
+      Rbac("authz", Rbac::Action::kAllow, std::move(policies)));
+  EvaluateArgs::PerChannelArgs channel_args(nullptr, ChannelArgs());
+  channel_args.transport_security_type = GRPC_SSL_TRANSPORT_SECURITY_TYPE;
+  engine.PrepareChannel(EvaluateArgs(nullptr, &channel_args));
+  // Only the path is left to be evaluated per call.
+  channel_args.transport_security_type = "";
+  EXPECT_EQ(engine.Evaluate(EvaluateArgs(nullptr, &channel_args)).type,
+            AuthorizationEngine::Decision::Type::kDeny);
+  grpc_metadata_batch metadata;
+  metadata.Set(HttpPathMetadata(), Slice::FromStaticString(kRpcMethod));
+  AuthorizationEngine::Decision decision =
+      engine.Evaluate(EvaluateArgs(&metadata, &channel_args));
+  EXPECT_EQ(decision.type, AuthorizationEngine::Decision::Type::kAllow);
+  EXPECT_EQ(decision.matching_policy_name, "policy1");
+}
+
 }  // namespace grpc_core
 
 int main(int argc, char** argv) {
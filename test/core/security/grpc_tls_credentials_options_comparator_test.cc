@@ -183,6 +183,16 @@ TEST(TlsCredentialsOptionsComparatorTest, DifferentSendClientCaListValues) {
   delete options_1;
   delete options_2;
 }
+TEST(TlsCredentialsOptionsComparatorTest, DifferentSessionTicketKeyProvider) {
+  auto* options_1 = grpc_tls_credentials_options_create();
+  auto* options_2 = grpc_tls_credentials_options_create();
+  options_1->set_session_ticket_key_provider(MakeRefCounted<FileWatcherSessionTicketKeyProvider>("session_ticket_keys_1", 1));
+  options_2->set_session_ticket_key_provider(MakeRefCounted<FileWatcherSessionTicketKeyProvider>("session_ticket_keys_2", 1));
+  EXPECT_FALSE(*options_1 == *options_2);
+  EXPECT_FALSE(*options_2 == *options_1);
+  delete options_1;
+  delete options_2;
+}
 
 } // namespace
 } // namespace grpc_core
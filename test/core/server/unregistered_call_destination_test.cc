@@ -0,0 +1,161 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#ifdef GPR_SUPPORT_CHANNELS_FROM_FD
+
+#include <string.h>
+#include <sys/socket.h>
+
+#include <string>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/status/status.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+#include <grpc/slice.h>
+
+#include "src/core/ext/transport/shm/shm_transport.h"
+#include "src/core/lib/experiments/config.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/slice/slice_internal.h"
+#include "src/core/lib/transport/call_destination.h"
+#include "src/core/lib/transport/call_spine.h"
+#include "src/core/lib/transport/metadata_batch.h"
+#include "src/core/server/server.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+void* Tag(intptr_t t) { return reinterpret_cast<void*>(t); }
+
+// Stands in for the backend that the server forwards calls to: fails each
+// call with a status that only it produces.
+class Backend final : public UnstartedCallDestination {
+ public:
+  void StartCall(UnstartedCallHandler unstarted_call_handler) override {
+    {
+      MutexLock lock(&mu_);
+      paths_.emplace_back(
+          unstarted_call_handler.UnprocessedClientInitialMetadata()
+              .get_pointer(HttpPathMetadata())
+              ->as_string_view());
+    }
+    unstarted_call_handler.V2HackToStartCallWithoutACallFilterStack()
+        .PushServerTrailingMetadata(ServerMetadataFromStatus(
+            absl::FailedPreconditionError("reached the backend")));
+  }
+
+  void Orphaned() override {}
+
+  std::vector<std::string> paths() {
+    MutexLock lock(&mu_);
+    return paths_;
+  }
+
+ private:
+  Mutex mu_;
+  std::vector<std::string> paths_ ABSL_GUARDED_BY(mu_);
+};
+
+TEST(UnregisteredCallDestinationTest, ForwardsUnregisteredCalls) {
+  auto backend = MakeRefCounted<Backend>();
+  grpc_completion_queue* cq = grpc_completion_queue_create_for_next(nullptr);
+  grpc_server* server = grpc_server_create(nullptr, nullptr);
+  grpc_server_register_completion_queue(server, cq, nullptr);
+  Server::FromC(server)->SetUnregisteredCallDestination(
+      MakeRefCounted<ForwardingCallDestination>(backend));
+  grpc_server_start(server);
+  int fds[2];
+  CHECK_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+  grpc_server_add_shm_channel_from_fd(server, fds[1]);
+  grpc_channel* channel =
+      grpc_shm_channel_create_from_fd("target", fds[0], nullptr);
+  // The application never requests calls: only the backend can finish this
+  // one.
+  grpc_call* call = grpc_channel_create_call(
+      channel, nullptr, GRPC_PROPAGATE_DEFAULTS, cq,
+      grpc_slice_from_static_string("/unregistered/Method"), nullptr,
+      grpc_timeout_seconds_to_deadline(10), nullptr);
+  grpc_metadata_array initial_metadata_recv;
+  grpc_metadata_array trailing_metadata_recv;
+  grpc_metadata_array_init(&initial_metadata_recv);
+  grpc_metadata_array_init(&trailing_metadata_recv);
+  grpc_status_code status;
+  grpc_slice details;
+  grpc_op ops[4];
+  memset(ops, 0, sizeof(ops));
+  ops[0].op = GRPC_OP_SEND_INITIAL_METADATA;
+  ops[1].op = GRPC_OP_SEND_CLOSE_FROM_CLIENT;
+  ops[2].op = GRPC_OP_RECV_INITIAL_METADATA;
+  ops[2].data.recv_initial_metadata.recv_initial_metadata =
+      &initial_metadata_recv;
+  ops[3].op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+  ops[3].data.recv_status_on_client.trailing_metadata = &trailing_metadata_recv;
+  ops[3].data.recv_status_on_client.status = &status;
+  ops[3].data.recv_status_on_client.status_details = &details;
+  ASSERT_EQ(grpc_call_start_batch(call, ops, 4, Tag(1), nullptr),
+            GRPC_CALL_OK);
+  grpc_event ev = grpc_completion_queue_next(
+      cq, grpc_timeout_seconds_to_deadline(10), nullptr);
+  ASSERT_EQ(ev.type, GRPC_OP_COMPLETE);
+  EXPECT_EQ(ev.tag, Tag(1));
+  EXPECT_EQ(status, GRPC_STATUS_FAILED_PRECONDITION);
+  EXPECT_EQ(StringViewFromSlice(details), "reached the backend");
+  EXPECT_THAT(backend->paths(), ::testing::ElementsAre("/unregistered/Method"));
+  grpc_slice_unref(details);
+  grpc_metadata_array_destroy(&initial_metadata_recv);
+  grpc_metadata_array_destroy(&trailing_metadata_recv);
+  grpc_call_unref(call);
+  grpc_channel_destroy(channel);
+  grpc_server_shutdown_and_notify(server, cq, Tag(2));
+  grpc_server_cancel_all_calls(server);
+  ev = grpc_completion_queue_next(cq, grpc_timeout_seconds_to_deadline(10),
+                                  nullptr);
+  ASSERT_EQ(ev.type, GRPC_OP_COMPLETE);
+  EXPECT_EQ(ev.tag, Tag(2));
+  grpc_server_destroy(server);
+  grpc_completion_queue_shutdown(cq);
+  while (grpc_completion_queue_next(cq, gpr_inf_future(GPR_CLOCK_REALTIME),
+                                    nullptr)
+             .type != GRPC_QUEUE_SHUTDOWN) {
+  }
+  grpc_completion_queue_destroy(cq);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+#endif  // GPR_SUPPORT_CHANNELS_FROM_FD
+
+int main(int argc, char** argv) {
+  // Calls are only handed to the server's call destinations by the promise
+  // based transports.
+  grpc_core::ForceEnableExperiment("event_engine_client", true);
+  grpc_core::ForceEnableExperiment("event_engine_listener", true);
+  grpc_core::ForceEnableExperiment("promise_based_client_call", true);
+  grpc_core::ForceEnableExperiment("promise_based_server_call", true);
+  grpc_core::ForceEnableExperiment("chaotic_good", true);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int r = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return r;
+}
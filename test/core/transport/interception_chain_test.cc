@@ -23,6 +23,7 @@
 
 #include "src/core/lib/channel/promise_based_filter.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/transport/call_destination.h"
 #include "test/core/promise/poll_matcher.h"
 
 namespace grpc_core {
@@ -336,6 +337,25 @@ TEST_F(InterceptionChainTest, FiltersThenHijacked) {
             "true");
 }
 
+TEST_F(InterceptionChainTest, FiltersThenForwarded) {
+  auto r = InterceptionChainBuilder(ChannelArgs())
+               .Add<TestFilter<1>>()
+               .Build(
+                   MakeRefCounted<ForwardingCallDestination>(destination()));
+  ASSERT_TRUE(r.ok()) << r.status();
+  auto finished_call = RunCall(r.value().get());
+  EXPECT_EQ(finished_call.server_metadata->get(GrpcStatusMetadata()),
+            GRPC_STATUS_INTERNAL);
+  EXPECT_EQ(finished_call.server_metadata->get_pointer(GrpcMessageMetadata())
+                ->as_string_view(),
+            "👊 cancelled");
+  EXPECT_NE(finished_call.client_metadata, nullptr);
+  std::string backing;
+  EXPECT_EQ(finished_call.client_metadata->GetStringValue("passed-through-1",
+                                                          &backing),
+            "true");
+}
+
 TEST_F(InterceptionChainTest, FailsToInstantiateInterceptor) {
   auto r = InterceptionChainBuilder(ChannelArgs())
                .Add<TestFailingInterceptor<1>>()
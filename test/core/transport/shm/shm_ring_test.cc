@@ -0,0 +1,178 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/shm/shm_ring.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace shm {
+namespace {
+
+constexpr size_t kCapacity = SharedMemoryRing::kMinCapacity;
+
+class SharedMemoryRingTest : public ::testing::Test {
+ protected:
+  SharedMemoryRingTest()
+      : memory_(new uint64_t[SharedMemoryRing::RequiredBytes(kCapacity) /
+                             sizeof(uint64_t)]),
+        producer_(SharedMemoryRing::Create(memory_.get(), kCapacity)),
+        consumer_(SharedMemoryRing::Attach(memory_.get(), kCapacity)) {}
+
+  // The positions in the ring header, as a misbehaving peer could overwrite
+  // them. Each of them is on its own cache line.
+  uint64_t& shared_read_pos() { return memory_[0]; }
+  uint64_t& shared_write_pos() { return memory_[64 / sizeof(uint64_t)]; }
+
+  std::unique_ptr<uint64_t[]> memory_;
+  SharedMemoryRing producer_;
+  SharedMemoryRing consumer_;
+};
+
+TEST_F(SharedMemoryRingTest, AttachValidatesHeader) {
+  EXPECT_TRUE(consumer_.valid());
+  EXPECT_FALSE(SharedMemoryRing::Attach(memory_.get(), kCapacity * 2).valid());
+}
+
+TEST_F(SharedMemoryRingTest, WriteThenRead) {
+  const uint8_t in[] = {1, 2, 3, 4, 5};
+  EXPECT_EQ(producer_.Write(in, sizeof(in)), sizeof(in));
+  EXPECT_EQ(consumer_.ReadableBytes(), sizeof(in));
+  uint8_t out[8];
+  EXPECT_EQ(consumer_.Read(out, sizeof(out)), sizeof(in));
+  EXPECT_EQ(memcmp(in, out, sizeof(in)), 0);
+  EXPECT_EQ(consumer_.ReadableBytes(), 0u);
+}
+
+TEST_F(SharedMemoryRingTest, WriteStopsWhenFull) {
+  std::vector<uint8_t> in(kCapacity + 100, 7);
+  EXPECT_EQ(producer_.Write(in.data(), in.size()), kCapacity);
+  EXPECT_EQ(producer_.WritableBytes(), 0u);
+  EXPECT_EQ(producer_.Write(in.data(), 1), 0u);
+}
+
+TEST_F(SharedMemoryRingTest, WrapsAround) {
+  std::vector<uint8_t> scratch(kCapacity);
+  // Move the positions close to the end of the data area.
+  ASSERT_EQ(producer_.Write(scratch.data(), kCapacity - 3), kCapacity - 3);
+  ASSERT_EQ(consumer_.Read(scratch.data(), kCapacity - 3), kCapacity - 3);
+  std::vector<uint8_t> in(10);
+  for (size_t i = 0; i < in.size(); ++i) in[i] = static_cast<uint8_t>(i);
+  EXPECT_EQ(producer_.Write(in.data(), in.size()), in.size());
+  std::vector<uint8_t> out(in.size());
+  EXPECT_EQ(consumer_.Read(out.data(), out.size()), out.size());
+  EXPECT_EQ(in, out);
+}
+
+TEST_F(SharedMemoryRingTest, DataWaiterIsReportedOnce) {
+  EXPECT_FALSE(producer_.ConsumeDataWaiter());
+  EXPECT_TRUE(consumer_.PrepareToWaitForData());
+  const uint8_t byte = 42;
+  producer_.Write(&byte, 1);
+  EXPECT_TRUE(producer_.ConsumeDataWaiter());
+  EXPECT_FALSE(producer_.ConsumeDataWaiter());
+  // Data is available, so there's no point in waiting.
+  EXPECT_FALSE(consumer_.PrepareToWaitForData());
+}
+
+TEST_F(SharedMemoryRingTest, SpaceWaiterIsReportedOnce) {
+  std::vector<uint8_t> scratch(kCapacity);
+  producer_.Write(scratch.data(), scratch.size());
+  EXPECT_TRUE(producer_.PrepareToWaitForSpace());
+  consumer_.Read(scratch.data(), 1);
+  EXPECT_TRUE(consumer_.ConsumeSpaceWaiter());
+  EXPECT_FALSE(consumer_.ConsumeSpaceWaiter());
+  EXPECT_FALSE(producer_.PrepareToWaitForSpace());
+}
+
+TEST_F(SharedMemoryRingTest, CloseIsVisibleToPeer) {
+  EXPECT_FALSE(consumer_.closed());
+  producer_.Close();
+  EXPECT_TRUE(consumer_.closed());
+}
+
+TEST_F(SharedMemoryRingTest, WritePosBeyondCapacityIsRejected) {
+  shared_write_pos() = uint64_t{1} << 40;
+  EXPECT_EQ(consumer_.ReadableBytes(), 0u);
+  EXPECT_TRUE(consumer_.corrupted());
+  uint8_t out[8];
+  EXPECT_EQ(consumer_.Read(out, sizeof(out)), 0u);
+  EXPECT_FALSE(consumer_.PrepareToWaitForData());
+  EXPECT_EQ(shared_read_pos(), 0u);
+}
+
+TEST_F(SharedMemoryRingTest, WritePosMovingBackwardsIsRejected) {
+  std::vector<uint8_t> scratch(10);
+  ASSERT_EQ(producer_.Write(scratch.data(), scratch.size()), scratch.size());
+  ASSERT_EQ(consumer_.ReadableBytes(), scratch.size());
+  shared_write_pos() = 5;
+  EXPECT_EQ(consumer_.Read(scratch.data(), scratch.size()), 0u);
+  EXPECT_TRUE(consumer_.corrupted());
+}
+
+TEST_F(SharedMemoryRingTest, ReadPosAheadOfWritePosIsRejected) {
+  shared_read_pos() = 100;
+  const uint8_t byte = 42;
+  EXPECT_EQ(producer_.Write(&byte, 1), 0u);
+  EXPECT_TRUE(producer_.corrupted());
+  EXPECT_EQ(producer_.WritableBytes(), 0u);
+  EXPECT_FALSE(producer_.PrepareToWaitForSpace());
+  EXPECT_EQ(shared_write_pos(), 0u);
+}
+
+TEST_F(SharedMemoryRingTest, ConcurrentTransfer) {
+  constexpr size_t kTotal = 1024 * 1024;
+  std::thread producer([this] {
+    uint8_t chunk[777];
+    size_t sent = 0;
+    while (sent < kTotal) {
+      const size_t want = std::min(sizeof(chunk), kTotal - sent);
+      for (size_t i = 0; i < want; ++i) {
+        chunk[i] = static_cast<uint8_t>((sent + i) * 31);
+      }
+      size_t done = 0;
+      while (done < want) {
+        done += producer_.Write(chunk + done, want - done);
+      }
+      sent += want;
+    }
+  });
+  size_t received = 0;
+  uint8_t chunk[1000];
+  while (received < kTotal) {
+    const size_t n = consumer_.Read(chunk, sizeof(chunk));
+    for (size_t i = 0; i < n; ++i) {
+      ASSERT_EQ(chunk[i], static_cast<uint8_t>((received + i) * 31));
+    }
+    received += n;
+  }
+  producer.join();
+}
+
+}  // namespace
+}  // namespace shm
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,114 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/shm/shm_transport.h"
+
+#include <grpc/support/port_platform.h>
+
+#ifdef GPR_SUPPORT_CHANNELS_FROM_FD
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "absl/log/check.h"
+#include "absl/status/statusor.h"
+#include "absl/synchronization/notification.h"
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/transport/transport.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+class SharedMemoryHandshakeTest : public ::testing::Test {
+ protected:
+  SharedMemoryHandshakeTest() {
+    CHECK_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds_), 0);
+  }
+
+  // Starts the server side, which must return without waiting for the client.
+  void StartServer() {
+    ExecCtx exec_ctx;
+    MakeSharedMemoryServerTransport(
+        fds_[1], ChannelArgs(),
+        [this](absl::StatusOr<OrphanablePtr<Transport>> transport) {
+          server_transport_ = std::move(transport);
+          server_done_.Notify();
+        });
+  }
+
+  int fds_[2];
+  absl::StatusOr<OrphanablePtr<Transport>> server_transport_;
+  absl::Notification server_done_;
+};
+
+// Both ends are set up one after the other from the same thread, which would
+// deadlock if either side blocked on the other.
+TEST_F(SharedMemoryHandshakeTest, ServerThenClientOnOneThread) {
+  StartServer();
+  EXPECT_FALSE(server_done_.HasBeenNotified());
+  auto client_transport = [&] {
+    ExecCtx exec_ctx;
+    return MakeSharedMemoryClientTransport(fds_[0], ChannelArgs());
+  }();
+  ASSERT_TRUE(client_transport.ok()) << client_transport.status();
+  ASSERT_TRUE(server_done_.WaitForNotificationWithTimeout(absl::Seconds(10)));
+  EXPECT_TRUE(server_transport_.ok()) << server_transport_.status();
+  ExecCtx exec_ctx;
+  client_transport->reset();
+  server_transport_->reset();
+}
+
+TEST_F(SharedMemoryHandshakeTest, ClientThenServerOnOneThread) {
+  auto client_transport = [&] {
+    ExecCtx exec_ctx;
+    return MakeSharedMemoryClientTransport(fds_[0], ChannelArgs());
+  }();
+  ASSERT_TRUE(client_transport.ok()) << client_transport.status();
+  StartServer();
+  ASSERT_TRUE(server_done_.WaitForNotificationWithTimeout(absl::Seconds(10)));
+  EXPECT_TRUE(server_transport_.ok()) << server_transport_.status();
+  ExecCtx exec_ctx;
+  client_transport->reset();
+  server_transport_->reset();
+}
+
+TEST_F(SharedMemoryHandshakeTest, ClientHangsUp) {
+  StartServer();
+  close(fds_[0]);
+  ASSERT_TRUE(server_done_.WaitForNotificationWithTimeout(absl::Seconds(10)));
+  EXPECT_FALSE(server_transport_.ok());
+  close(fds_[1]);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+#endif  // GPR_SUPPORT_CHANNELS_FROM_FD
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int r = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return r;
+}
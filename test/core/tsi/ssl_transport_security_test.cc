@@ -22,6 +22,8 @@
 #include <stdio.h>
 #include <string.h>
 
+#include <string>
+
 #include <gtest/gtest.h>
 #include <openssl/crypto.h>
 #include <openssl/err.h>
@@ -36,7 +38,9 @@
 
 #include "src/core/lib/gprpp/crash.h"
 #include "src/core/lib/gprpp/memory.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/security/security_connector/security_connector.h"
+#include "src/core/tsi/ssl/session_ticket/ssl_session_ticket_key_ring.h"
 #include "src/core/tsi/transport_security.h"
 #include "src/core/tsi/transport_security_interface.h"
 #include "test/core/test_util/build.h"
@@ -112,6 +116,7 @@ typedef struct ssl_tsi_test_fixture {
   bool session_reused;
   const char* session_ticket_key;
   size_t session_ticket_key_size;
+  tsi::SslSessionTicketKeyRing* session_ticket_key_ring;
   size_t network_bio_buf_size;
   size_t ssl_bio_buf_size;
   bool verify_root_cert_subject;
@@ -193,6 +198,7 @@ static void ssl_test_setup_handshakers(tsi_test_fixture* fixture) {
   server_options.send_client_ca_list = test_send_client_ca_list;
   server_options.session_ticket_key = ssl_fixture->session_ticket_key;
   server_options.session_ticket_key_size = ssl_fixture->session_ticket_key_size;
+  server_options.session_ticket_key_ring = ssl_fixture->session_ticket_key_ring;
   server_options.min_tls_version = test_tls_version;
   server_options.max_tls_version = test_tls_version;
   ASSERT_EQ(tsi_create_ssl_server_handshaker_factory_with_options(
@@ -614,6 +620,7 @@ static tsi_test_fixture* ssl_tsi_test_fixture_create() {
   ssl_fixture->session_reused = false;
   ssl_fixture->session_ticket_key = nullptr;
   ssl_fixture->session_ticket_key_size = 0;
+  ssl_fixture->session_ticket_key_ring = nullptr;
   ssl_fixture->force_client_auth = false;
   ssl_fixture->network_bio_buf_size = 0;
   ssl_fixture->ssl_bio_buf_size = 0;
@@ -938,6 +945,47 @@ void ssl_tsi_test_do_handshake_session_cache() {
   tsi_ssl_session_cache_unref(session_cache);
 }
 
+void ssl_tsi_test_do_handshake_session_ticket_key_ring() {
+  gpr_log(GPR_INFO, "ssl_tsi_test_do_handshake_session_ticket_key_ring");
+  tsi_ssl_session_cache* session_cache = tsi_ssl_session_cache_create_lru(16);
+  auto key_ring = grpc_core::MakeRefCounted<tsi::SslSessionTicketKeyRing>();
+  auto do_handshake = [&key_ring, &session_cache](bool session_reused) {
+    tsi_test_fixture* fixture = ssl_tsi_test_fixture_create();
+    ssl_tsi_test_fixture* ssl_fixture =
+        reinterpret_cast<ssl_tsi_test_fixture*>(fixture);
+    ssl_fixture->server_name_indication =
+        const_cast<char*>("waterzooi.test.google.be");
+    ssl_fixture->session_ticket_key_ring = key_ring.get();
+    tsi_ssl_session_cache_ref(session_cache);
+    ssl_fixture->session_cache = session_cache;
+    ssl_fixture->session_reused = session_reused;
+    tsi_test_do_round_trip(&ssl_fixture->base);
+    tsi_test_fixture_destroy(fixture);
+  };
+  const std::string key_a(tsi::kSslSessionTicketKeySize, 'a');
+  const std::string key_b(tsi::kSslSessionTicketKeySize, 'b');
+  const std::string key_c(tsi::kSslSessionTicketKeySize, 'c');
+  ASSERT_TRUE(key_ring->SetKeys(key_a).ok());
+  // Every server handshaker factory sharing the keys resumes the session.
+  do_handshake(false);
+  do_handshake(true);
+  // Rotating in a new key keeps the tickets of the old one valid, and renews
+  // them with the new one.
+  ASSERT_TRUE(key_ring->SetKeys(key_b + key_a).ok());
+  do_handshake(true);
+  ASSERT_TRUE(key_ring->SetKeys(key_b).ok());
+  do_handshake(true);
+  // Dropping the key of a ticket invalidates it.
+  ASSERT_TRUE(key_ring->SetKeys(key_c).ok());
+  do_handshake(false);
+  do_handshake(true);
+  // Keys of the wrong size are rejected.
+  EXPECT_FALSE(key_ring->SetKeys("").ok());
+  EXPECT_FALSE(key_ring->SetKeys(key_c + "c").ok());
+  do_handshake(true);
+  tsi_ssl_session_cache_unref(session_cache);
+}
+
 void ssl_tsi_test_do_handshake_with_intermediate_ca() {
   gpr_log(
       GPR_INFO,
@@ -1289,6 +1337,7 @@ TEST(SslTransportSecurityTest, MainTest) {
       // These tests fail with openssl3 and openssl111 currently but not
       // boringssl
       ssl_tsi_test_do_handshake_session_cache();
+      ssl_tsi_test_do_handshake_session_ticket_key_ring();
       ssl_tsi_test_do_round_trip_for_all_configs();
       ssl_tsi_test_do_round_trip_with_error_on_stack();
       ssl_tsi_test_do_round_trip_odd_buffer_size();
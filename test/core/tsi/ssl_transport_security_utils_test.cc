@@ -16,6 +16,7 @@
 
 #include "src/core/tsi/ssl_transport_security_utils.h"
 
+#include <algorithm>
 #include <array>
 #include <string>
 #include <vector>
@@ -33,6 +34,8 @@
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 
+#include <grpc/slice_buffer.h>
+
 #include "src/core/lib/gprpp/load_file.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/tsi/transport_security.h"
@@ -445,6 +448,129 @@ TEST_P(FlowTest,
   EXPECT_THAT(unprotected_output_bytes, ContainerEq(unprotected_bytes));
 }
 
+// Splits |bytes| into slices of growing sizes, so that both the in-place and
+// the gathering paths of the zero-copy protector are exercised.
+void AddBytesAsSlices(const std::vector<uint8_t>& bytes,
+                      grpc_slice_buffer* slices) {
+  std::size_t offset = 0;
+  std::size_t slice_size = 1;
+  while (offset < bytes.size()) {
+    std::size_t size = std::min(slice_size, bytes.size() - offset);
+    grpc_slice_buffer_add(
+        slices, grpc_slice_from_copied_buffer(
+                    reinterpret_cast<const char*>(bytes.data() + offset),
+                    size));
+    offset += size;
+    slice_size *= 7;
+  }
+}
+
+std::vector<uint8_t> BytesFromSlices(grpc_slice_buffer* slices) {
+  std::vector<uint8_t> bytes;
+  for (std::size_t i = 0; i < slices->count; ++i) {
+    bytes.insert(bytes.end(), GRPC_SLICE_START_PTR(slices->slices[i]),
+                 GRPC_SLICE_END_PTR(slices->slices[i]));
+  }
+  return bytes;
+}
+
+// Protects several frames worth of plaintext with the zero-copy protector on
+// the client and unprotects them on the server, either all at once (which
+// overflows the server BIO) or a few bytes at a time.
+TEST_P(FlowTest, ZeroCopyClientMessageToServerCanBeProtectedAndUnprotected) {
+  constexpr std::size_t kMaxPayloadSize =
+      kMaxPlaintextBytesPerTlsRecord - kTlsRecordOverhead;
+  std::vector<uint8_t> unprotected_bytes(GetParam().plaintext_size * 8);
+  for (std::size_t i = 0; i < unprotected_bytes.size(); ++i) {
+    unprotected_bytes[i] = static_cast<uint8_t>(i * 31);
+  }
+  grpc_slice_buffer unprotected_slices;
+  grpc_slice_buffer protected_slices;
+  grpc_slice_buffer unprotected_output_slices;
+  grpc_slice_buffer_init(&unprotected_slices);
+  grpc_slice_buffer_init(&protected_slices);
+  grpc_slice_buffer_init(&unprotected_output_slices);
+  AddBytesAsSlices(unprotected_bytes, &unprotected_slices);
+
+  EXPECT_EQ(SslZeroCopyProtectorProtect(client_ssl, client_bio,
+                                        kMaxPayloadSize, client_buffer.data(),
+                                        &unprotected_slices, &protected_slices),
+            tsi_result::TSI_OK);
+  EXPECT_EQ(unprotected_slices.length, 0);
+  // Each protected slice holds exactly one frame.
+  EXPECT_EQ(protected_slices.count,
+            (unprotected_bytes.size() + kMaxPayloadSize - 1) / kMaxPayloadSize);
+  for (std::size_t i = 0; i < protected_slices.count; ++i) {
+    const uint8_t* frame = GRPC_SLICE_START_PTR(protected_slices.slices[i]);
+    EXPECT_EQ(frame[0], '\x17');
+    EXPECT_EQ(CalculateRecordSizeFromHeader(frame[3], frame[4]),
+              GRPC_SLICE_LENGTH(protected_slices.slices[i]) - 5);
+  }
+
+  if (GetParam().plaintext_size < kMaxPlaintextBytesPerTlsRecord) {
+    // Hand the frames to the server in small pieces.
+    std::vector<uint8_t> protected_bytes = BytesFromSlices(&protected_slices);
+    grpc_slice_buffer_reset_and_unref(&protected_slices);
+    for (std::size_t offset = 0; offset < protected_bytes.size();
+         offset += 7) {
+      grpc_slice_buffer_add(
+          &protected_slices,
+          grpc_slice_from_copied_buffer(
+              reinterpret_cast<const char*>(protected_bytes.data() + offset),
+              std::min<std::size_t>(7, protected_bytes.size() - offset)));
+      int min_progress_size = 0;
+      EXPECT_EQ(SslZeroCopyProtectorUnprotect(
+                    server_ssl, server_bio, &protected_slices,
+                    &unprotected_output_slices, &min_progress_size),
+                tsi_result::TSI_OK);
+      EXPECT_GE(min_progress_size, 1);
+    }
+  } else {
+    int min_progress_size = 0;
+    EXPECT_EQ(SslZeroCopyProtectorUnprotect(
+                  server_ssl, server_bio, &protected_slices,
+                  &unprotected_output_slices, &min_progress_size),
+              tsi_result::TSI_OK);
+    EXPECT_EQ(protected_slices.length, 0);
+    EXPECT_GE(min_progress_size, 1);
+  }
+  EXPECT_THAT(BytesFromSlices(&unprotected_output_slices),
+              ContainerEq(unprotected_bytes));
+
+  grpc_slice_buffer_destroy(&unprotected_slices);
+  grpc_slice_buffer_destroy(&protected_slices);
+  grpc_slice_buffer_destroy(&unprotected_output_slices);
+}
+
+TEST_P(FlowTest, ZeroCopyServerMessageToClientCanBeProtectedAndUnprotected) {
+  constexpr std::size_t kMaxPayloadSize =
+      kMaxPlaintextBytesPerTlsRecord - kTlsRecordOverhead;
+  std::vector<uint8_t> unprotected_bytes(GetParam().plaintext_size, 'a');
+  grpc_slice_buffer unprotected_slices;
+  grpc_slice_buffer protected_slices;
+  grpc_slice_buffer unprotected_output_slices;
+  grpc_slice_buffer_init(&unprotected_slices);
+  grpc_slice_buffer_init(&protected_slices);
+  grpc_slice_buffer_init(&unprotected_output_slices);
+  AddBytesAsSlices(unprotected_bytes, &unprotected_slices);
+
+  EXPECT_EQ(SslZeroCopyProtectorProtect(server_ssl, server_bio,
+                                        kMaxPayloadSize, server_buffer.data(),
+                                        &unprotected_slices, &protected_slices),
+            tsi_result::TSI_OK);
+  EXPECT_EQ(SslZeroCopyProtectorUnprotect(client_ssl, client_bio,
+                                          &protected_slices,
+                                          &unprotected_output_slices,
+                                          /*min_progress_size=*/nullptr),
+            tsi_result::TSI_OK);
+  EXPECT_THAT(BytesFromSlices(&unprotected_output_slices),
+              ContainerEq(unprotected_bytes));
+
+  grpc_slice_buffer_destroy(&unprotected_slices);
+  grpc_slice_buffer_destroy(&protected_slices);
+  grpc_slice_buffer_destroy(&unprotected_output_slices);
+}
+
 INSTANTIATE_TEST_SUITE_P(FrameProtectorUtil, FlowTest,
                          ValuesIn(GenerateTestData()));
 
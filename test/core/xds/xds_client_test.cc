@@ -28,6 +28,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -72,6 +73,8 @@
 // IWYU pragma: no_include "google/protobuf/json/json.h"
 // IWYU pragma: no_include "google/protobuf/util/json_util.h"
 
+using envoy::service::discovery::v3::DeltaDiscoveryRequest;
+using envoy::service::discovery::v3::DeltaDiscoveryResponse;
 using envoy::service::discovery::v3::DiscoveryRequest;
 using envoy::service::discovery::v3::DiscoveryResponse;
 
@@ -131,25 +134,30 @@ class XdsClientTest : public ::testing::Test {
      public:
       explicit FakeXdsServer(
           absl::string_view server_uri = kDefaultXdsServerUrl,
-          bool ignore_resource_deletion = false)
+          bool ignore_resource_deletion = false, bool use_delta_ads = false)
           : server_uri_(server_uri),
-            ignore_resource_deletion_(ignore_resource_deletion) {}
+            ignore_resource_deletion_(ignore_resource_deletion),
+            use_delta_ads_(use_delta_ads) {}
       const std::string& server_uri() const override { return server_uri_; }
       bool IgnoreResourceDeletion() const override {
         return ignore_resource_deletion_;
       }
+      bool UseDeltaAds() const override { return use_delta_ads_; }
       bool Equals(const XdsServer& other) const override {
         const auto& o = static_cast<const FakeXdsServer&>(other);
         return server_uri_ == o.server_uri_ &&
-               ignore_resource_deletion_ == o.ignore_resource_deletion_;
+               ignore_resource_deletion_ == o.ignore_resource_deletion_ &&
+               use_delta_ads_ == o.use_delta_ads_;
       }
       std::string Key() const override {
-        return absl::StrCat(server_uri_, "#", ignore_resource_deletion_);
+        return absl::StrCat(server_uri_, "#", ignore_resource_deletion_, "#",
+                            use_delta_ads_);
       }
 
      private:
       std::string server_uri_;
       bool ignore_resource_deletion_ = false;
+      bool use_delta_ads_ = false;
     };
 
     class FakeAuthority : public Authority {
@@ -620,6 +628,54 @@ class XdsClientTest : public ::testing::Test {
     DiscoveryResponse response_;
   };
 
+  // Helper class for constructing delta ADS responses.
+  class DeltaResponseBuilder {
+   public:
+    explicit DeltaResponseBuilder(absl::string_view type_url) {
+      response_.set_type_url(absl::StrCat("type.googleapis.com/", type_url));
+    }
+
+    DeltaResponseBuilder& set_system_version_info(
+        absl::string_view system_version_info) {
+      response_.set_system_version_info(std::string(system_version_info));
+      return *this;
+    }
+    DeltaResponseBuilder& set_nonce(absl::string_view nonce) {
+      response_.set_nonce(std::string(nonce));
+      return *this;
+    }
+
+    template <typename ResourceType>
+    DeltaResponseBuilder& AddResource(
+        const typename ResourceType::ResourceType& resource,
+        absl::string_view version) {
+      auto* res = response_.add_resources();
+      res->set_name(resource.name);
+      res->set_version(std::string(version));
+      *res->mutable_resource() = ResourceType::EncodeAsAny(resource);
+      return *this;
+    }
+
+    DeltaResponseBuilder& AddFooResource(const XdsFooResource& resource,
+                                         absl::string_view version) {
+      return AddResource<XdsFooResourceType>(resource, version);
+    }
+
+    DeltaResponseBuilder& AddRemovedResource(absl::string_view name) {
+      response_.add_removed_resources(std::string(name));
+      return *this;
+    }
+
+    std::string Serialize() {
+      std::string serialized_response;
+      EXPECT_TRUE(response_.SerializeToString(&serialized_response));
+      return serialized_response;
+    }
+
+   private:
+    DeltaDiscoveryResponse response_;
+  };
+
   class MetricsReporter : public XdsMetricsReporter {
    public:
     using ResourceUpdateMap = std::map<
@@ -760,6 +816,14 @@ class XdsClientTest : public ::testing::Test {
         timeout * grpc_test_slowdown_factor());
   }
 
+  RefCountedPtr<FakeXdsTransportFactory::FakeStreamingCall>
+  WaitForDeltaAdsStream(absl::Duration timeout = absl::Seconds(5)) {
+    return transport_factory_->WaitForStream(
+        *xds_client_->bootstrap().servers().front(),
+        FakeXdsTransportFactory::kDeltaAdsMethod,
+        timeout * grpc_test_slowdown_factor());
+  }
+
   void TriggerConnectionFailure(const XdsBootstrap::XdsServer& xds_server,
                                 absl::Status status) {
     transport_factory_->TriggerConnectionFailure(xds_server, std::move(status));
@@ -816,6 +880,53 @@ class XdsClientTest : public ::testing::Test {
         << location.file() << ":" << location.line();
   }
 
+  // Gets the latest delta request sent to the fake xDS server.
+  absl::optional<DeltaDiscoveryRequest> WaitForDeltaRequest(
+      FakeXdsTransportFactory::FakeStreamingCall* stream,
+      absl::Duration timeout = absl::Seconds(3),
+      SourceLocation location = SourceLocation()) {
+    auto message =
+        stream->WaitForMessageFromClient(timeout * grpc_test_slowdown_factor());
+    if (!message.has_value()) return absl::nullopt;
+    DeltaDiscoveryRequest request;
+    bool success = request.ParseFromString(*message);
+    EXPECT_TRUE(success) << "Failed to deserialize DeltaDiscoveryRequest at "
+                         << location.file() << ":" << location.line();
+    if (!success) return absl::nullopt;
+    return std::move(request);
+  }
+
+  // Helper function to check the fields of a DeltaDiscoveryRequest.
+  void CheckDeltaRequest(
+      const DeltaDiscoveryRequest& request, absl::string_view type_url,
+      absl::string_view response_nonce, const absl::Status& error_detail,
+      const std::set<absl::string_view>& resource_names_subscribe,
+      const std::set<absl::string_view>& resource_names_unsubscribe,
+      SourceLocation location = SourceLocation()) {
+    EXPECT_EQ(request.type_url(),
+              absl::StrCat("type.googleapis.com/", type_url))
+        << location.file() << ":" << location.line();
+    EXPECT_EQ(request.response_nonce(), response_nonce)
+        << location.file() << ":" << location.line();
+    if (error_detail.ok()) {
+      EXPECT_FALSE(request.has_error_detail())
+          << location.file() << ":" << location.line();
+    } else {
+      EXPECT_EQ(request.error_detail().code(),
+                static_cast<int>(error_detail.code()))
+          << location.file() << ":" << location.line();
+      EXPECT_EQ(request.error_detail().message(), error_detail.message())
+          << location.file() << ":" << location.line();
+    }
+    EXPECT_THAT(request.resource_names_subscribe(),
+                ::testing::UnorderedElementsAreArray(resource_names_subscribe))
+        << location.file() << ":" << location.line();
+    EXPECT_THAT(
+        request.resource_names_unsubscribe(),
+        ::testing::UnorderedElementsAreArray(resource_names_unsubscribe))
+        << location.file() << ":" << location.line();
+  }
+
   // Helper function to check the contents of the node message in a
   // request against the client's node info.
   void CheckRequestNode(const DiscoveryRequest& request,
@@ -1753,6 +1864,75 @@ TEST_F(XdsClientTest, ResourceValidationFailureMultipleResources) {
   EXPECT_TRUE(stream->Orphaned());
 }
 
+TEST_F(XdsClientTest, LargeResponseDecodedInParallel) {
+  // Enough resources for the response to be decoded by several threads.
+  constexpr uint32_t kNumResources = 64;
+  InitXdsClient();
+  std::vector<std::string> resource_names;
+  std::vector<RefCountedPtr<XdsFooResourceType::Watcher>> watchers;
+  RefCountedPtr<FakeXdsTransportFactory::FakeStreamingCall> stream;
+  for (uint32_t i = 0; i < kNumResources; ++i) {
+    resource_names.push_back(absl::StrCat("foo", i));
+    watchers.push_back(StartFooWatch(resource_names.back()));
+    if (stream == nullptr) {
+      stream = WaitForAdsStream();
+      ASSERT_TRUE(stream != nullptr);
+    }
+    // XdsClient should have sent a subscription request on the ADS stream.
+    auto request = WaitForRequest(stream.get());
+    ASSERT_TRUE(request.has_value());
+    EXPECT_EQ(request->resource_names_size(), static_cast<int>(i + 1));
+  }
+  // Server sends a response with all the resources, one of which is
+  // invalid.
+  constexpr uint32_t kInvalidResource = 37;
+  ResponseBuilder response(XdsFooResourceType::Get()->type_url());
+  response.set_version_info("1").set_nonce("A");
+  for (uint32_t i = 0; i < kNumResources; ++i) {
+    if (i == kInvalidResource) {
+      response.AddInvalidResource(
+          XdsFooResourceType::Get()->type_url(),
+          absl::StrCat("{\"name\":\"", resource_names[i], "\",\"value\":[]}"));
+    } else {
+      response.AddFooResource(XdsFooResource(resource_names[i], i));
+    }
+  }
+  stream->SendMessageToClient(response.Serialize());
+  // XdsClient should have delivered the resources to the watchers.
+  for (uint32_t i = 0; i < kNumResources; ++i) {
+    if (i == kInvalidResource) {
+      auto error = watchers[i]->WaitForNextError();
+      ASSERT_TRUE(error.has_value());
+      EXPECT_EQ(error->code(), absl::StatusCode::kUnavailable);
+      continue;
+    }
+    auto resource = watchers[i]->WaitForNextResource();
+    ASSERT_NE(resource, nullptr) << i;
+    EXPECT_EQ(resource->name, resource_names[i]);
+    EXPECT_EQ(resource->value, i);
+  }
+  // XdsClient should NACK the update, with the error of the invalid
+  // resource.
+  auto request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"1", /*response_nonce=*/"A",
+               // error_detail=
+               absl::InvalidArgumentError(absl::StrCat(
+                   "xDS response validation errors: [resource index ",
+                   kInvalidResource, ": ", resource_names[kInvalidResource],
+                   ": INVALID_ARGUMENT: errors validating JSON: "
+                   "[field:value error:is not a number]]")),
+               /*resource_names=*/
+               std::set<absl::string_view>(resource_names.begin(),
+                                           resource_names.end()));
+  // Cancel watches.
+  for (uint32_t i = 0; i < kNumResources; ++i) {
+    CancelFooWatch(watchers[i].get(), resource_names[i]);
+  }
+  EXPECT_TRUE(stream->Orphaned());
+}
+
 TEST_F(XdsClientTest, ResourceValidationFailureForCachedResource) {
   InitXdsClient();
   // Start a watch for "foo1".
@@ -2307,6 +2487,147 @@ TEST_F(XdsClientTest, StreamClosedByServer) {
   EXPECT_TRUE(stream->Orphaned());
 }
 
+TEST_F(XdsClientTest, DeltaAdsWatch) {
+  InitXdsClient(FakeXdsBootstrap::Builder().SetServers(
+      {FakeXdsBootstrap::FakeXdsServer(kDefaultXdsServerUrl,
+                                       /*ignore_resource_deletion=*/false,
+                                       /*use_delta_ads=*/true)}));
+  // Start a watch for "foo1".
+  auto watcher = StartFooWatch("foo1");
+  // XdsClient should have created a delta ADS stream.
+  auto stream = WaitForDeltaAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  // XdsClient should have subscribed to foo1.
+  auto request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"", /*error_detail=*/absl::OkStatus(),
+                    /*resource_names_subscribe=*/{"foo1"},
+                    /*resource_names_unsubscribe=*/{});
+  EXPECT_TRUE(request->has_node());  // Should be present on the first request.
+  EXPECT_THAT(request->initial_resource_versions(), ::testing::IsEmpty());
+  // Server sends a response.
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_nonce("A")
+          .AddFooResource(XdsFooResource("foo1", 6), "1")
+          .Serialize());
+  auto resource = watcher->WaitForNextResource();
+  ASSERT_NE(resource, nullptr);
+  EXPECT_EQ(resource->name, "foo1");
+  EXPECT_EQ(resource->value, 6);
+  // XdsClient should have ACKed the response, without resending the
+  // subscriptions.
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"A", /*error_detail=*/absl::OkStatus(),
+                    /*resource_names_subscribe=*/{},
+                    /*resource_names_unsubscribe=*/{});
+  EXPECT_FALSE(request->has_node());
+  // Start a watch for "foo2".  Only foo2 is subscribed to.
+  auto watcher2 = StartFooWatch("foo2");
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"", /*error_detail=*/absl::OkStatus(),
+                    /*resource_names_subscribe=*/{"foo2"},
+                    /*resource_names_unsubscribe=*/{});
+  // Server sends only foo2, which does not affect foo1.
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_nonce("B")
+          .AddFooResource(XdsFooResource("foo2", 7), "1")
+          .Serialize());
+  resource = watcher2->WaitForNextResource();
+  ASSERT_NE(resource, nullptr);
+  EXPECT_EQ(resource->name, "foo2");
+  EXPECT_EQ(resource->value, 7);
+  EXPECT_FALSE(watcher->HasEvent());
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"B", /*error_detail=*/absl::OkStatus(),
+                    /*resource_names_subscribe=*/{},
+                    /*resource_names_unsubscribe=*/{});
+  // Server removes foo1.
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_nonce("C")
+          .AddRemovedResource("foo1")
+          .Serialize());
+  EXPECT_TRUE(watcher->WaitForDoesNotExist(absl::Seconds(1)));
+  EXPECT_FALSE(watcher2->HasEvent());
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"C", /*error_detail=*/absl::OkStatus(),
+                    /*resource_names_subscribe=*/{},
+                    /*resource_names_unsubscribe=*/{});
+  // Cancel the watch for foo2.  Only foo2 is unsubscribed from.
+  CancelFooWatch(watcher2.get(), "foo2");
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"", /*error_detail=*/absl::OkStatus(),
+                    /*resource_names_subscribe=*/{},
+                    /*resource_names_unsubscribe=*/{"foo2"});
+  // Cancel the watch for foo1.
+  CancelFooWatch(watcher.get(), "foo1");
+  EXPECT_TRUE(stream->Orphaned());
+}
+
+TEST_F(XdsClientTest, DeltaAdsStreamRestartSendsInitialResourceVersions) {
+  InitXdsClient(FakeXdsBootstrap::Builder().SetServers(
+      {FakeXdsBootstrap::FakeXdsServer(kDefaultXdsServerUrl,
+                                       /*ignore_resource_deletion=*/false,
+                                       /*use_delta_ads=*/true)}));
+  // Start a watch for "foo1".
+  auto watcher = StartFooWatch("foo1");
+  auto stream = WaitForDeltaAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  auto request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"", /*error_detail=*/absl::OkStatus(),
+                    /*resource_names_subscribe=*/{"foo1"},
+                    /*resource_names_unsubscribe=*/{});
+  // Server sends a response.
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_nonce("A")
+          .AddFooResource(XdsFooResource("foo1", 6), "3")
+          .Serialize());
+  auto resource = watcher->WaitForNextResource();
+  ASSERT_NE(resource, nullptr);
+  EXPECT_EQ(resource->value, 6);
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"A", /*error_detail=*/absl::OkStatus(),
+                    /*resource_names_subscribe=*/{},
+                    /*resource_names_unsubscribe=*/{});
+  // Now server closes the stream.
+  stream->MaybeSendStatusToClient(absl::OkStatus());
+  EXPECT_TRUE(stream->Orphaned());
+  // XdsClient should create a new stream, on which it subscribes again,
+  // telling the server which version of foo1 it already has.
+  stream = WaitForDeltaAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"", /*error_detail=*/absl::OkStatus(),
+                    /*resource_names_subscribe=*/{"foo1"},
+                    /*resource_names_unsubscribe=*/{});
+  EXPECT_TRUE(request->has_node());
+  EXPECT_THAT(request->initial_resource_versions(),
+              ::testing::UnorderedElementsAre(::testing::Pair("foo1", "3")));
+  // Cancel watch.
+  CancelFooWatch(watcher.get(), "foo1");
+  EXPECT_TRUE(stream->Orphaned());
+}
+
 TEST_F(XdsClientTest, StreamClosedByServerWithoutSeeingResponse) {
   InitXdsClient();
   // Metrics should initially be empty.
@@ -26,6 +26,7 @@
 
 #include "absl/log/check.h"
 #include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 #include "absl/strings/strip.h"
 #include "absl/types/variant.h"
@@ -34,6 +35,7 @@
 #include "upb/reflection/def.hpp"
 
 #include <grpc/grpc.h>
+#include <grpc/slice.h>
 #include <grpc/status.h>
 #include <grpc/support/json.h>
 #include <grpc/support/log.h>
@@ -49,6 +51,10 @@
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/json/json_writer.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/service_config/service_config_call_data.h"
+#include "src/core/service_config/service_config_impl.h"
 #include "src/core/xds/grpc/xds_bootstrap_grpc.h"
 #include "src/core/xds/xds_client/xds_client.h"
 #include "src/proto/grpc/testing/xds/v3/address.pb.h"
@@ -143,6 +149,30 @@ class XdsHttpFilterTest : public ::testing::Test {
         absl::StripPrefix(type, "type.googleapis.com/"));
   }
 
+  // Returns whether filter is active for a call whose method config has
+  // element in its field_name field.
+  static bool IsActiveForCall(const XdsHttpFilterImpl* filter,
+                              absl::string_view field_name,
+                              absl::string_view element) {
+    auto service_config = ServiceConfigImpl::Create(
+        filter->ModifyChannelArgs(ChannelArgs()),
+        absl::StrCat("{\"methodConfig\": [{\"name\": [{}], \"", field_name,
+                     "\": [", element, "]}]}"));
+    CHECK(service_config.ok()) << service_config.status();
+    MemoryAllocator memory_allocator = MemoryAllocator(
+        ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator(
+            "test"));
+    auto arena = MakeScopedArena(1024, &memory_allocator);
+    grpc_call_context_element call_context[GRPC_CONTEXT_COUNT] = {};
+    ServiceConfigCallData call_config(arena.get(), call_context);
+    call_config.SetServiceConfig(
+        *service_config,
+        (*service_config)
+            ->GetMethodParsedConfigVector(
+                grpc_slice_from_static_string("/service/method")));
+    return filter->IsActiveForCall(call_config);
+  }
+
   GrpcXdsBootstrap::GrpcXdsServer xds_server_;
   RefCountedPtr<XdsClient> xds_client_;
   upb::DefPool upb_def_pool_;
@@ -321,6 +351,16 @@ TEST_F(XdsFaultInjectionFilterTest, GenerateServiceConfigOverrideConfig) {
   EXPECT_EQ(service_config->element, "{\"baz\":\"quux\"}");
 }
 
+TEST_F(XdsFaultInjectionFilterTest, IsActiveForCall) {
+  EXPECT_FALSE(IsActiveForCall(filter_, "faultInjectionPolicy", "{}"));
+  EXPECT_TRUE(IsActiveForCall(filter_, "faultInjectionPolicy",
+                              "{\"abortCode\": \"UNAVAILABLE\"}"));
+  EXPECT_TRUE(IsActiveForCall(filter_, "faultInjectionPolicy",
+                              "{\"delay\": \"1s\"}"));
+  EXPECT_TRUE(IsActiveForCall(filter_, "faultInjectionPolicy",
+                              "{\"abortCodeHeader\": \"x-abort\"}"));
+}
+
 // For the fault injection filter, GenerateFilterConfig() and
 // GenerateFilterConfigOverride() accept the same input, so we want to
 // run all tests for both.
@@ -1172,6 +1212,12 @@ TEST_F(XdsStatefulSessionFilterTest, GenerateServiceConfigWithOverride) {
             JsonDump(Json::FromObject({{"name", Json::FromString("bar")}})));
 }
 
+TEST_F(XdsStatefulSessionFilterTest, IsActiveForCall) {
+  EXPECT_FALSE(IsActiveForCall(filter_, "stateful_session", "{}"));
+  EXPECT_TRUE(
+      IsActiveForCall(filter_, "stateful_session", "{\"name\": \"foo\"}"));
+}
+
 TEST_F(XdsStatefulSessionFilterTest, GenerateFilterConfigTypedStruct) {
   XdsExtension extension = MakeXdsExtension(StatefulSession());
   extension.value = Json();
@@ -0,0 +1,198 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/xds/grpc/xds_routing.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+#include "gtest/gtest.h"
+#include "re2/re2.h"
+
+#include "src/core/lib/matchers/matchers.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/transport/metadata_batch.h"
+#include "src/core/xds/grpc/xds_route_config.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+using Matchers = XdsRouteConfigResource::Route::Matchers;
+
+class RouteList final : public XdsRouting::RouteListIterator {
+ public:
+  size_t Size() const override { return matchers_.size(); }
+
+  const Matchers& GetMatchersForRoute(size_t index) const override {
+    return matchers_[index];
+  }
+
+  RouteList& Add(StringMatcher::Type type, absl::string_view path,
+                 bool case_sensitive = true) {
+    matchers_.emplace_back();
+    matchers_.back().path_matcher =
+        StringMatcher::Create(type, path, case_sensitive).value();
+    return *this;
+  }
+
+  // Adds a header matcher to the last route.
+  RouteList& WithHeader(absl::string_view name, absl::string_view value) {
+    matchers_.back().header_matchers.push_back(
+        HeaderMatcher::Create(name, HeaderMatcher::Type::kExact, value)
+            .value());
+    return *this;
+  }
+
+ private:
+  std::vector<Matchers> matchers_;
+};
+
+class XdsRoutingRouteIndexTest : public ::testing::Test {
+ protected:
+  void AddHeader(const char* key, const char* value) {
+    metadata_.Append(key, Slice::FromStaticString(value),
+                     [](absl::string_view, const Slice&) { abort(); });
+  }
+
+  // Checks that the index returns the same route as the linear search.
+  absl::optional<size_t> GetRoute(
+      const RouteList& routes, absl::string_view path,
+      int64_t regex_set_max_mem = RE2::Options().max_mem()) {
+    XdsRouting::RouteIndex index(routes, regex_set_max_mem);
+    absl::optional<size_t> route =
+        index.GetRouteForRequest(routes, path, &metadata_);
+    EXPECT_EQ(route, XdsRouting::GetRouteForRequest(routes, path, &metadata_))
+        << path;
+    return route;
+  }
+
+  grpc_metadata_batch metadata_;
+};
+
+TEST_F(XdsRoutingRouteIndexTest, FirstMatchingRouteWins) {
+  RouteList routes;
+  routes.Add(StringMatcher::Type::kPrefix, "/foo.Service/")
+      .Add(StringMatcher::Type::kExact, "/foo.Service/Bar")
+      .Add(StringMatcher::Type::kExact, "/bar.Service/Baz")
+      .Add(StringMatcher::Type::kSafeRegex, "/ba[rz]\\.Service/.*")
+      .Add(StringMatcher::Type::kPrefix, "/BAR.service/", false)
+      .Add(StringMatcher::Type::kExact, "/qux.service/quux", false)
+      .Add(StringMatcher::Type::kPrefix, "");
+  EXPECT_EQ(GetRoute(routes, "/foo.Service/Bar"), 0);
+  EXPECT_EQ(GetRoute(routes, "/bar.Service/Baz"), 2);
+  EXPECT_EQ(GetRoute(routes, "/bar.Service/Qux"), 3);
+  EXPECT_EQ(GetRoute(routes, "/baz.Service/Qux"), 3);
+  EXPECT_EQ(GetRoute(routes, "/Bar.Service/Qux"), 4);
+  EXPECT_EQ(GetRoute(routes, "/Qux.Service/Quux"), 5);
+  EXPECT_EQ(GetRoute(routes, "/Qux.Service/Quuz"), 6);
+  EXPECT_EQ(GetRoute(routes, ""), 6);
+}
+
+TEST_F(XdsRoutingRouteIndexTest, NoMatchingRoute) {
+  RouteList routes;
+  routes.Add(StringMatcher::Type::kExact, "/foo.Service/Bar")
+      .Add(StringMatcher::Type::kSafeRegex, "/foo\\.Service/B.*");
+  EXPECT_EQ(GetRoute(routes, "/foo.Service/Baz/Extra"), 1);
+  EXPECT_EQ(GetRoute(routes, "/foo.Service/Qux"), absl::nullopt);
+  // The regex must match the whole path.
+  EXPECT_EQ(GetRoute(routes, "/x/foo.Service/Bar"), absl::nullopt);
+}
+
+TEST_F(XdsRoutingRouteIndexTest, HeaderMatchers) {
+  RouteList routes;
+  routes.Add(StringMatcher::Type::kPrefix, "/foo.Service/")
+      .WithHeader("x-route", "a")
+      .Add(StringMatcher::Type::kPrefix, "/bar.Service/")
+      .Add(StringMatcher::Type::kPrefix, "/")
+      .WithHeader("x-route", "b")
+      .Add(StringMatcher::Type::kPrefix, "/");
+  EXPECT_EQ(GetRoute(routes, "/bar.Service/Baz"), 1);
+  EXPECT_EQ(GetRoute(routes, "/foo.Service/Baz"), 3);
+  AddHeader("x-route", "a");
+  EXPECT_EQ(GetRoute(routes, "/foo.Service/Baz"), 0);
+  EXPECT_EQ(GetRoute(routes, "/bar.Service/Baz"), 1);
+  EXPECT_EQ(GetRoute(routes, "/baz.Service/Baz"), 3);
+}
+
+TEST_F(XdsRoutingRouteIndexTest, ManyRoutes) {
+  RouteList routes;
+  for (int i = 0; i < 500; ++i) {
+    routes.Add(StringMatcher::Type::kExact,
+               absl::StrCat("/service", i, ".Service/Method"));
+    routes.Add(StringMatcher::Type::kSafeRegex,
+               absl::StrCat("/service", i, "\\.Service/Method[0-9]+"));
+    routes.Add(StringMatcher::Type::kPrefix,
+               absl::StrCat("/service", i, ".Service/"));
+  }
+  EXPECT_EQ(GetRoute(routes, "/service0.Service/Method"), 0);
+  EXPECT_EQ(GetRoute(routes, "/service499.Service/Method"), 1497);
+  EXPECT_EQ(GetRoute(routes, "/service250.Service/Method42"), 751);
+  EXPECT_EQ(GetRoute(routes, "/service250.Service/Other"), 752);
+  EXPECT_EQ(GetRoute(routes, "/service500.Service/Method"), absl::nullopt);
+}
+
+TEST(XdsRoutingRouteIndexPathTest, RouteDependsOnPathOnly) {
+  RouteList routes;
+  routes.Add(StringMatcher::Type::kExact, "/foo.Service/Bar")
+      .WithHeader("x-route", "a")
+      .Add(StringMatcher::Type::kExact, "/foo.Service/Bar")
+      .Add(StringMatcher::Type::kPrefix, "/bar.Service/")
+      .WithHeader("x-route", "b")
+      .Add(StringMatcher::Type::kExact, "/bar.Service/Baz")
+      .Add(StringMatcher::Type::kExact, "/baz.Service/Qux")
+      .Add(StringMatcher::Type::kSafeRegex, "/baz\\.Service/.*");
+  XdsRouting::RouteIndex index(routes);
+  // An earlier route with a header matcher matches the path too.
+  EXPECT_EQ(index.GetRouteForPath(routes, "/foo.Service/Bar"), absl::nullopt);
+  EXPECT_EQ(index.GetRouteForPath(routes, "/bar.Service/Baz"), absl::nullopt);
+  EXPECT_EQ(index.GetRouteForPath(routes, "/baz.Service/Qux"), 4);
+  EXPECT_EQ(index.GetRouteForPath(routes, "/baz.Service/Quux"), 5);
+  EXPECT_EQ(index.GetRouteForPath(routes, "/qux.Service/Quux"), absl::nullopt);
+}
+
+TEST_F(XdsRoutingRouteIndexTest, RegexSetOutOfMemory) {
+  // Too little memory to compile the regex set, so the regexes are matched
+  // one by one.
+  constexpr int64_t kRegexSetMaxMem = 1000;
+  RouteList routes;
+  routes.Add(StringMatcher::Type::kExact, "/foo.Service/Bar")
+      .Add(StringMatcher::Type::kSafeRegex, "/foo\\.Service/B.*")
+      .Add(StringMatcher::Type::kSafeRegex, "/(foo|bar)\\.Service/[A-Z]+")
+      .Add(StringMatcher::Type::kPrefix, "/bar.Service/");
+  EXPECT_EQ(GetRoute(routes, "/foo.Service/Bar", kRegexSetMaxMem), 0);
+  EXPECT_EQ(GetRoute(routes, "/foo.Service/Baz", kRegexSetMaxMem), 1);
+  EXPECT_EQ(GetRoute(routes, "/foo.Service/QUX", kRegexSetMaxMem), 2);
+  EXPECT_EQ(GetRoute(routes, "/bar.Service/QUX", kRegexSetMaxMem), 2);
+  EXPECT_EQ(GetRoute(routes, "/bar.Service/Qux", kRegexSetMaxMem), 3);
+  EXPECT_EQ(GetRoute(routes, "/foo.Service/Qux", kRegexSetMaxMem),
+            absl::nullopt);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
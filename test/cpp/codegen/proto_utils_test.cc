@@ -16,6 +16,11 @@
 //
 //
 
+#include <string>
+#include <vector>
+
+#include <google/protobuf/struct.pb.h>
+#include <google/protobuf/util/message_differencer.h>
 #include <gtest/gtest.h>
 
 #include <grpc/byte_buffer.h>
@@ -88,6 +93,48 @@ TEST_F(ProtoUtilsTest, TinyBackupThenNext) {
 
 namespace {
 
+// A message of about \a num_entries KB, with nested messages.
+google::protobuf::Struct MakeNestedMessage(int num_entries) {
+  google::protobuf::Struct message;
+  auto* list = (*message.mutable_fields())["entries"].mutable_list_value();
+  for (int i = 0; i < num_entries; i++) {
+    auto* fields = list->add_values()->mutable_struct_value()->mutable_fields();
+    (*fields)["index"].set_number_value(i);
+    (*fields)["data"].set_string_value(std::string(1000, 'a' + i % 26));
+  }
+  return message;
+}
+
+void SerializeAndDeserialize(const google::protobuf::Struct& message,
+                             size_t expected_slices) {
+  ByteBuffer bb;
+  bool own_buffer;
+  ASSERT_TRUE((GenericSerialize<ProtoBufferWriter, google::protobuf::Struct>(
+                   message, &bb, &own_buffer)
+                   .ok()));
+  EXPECT_EQ(bb.Length(), message.ByteSizeLong());
+  std::vector<Slice> slices;
+  ASSERT_TRUE(bb.Dump(&slices).ok());
+  EXPECT_EQ(slices.size(), expected_slices);
+  google::protobuf::Struct parsed;
+  ASSERT_TRUE((GenericDeserialize<ProtoBufferReader, google::protobuf::Struct>(
+                   &bb, &parsed)
+                   .ok()));
+  EXPECT_TRUE(
+      google::protobuf::util::MessageDifferencer::Equals(parsed, message));
+}
+
+TEST_F(ProtoUtilsTest, SerializeIntoSingleSlice) {
+  SerializeAndDeserialize(MakeNestedMessage(100), 1);
+}
+
+TEST_F(ProtoUtilsTest, SerializeIntoMaxLengthSlices) {
+  google::protobuf::Struct message = MakeNestedMessage(3000);
+  SerializeAndDeserialize(
+      message, (message.ByteSizeLong() + kProtoBufferWriterMaxBufferLength - 1) /
+                   kProtoBufferWriterMaxBufferLength);
+}
+
 // Set backup_size to 0 to indicate no backup is needed.
 void BufferWriterTest(int block_size, int total_size, int backup_size) {
   ByteBuffer bb;
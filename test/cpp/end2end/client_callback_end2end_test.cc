@@ -17,6 +17,7 @@
 //
 
 #include <algorithm>
+#include <chrono>
 #include <condition_variable>
 #include <functional>
 #include <mutex>
@@ -55,19 +56,26 @@ namespace {
 
 enum class Protocol { INPROC, TCP };
 
+// Whether the methods of the callback server are declared non-blocking, and
+// whether their reactions stay within the latency budget.
+enum class InlineReactions { NONE, WITHIN_BUDGET, OVER_BUDGET };
+
 class TestScenario {
  public:
   TestScenario(bool serve_callback, Protocol protocol, bool intercept,
-               const std::string& creds_type)
+               const std::string& creds_type,
+               InlineReactions inline_reactions = InlineReactions::NONE)
       : callback_server(serve_callback),
         protocol(protocol),
         use_interceptors(intercept),
-        credentials_type(creds_type) {}
+        credentials_type(creds_type),
+        inline_reactions(inline_reactions) {}
   void Log() const;
   bool callback_server;
   Protocol protocol;
   bool use_interceptors;
   const std::string credentials_type;
+  InlineReactions inline_reactions;
 };
 
 std::ostream& operator<<(std::ostream& out, const TestScenario& scenario) {
@@ -75,7 +83,12 @@ std::ostream& operator<<(std::ostream& out, const TestScenario& scenario) {
              << (scenario.callback_server ? "true" : "false") << ",protocol="
              << (scenario.protocol == Protocol::INPROC ? "INPROC" : "TCP")
              << ",intercept=" << (scenario.use_interceptors ? "true" : "false")
-             << ",creds=" << scenario.credentials_type << "}";
+             << ",creds=" << scenario.credentials_type << ",inline_reactions="
+             << (scenario.inline_reactions == InlineReactions::NONE ? "none"
+                 : scenario.inline_reactions == InlineReactions::WITHIN_BUDGET
+                     ? "within_budget"
+                     : "over_budget")
+             << "}";
 }
 
 void TestScenario::Log() const {
@@ -105,6 +118,21 @@ class ClientCallbackEnd2endTest
       builder.RegisterService(&service_);
     } else {
       builder.RegisterService(&callback_service_);
+      if (GetParam().inline_reactions != InlineReactions::NONE) {
+        // With a budget of 1ns, the first reaction of each method goes over
+        // it, and the later ones are dispatched to the executor.
+        const std::chrono::nanoseconds budget =
+            GetParam().inline_reactions == InlineReactions::WITHIN_BUDGET
+                ? std::chrono::nanoseconds(std::chrono::seconds(1))
+                : std::chrono::nanoseconds(1);
+        for (const char* method :
+             {"/grpc.testing.EchoTestService/Echo",
+              "/grpc.testing.EchoTestService/RequestStream",
+              "/grpc.testing.EchoTestService/ResponseStream",
+              "/grpc.testing.EchoTestService/BidiStream"}) {
+          builder.experimental().SetNonBlockingMethod(method, budget);
+        }
+      }
     }
 
     if (GetParam().use_interceptors) {
@@ -1556,6 +1584,11 @@ std::vector<TestScenario> CreateTestScenarios(bool test_insecure) {
           scenarios.emplace_back(callback_server, p, use_interceptors, cred);
         }
       }
+      for (InlineReactions inline_reactions :
+           {InlineReactions::WITHIN_BUDGET, InlineReactions::OVER_BUDGET}) {
+        scenarios.emplace_back(/*serve_callback=*/true, p, /*intercept=*/false,
+                               cred, inline_reactions);
+      }
     }
   }
   return scenarios;
@@ -29,6 +29,7 @@
 #include <gtest/gtest.h>
 
 #include "absl/log/check.h"
+#include "absl/synchronization/notification.h"
 
 #include <grpc/support/log.h>
 #include <grpcpp/channel.h>
@@ -39,6 +40,7 @@
 #include <grpcpp/server_context.h>
 #include <grpcpp/support/client_callback.h>
 #include <grpcpp/support/message_allocator.h>
+#include <grpcpp/support/proto_arena_message_allocator.h>
 
 #include "src/core/lib/iomgr/iomgr.h"
 #include "src/proto/grpc/testing/echo.grpc.pb.h"
@@ -73,7 +75,63 @@ class CallbackTestServiceImpl : public EchoTestService::CallbackService {
     return reactor;
   }
 
+  // Echoes the concatenation of the messages of the requests.
+  ServerReadReactor<EchoRequest>* RequestStream(
+      CallbackServerContext* /*context*/, EchoResponse* response) override {
+    class Reactor : public ServerReadReactor<EchoRequest> {
+     public:
+      Reactor(CallbackTestServiceImpl* service, EchoResponse* response)
+          : response_(response) {
+        service->CountMessage(*response);
+        StartRead(&request_);
+      }
+      void OnReadDone(bool ok) override {
+        if (!ok) {
+          Finish(Status::OK);
+          return;
+        }
+        response_->mutable_message()->append(request_.message());
+        StartRead(&request_);
+      }
+      void OnDone() override { delete this; }
+
+     private:
+      EchoResponse* const response_;
+      EchoRequest request_;
+    };
+    return new Reactor(this, response);
+  }
+
+  // Echoes the message of the request.
+  ServerWriteReactor<EchoResponse>* ResponseStream(
+      CallbackServerContext* /*context*/, const EchoRequest* request) override {
+    class Reactor : public ServerWriteReactor<EchoResponse> {
+     public:
+      Reactor(CallbackTestServiceImpl* service, const EchoRequest* request) {
+        service->CountMessage(*request);
+        response_.set_message(request->message());
+        StartWriteAndFinish(&response_, WriteOptions(), Status::OK);
+      }
+      void OnDone() override { delete this; }
+
+     private:
+      EchoResponse response_;
+    };
+    return new Reactor(this, request);
+  }
+
+  // The number of messages provided to the streaming methods that were
+  // allocated on an arena.
+  int streaming_messages_on_arena() const {
+    return streaming_messages_on_arena_.load();
+  }
+
  private:
+  void CountMessage(const protobuf::MessageLite& message) {
+    if (message.GetArena() != nullptr) ++streaming_messages_on_arena_;
+  }
+
+  std::atomic<int> streaming_messages_on_arena_{0};
   std::function<void(RpcAllocatorState* allocator_state, const EchoRequest* req,
                      EchoResponse* resp)>
       allocator_mutator_;
@@ -354,6 +412,106 @@ TEST_P(ArenaAllocatorTest, SimpleRpc) {
   EXPECT_EQ(kRpcCount, allocator->allocation_count);
 }
 
+class ProtoArenaAllocatorTest : public MessageAllocatorEnd2endTestBase {
+ protected:
+  // Outlives the server.
+  ProtoArenaMessageAllocator<EchoRequest, EchoResponse> allocator_;
+};
+
+TEST_P(ProtoArenaAllocatorTest, SimpleRpc) {
+  const int kRpcCount = 10;
+  std::atomic<int> messages_on_arena{0};
+  callback_service_.SetAllocatorMutator(
+      [&messages_on_arena](RpcAllocatorState* /*allocator_state*/,
+                           const EchoRequest* req, EchoResponse* resp) {
+        EXPECT_NE(req->GetArena(), nullptr);
+        EXPECT_EQ(req->GetArena(), resp->GetArena());
+        ++messages_on_arena;
+      });
+  CreateServer(&allocator_);
+  ResetStub();
+  // The messages get larger, and the arenas along with them.
+  SendRpcs(kRpcCount);
+  EXPECT_EQ(kRpcCount, messages_on_arena.load());
+}
+
+TEST_P(ProtoArenaAllocatorTest, StreamingRpcs) {
+  callback_service_.SetMessageAllocatorFor_RequestStream(&allocator_);
+  callback_service_.SetMessageAllocatorFor_ResponseStream(&allocator_);
+  CreateServer(nullptr);
+  ResetStub();
+  {
+    ClientContext context;
+    EchoRequest request;
+    EchoResponse response;
+    auto writer = stub_->RequestStream(&context, &response);
+    for (const char* message : {"foo", "bar", "baz"}) {
+      request.set_message(message);
+      EXPECT_TRUE(writer->Write(request));
+    }
+    EXPECT_TRUE(writer->WritesDone());
+    EXPECT_TRUE(writer->Finish().ok());
+    EXPECT_EQ(response.message(), "foobarbaz");
+  }
+  {
+    ClientContext context;
+    EchoRequest request;
+    EchoResponse response;
+    request.set_message("hello");
+    auto reader = stub_->ResponseStream(&context, request);
+    EXPECT_TRUE(reader->Read(&response));
+    EXPECT_EQ(response.message(), "hello");
+    EXPECT_FALSE(reader->Read(&response));
+    EXPECT_TRUE(reader->Finish().ok());
+  }
+  EXPECT_EQ(callback_service_.streaming_messages_on_arena(), 2);
+}
+
+TEST(ProtoArenaMessageAllocatorTest, NewAllocatorAtTheAddressOfADestroyedOne) {
+  using FirstAllocator = ProtoArenaMessageAllocator<EchoRequest, EchoResponse>;
+  using SecondAllocator = ProtoArenaMessageAllocator<EchoResponse, EchoRequest>;
+  static_assert(sizeof(FirstAllocator) == sizeof(SecondAllocator), "");
+  static_assert(alignof(FirstAllocator) == alignof(SecondAllocator), "");
+  alignas(FirstAllocator) unsigned char storage[sizeof(FirstAllocator)];
+  const size_t cached = internal::ProtoArenaPool::CachedEntriesForTesting();
+  auto* first = new (storage) FirstAllocator;
+  first->AllocateMessages()->Release();
+  EXPECT_EQ(internal::ProtoArenaPool::CachedEntriesForTesting(), cached + 1);
+  // Destroying the allocator frees the arenas that it cached.
+  first->~FirstAllocator();
+  EXPECT_EQ(internal::ProtoArenaPool::CachedEntriesForTesting(), cached);
+  // The new allocator lives where the old one did, but gets arenas of its own.
+  auto* second = new (storage) SecondAllocator;
+  auto* holder = second->AllocateMessages();
+  holder->request()->set_message("hello");
+  holder->response()->set_message("world");
+  holder->Release();
+  EXPECT_EQ(internal::ProtoArenaPool::CachedEntriesForTesting(), cached + 1);
+  second->~SecondAllocator();
+  EXPECT_EQ(internal::ProtoArenaPool::CachedEntriesForTesting(), cached);
+}
+
+TEST(ProtoArenaMessageAllocatorTest, DestroyedAllocatorOnAnotherThread) {
+  auto first =
+      std::make_unique<ProtoArenaMessageAllocator<EchoRequest, EchoResponse>>();
+  ProtoArenaMessageAllocator<EchoRequest, EchoResponse> second;
+  absl::Notification first_used;
+  absl::Notification first_destroyed;
+  std::thread thread([&]() {
+    first->AllocateMessages()->Release();
+    EXPECT_EQ(internal::ProtoArenaPool::CachedEntriesForTesting(), 1);
+    first_used.Notify();
+    first_destroyed.WaitForNotification();
+    // Using any allocator drops the arenas of the destroyed one.
+    second.AllocateMessages()->Release();
+    EXPECT_EQ(internal::ProtoArenaPool::CachedEntriesForTesting(), 1);
+  });
+  first_used.WaitForNotification();
+  first.reset();
+  first_destroyed.Notify();
+  thread.join();
+}
+
 std::vector<TestScenario> CreateTestScenarios(bool test_insecure) {
   std::vector<TestScenario> scenarios;
   std::vector<std::string> credentials_types{
@@ -389,6 +547,8 @@ INSTANTIATE_TEST_SUITE_P(SimpleAllocatorTest, SimpleAllocatorTest,
                          ::testing::ValuesIn(CreateTestScenarios(true)));
 INSTANTIATE_TEST_SUITE_P(ArenaAllocatorTest, ArenaAllocatorTest,
                          ::testing::ValuesIn(CreateTestScenarios(true)));
+INSTANTIATE_TEST_SUITE_P(ProtoArenaAllocatorTest, ProtoArenaAllocatorTest,
+                         ::testing::ValuesIn(CreateTestScenarios(true)));
 
 }  // namespace
 }  // namespace testing
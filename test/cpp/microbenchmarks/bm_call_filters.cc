@@ -0,0 +1,155 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmark the dispatch of call filters
+
+#include <benchmark/benchmark.h>
+
+#include "absl/log/check.h"
+
+#include "src/core/lib/promise/activity.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/transport/call_filters.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+// The pipes of CallFilters register wakers with the current activity: this
+// one is current while it is alive.
+class NoOpActivity final : public Activity, public Wakeable {
+ public:
+  void ForceImmediateRepoll(WakeupMask) override {}
+  void Orphan() override {}
+  Waker MakeOwningWaker() override { return Waker(this, 0); }
+  Waker MakeNonOwningWaker() override { return Waker(this, 0); }
+  void Wakeup(WakeupMask) override {}
+  void WakeupAsync(WakeupMask) override {}
+  void Drop(WakeupMask) override {}
+  std::string DebugTag() const override { return "NoOpActivity"; }
+  std::string ActivityDebugTag(WakeupMask) const override {
+    return DebugTag();
+  }
+
+ private:
+  ScopedActivity scoped_activity_{this};
+};
+
+// Intercepts every event of the call with an operation that completes
+// immediately, like most of the filters of the default stacks.
+template <int kIndex>
+struct InstantFilter {
+  struct Call {
+    void OnClientInitialMetadata(ClientMetadata&, InstantFilter* filter) {
+      ++filter->events;
+    }
+    void OnServerInitialMetadata(ServerMetadata&, InstantFilter* filter) {
+      ++filter->events;
+    }
+    void OnClientToServerMessage(Message&, InstantFilter* filter) {
+      ++filter->events;
+    }
+    void OnServerToClientMessage(Message&, InstantFilter* filter) {
+      ++filter->events;
+    }
+    void OnServerTrailingMetadata(ServerMetadata&, InstantFilter* filter) {
+      ++filter->events;
+    }
+    void OnFinalize(const grpc_call_final_info*, InstantFilter* filter) {
+      ++filter->events;
+    }
+    uint64_t call_state = 0;
+  };
+  uint64_t events = 0;
+};
+
+struct Filters {
+  InstantFilter<0> f0;
+  InstantFilter<1> f1;
+  InstantFilter<2> f2;
+  InstantFilter<3> f3;
+  InstantFilter<4> f4;
+  InstantFilter<5> f5;
+};
+
+// Runs one unary call through `stack` per iteration.
+void RunUnaryCalls(benchmark::State& state,
+                   RefCountedPtr<CallFilters::Stack> stack) {
+  auto memory_allocator =
+      MakeMemoryQuota("bm_call_filters")->CreateMemoryAllocator("bm");
+  auto arena = MakeScopedArena(1024, &memory_allocator);
+  promise_detail::Context<Arena> arena_ctx(arena.get());
+  NoOpActivity activity;
+  for (auto _ : state) {
+    CallFilters filters(Arena::MakePooled<ClientMetadata>());
+    filters.SetStack(stack);
+    auto pull_client_initial_metadata = filters.PullClientInitialMetadata();
+    CHECK(pull_client_initial_metadata().ready());
+    auto push_client_to_server_message = filters.PushClientToServerMessage(
+        Arena::MakePooled<Message>(SliceBuffer(), 0));
+    CHECK(push_client_to_server_message().pending());
+    auto pull_client_to_server_message = filters.PullClientToServerMessage();
+    CHECK(pull_client_to_server_message().ready());
+    CHECK(push_client_to_server_message().ready());
+    auto push_server_initial_metadata =
+        filters.PushServerInitialMetadata(Arena::MakePooled<ServerMetadata>());
+    CHECK(push_server_initial_metadata().pending());
+    auto pull_server_initial_metadata = filters.PullServerInitialMetadata();
+    CHECK(pull_server_initial_metadata().ready());
+    CHECK(push_server_initial_metadata().ready());
+    auto push_server_to_client_message = filters.PushServerToClientMessage(
+        Arena::MakePooled<Message>(SliceBuffer(), 0));
+    CHECK(push_server_to_client_message().pending());
+    auto pull_server_to_client_message = filters.PullServerToClientMessage();
+    CHECK(pull_server_to_client_message().ready());
+    CHECK(push_server_to_client_message().ready());
+    filters.PushServerTrailingMetadata(Arena::MakePooled<ServerMetadata>());
+    auto pull_server_trailing_metadata = filters.PullServerTrailingMetadata();
+    CHECK(pull_server_trailing_metadata().ready());
+    filters.Finalize(nullptr);
+  }
+}
+
+void BM_UnaryCallInstantFilters(benchmark::State& state) {
+  Filters f;
+  CallFilters::StackBuilder builder;
+  builder.Add(&f.f0);
+  builder.Add(&f.f1);
+  builder.Add(&f.f2);
+  builder.Add(&f.f3);
+  builder.Add(&f.f4);
+  builder.Add(&f.f5);
+  RunUnaryCalls(state, builder.Build());
+}
+BENCHMARK(BM_UnaryCallInstantFilters);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
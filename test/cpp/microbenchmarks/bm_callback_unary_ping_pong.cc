@@ -48,6 +48,20 @@ BENCHMARK_TEMPLATE(BM_CallbackUnaryPingPong, MinInProcess, NoOpMutator,
                    NoOpMutator)
     ->Apply(SweepSizesArgs);
 
+// Unary ping pong with large nested requests, with and without the arena
+// message allocator
+static void SweepNestedEntriesArgs(benchmark::internal::Benchmark* b) {
+  for (int i = 16; i <= 4096; i *= 16) {
+    // First argument is the number of nested entries of the request
+    // Second argument is the message size of response
+    b->Args({i, 0});
+  }
+}
+BENCHMARK_TEMPLATE(BM_CallbackUnaryPingPongNestedMessages, InProcess, false)
+    ->Apply(SweepNestedEntriesArgs);
+BENCHMARK_TEMPLATE(BM_CallbackUnaryPingPongNestedMessages, InProcess, true)
+    ->Apply(SweepNestedEntriesArgs);
+
 // Client context with different metadata
 BENCHMARK_TEMPLATE(BM_CallbackUnaryPingPong, InProcess,
                    Client_AddMetadata<RandomBinaryMetadata<10>, 1>, NoOpMutator)
@@ -0,0 +1,188 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmark the spawns and wakeups of party participants
+
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/promise/activity.h"
+#include "src/core/lib/promise/context.h"
+#include "src/core/lib/promise/party.h"
+#include "src/core/lib/promise/poll.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+class BenchmarkParty final : public Party {
+ public:
+  BenchmarkParty() : Party(1) {}
+  std::string DebugTag() const override { return "BenchmarkParty"; }
+
+  void PartyOver() override {
+    CancelRemainingParticipants();
+    delete this;
+  }
+
+ private:
+  grpc_event_engine::experimental::EventEngine* event_engine() const final {
+    return ee_.get();
+  }
+
+  std::shared_ptr<grpc_event_engine::experimental::EventEngine> ee_ =
+      grpc_event_engine::experimental::GetDefaultEventEngine();
+};
+
+// A participant that stays pending until it is stopped, and that is woken up
+// by the thread that spawned it.
+class WokenParticipant {
+ public:
+  void Spawn(Party* party, PartyPriority priority = PartyPriority::kNormal) {
+    party->Spawn(
+        "woken", [this]() { return PollOnce(); },
+        [this](Empty) { done_.store(true, std::memory_order_release); },
+        priority);
+    WaitForPoll(0);
+  }
+
+  // Wakes up the participant, and waits for the party to poll it.
+  void WakeupAndWait() {
+    const uint64_t polls = polls_.load(std::memory_order_acquire);
+    Wakeup();
+    WaitForPoll(polls);
+  }
+
+  // Wakes up the participant without waiting. Must not be called again before
+  // the party polls it.
+  void Wakeup() { std::exchange(waker_, Waker()).Wakeup(); }
+
+  // Completes the participant.
+  void Stop() {
+    stop_.store(true, std::memory_order_relaxed);
+    Wakeup();
+    while (!done_.load(std::memory_order_acquire)) {
+    }
+  }
+
+ private:
+  Poll<Empty> PollOnce() {
+    if (stop_.load(std::memory_order_relaxed)) return Empty{};
+    waker_ = GetContext<Activity>()->MakeOwningWaker();
+    polls_.fetch_add(1, std::memory_order_release);
+    return Pending{};
+  }
+
+  void WaitForPoll(uint64_t polls) {
+    while (polls_.load(std::memory_order_acquire) == polls) {
+    }
+  }
+
+  // Written by the party when it polls the participant, and read by the
+  // spawning thread once it sees the poll.
+  Waker waker_;
+  std::atomic<uint64_t> polls_{0};
+  std::atomic<bool> stop_{false};
+  std::atomic<bool> done_{false};
+};
+
+void BM_PartySpawn(benchmark::State& state) {
+  auto party = MakeRefCounted<BenchmarkParty>();
+  for (auto _ : state) {
+    party->Spawn(
+        "spawn", []() { return Empty{}; }, [](Empty) {});
+  }
+}
+BENCHMARK(BM_PartySpawn);
+
+// Wakes up each participant of a party in turn: the participants beyond the
+// first sixteen are tracked by the overflow state words.
+void BM_PartyWakeup(benchmark::State& state) {
+  auto party = MakeRefCounted<BenchmarkParty>();
+  std::vector<WokenParticipant> participants(state.range(0));
+  for (auto& participant : participants) participant.Spawn(party.get());
+  for (auto _ : state) {
+    for (auto& participant : participants) participant.WakeupAndWait();
+  }
+  for (auto& participant : participants) participant.Stop();
+  state.SetItemsProcessed(state.iterations() * participants.size());
+}
+BENCHMARK(BM_PartyWakeup)->Arg(1)->Arg(16)->Arg(17)->Arg(64);
+
+// Wakes up all the participants of a party from inside one of them, so that
+// they are polled in a single round, lane by lane.
+void BM_PartyWakeupFromParticipant(benchmark::State& state) {
+  auto party = MakeRefCounted<BenchmarkParty>();
+  std::vector<WokenParticipant> participants(state.range(0));
+  for (size_t i = 0; i < participants.size(); i++) {
+    participants[i].Spawn(party.get(), i % 2 == 0 ? PartyPriority::kBulk
+                                                  : PartyPriority::kUrgent);
+  }
+  for (auto _ : state) {
+    std::atomic<bool> done{false};
+    party->Spawn(
+        "wakeup_all",
+        [&participants]() {
+          for (auto& participant : participants) participant.Wakeup();
+          return Empty{};
+        },
+        [&done](Empty) { done.store(true, std::memory_order_release); });
+    while (!done.load(std::memory_order_acquire)) {
+    }
+  }
+  for (auto& participant : participants) participant.Stop();
+  state.SetItemsProcessed(state.iterations() * participants.size());
+}
+BENCHMARK(BM_PartyWakeupFromParticipant)->Arg(8)->Arg(32);
+
+// Each benchmark thread wakes up its own participant of a shared party, so
+// that the threads contend on the party's state word and run each other's
+// wakeups.
+void BM_PartyContendedWakeup(benchmark::State& state) {
+  // Shared by the threads of all the runs: each run leaves it with no
+  // participant.
+  static Party* const party = new BenchmarkParty();
+  WokenParticipant participant;
+  participant.Spawn(party);
+  for (auto _ : state) {
+    participant.WakeupAndWait();
+  }
+  participant.Stop();
+}
+BENCHMARK(BM_PartyContendedWakeup)->ThreadRange(1, 32);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,166 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmark the evaluation of RBAC policies by GrpcAuthorizationEngine, which
+// compiles them, against the evaluation of the AuthorizationMatcher trees.
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "absl/log/check.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_format.h"
+
+#include <grpc/grpc.h>
+#include <grpc/grpc_security_constants.h>
+
+#include "src/core/lib/matchers/matchers.h"
+#include "src/core/lib/security/authorization/grpc_authorization_engine.h"
+#include "src/core/lib/security/authorization/matchers.h"
+#include "src/core/lib/security/authorization/rbac_policy.h"
+#include "test/core/test_util/evaluate_args_test_util.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr int kPathsPerPolicy = 4;
+
+std::string MethodPath(int policy, int method) {
+  return absl::StrCat("/package", policy, ".Service/Method", method);
+}
+
+std::string PrincipalName(int policy) {
+  return absl::StrCat("spiffe://example.com/ns/default/sa/client", policy);
+}
+
+// Policies like the ones translated from gRPC authorization policies: each of
+// them allows a few methods to a principal, with a header constraint.
+std::map<std::string, Rbac::Policy> MakePolicies(int num_policies) {
+  std::map<std::string, Rbac::Policy> policies;
+  for (int i = 0; i < num_policies; ++i) {
+    std::vector<std::unique_ptr<Rbac::Permission>> paths;
+    for (int j = 0; j < kPathsPerPolicy; ++j) {
+      paths.push_back(std::make_unique<Rbac::Permission>(
+          Rbac::Permission::MakePathPermission(
+              StringMatcher::Create(StringMatcher::Type::kExact,
+                                    MethodPath(i, j))
+                  .value())));
+    }
+    std::vector<std::unique_ptr<Rbac::Permission>> headers;
+    for (const char* value : {"prod", "canary"}) {
+      headers.push_back(std::make_unique<Rbac::Permission>(
+          Rbac::Permission::MakeHeaderPermission(
+              HeaderMatcher::Create("x-env", HeaderMatcher::Type::kExact,
+                                    value)
+                  .value())));
+    }
+    std::vector<std::unique_ptr<Rbac::Permission>> permissions;
+    permissions.push_back(std::make_unique<Rbac::Permission>(
+        Rbac::Permission::MakeOrPermission(std::move(paths))));
+    permissions.push_back(std::make_unique<Rbac::Permission>(
+        Rbac::Permission::MakeOrPermission(std::move(headers))));
+    std::vector<std::unique_ptr<Rbac::Principal>> principals;
+    principals.push_back(std::make_unique<Rbac::Principal>(
+        Rbac::Principal::MakeAuthenticatedPrincipal(
+            StringMatcher::Create(StringMatcher::Type::kExact,
+                                  PrincipalName(i))
+                .value())));
+    // Zero-padded, so that the policies are evaluated in index order.
+    policies[absl::StrFormat("policy%04d", i)] = Rbac::Policy(
+        Rbac::Permission::MakeAndPermission(std::move(permissions)),
+        Rbac::Principal::MakeOrPrincipal(std::move(principals)));
+  }
+  return policies;
+}
+
+// A request matching the last policy, the worst case.
+class Request {
+ public:
+  explicit Request(int num_policies) {
+    path_ = MethodPath(num_policies - 1, kPathsPerPolicy - 1);
+    principal_ = PrincipalName(num_policies - 1);
+    util_.AddPairToMetadata(":path", path_.c_str());
+    util_.AddPairToMetadata("x-env", "canary");
+    util_.AddPropertyToAuthContext(GRPC_TRANSPORT_SECURITY_TYPE_PROPERTY_NAME,
+                                   GRPC_TLS_TRANSPORT_SECURITY_TYPE);
+    util_.AddPropertyToAuthContext(GRPC_PEER_URI_PROPERTY_NAME,
+                                   principal_.c_str());
+  }
+
+  // The channel args are shared by the requests of a benchmark, like the
+  // calls of a channel.
+  EvaluateArgs MakeEvaluateArgs() { return util_.MakeEvaluateArgs(); }
+
+ private:
+  std::string path_;
+  std::string principal_;
+  EvaluateArgsTestUtil util_;
+};
+
+void BM_CompiledPolicies(benchmark::State& state) {
+  GrpcAuthorizationEngine engine(Rbac(
+      "authz", Rbac::Action::kAllow, MakePolicies(state.range(0))));
+  Request request(state.range(0));
+  EvaluateArgs args = request.MakeEvaluateArgs();
+  for (auto _ : state) {
+    auto decision = engine.Evaluate(args);
+    CHECK(decision.type == AuthorizationEngine::Decision::Type::kAllow);
+  }
+}
+BENCHMARK(BM_CompiledPolicies)->Arg(10)->Arg(100)->Arg(500);
+
+void BM_MatcherTrees(benchmark::State& state) {
+  std::vector<std::unique_ptr<AuthorizationMatcher>> matchers;
+  for (auto& p : MakePolicies(state.range(0))) {
+    matchers.push_back(
+        std::make_unique<PolicyAuthorizationMatcher>(std::move(p.second)));
+  }
+  Request request(state.range(0));
+  EvaluateArgs args = request.MakeEvaluateArgs();
+  for (auto _ : state) {
+    bool matches = false;
+    for (const auto& matcher : matchers) {
+      if (matcher->Matches(args)) {
+        matches = true;
+        break;
+      }
+    }
+    CHECK(matches);
+  }
+}
+BENCHMARK(BM_MatcherTrees)->Arg(10)->Arg(100)->Arg(500);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  grpc_init();
+  benchmark::RunTheBenchmarksNamespaced();
+  grpc_shutdown();
+  return 0;
+}
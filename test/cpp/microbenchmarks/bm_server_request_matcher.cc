@@ -0,0 +1,185 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmark the matching of the incoming calls of a single registered method
+// with the calls that the application requests, from many threads at once.
+// Each thread requests the calls of the method on its own completion queue,
+// like the threads of an async server, and starts calls of the method on its
+// own channel, so that the calls are spread over the completion queues.
+
+#include <stdint.h>
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "absl/log/check.h"
+
+#include <grpc/grpc.h>
+#include <grpc/support/time.h>
+
+#include "src/core/ext/transport/inproc/inproc_transport.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr char kMethod[] = "/grpc.testing.EchoTestService/Echo";
+
+void* Tag(intptr_t t) { return reinterpret_cast<void*>(t); }
+
+void ExpectTag(grpc_completion_queue* cq, void* tag) {
+  grpc_event ev = grpc_completion_queue_next(
+      cq, gpr_inf_future(GPR_CLOCK_MONOTONIC), nullptr);
+  CHECK_EQ(ev.type, GRPC_OP_COMPLETE);
+  CHECK_EQ(ev.tag, tag);
+  CHECK(ev.success);
+}
+
+void ShutdownAndDestroy(grpc_completion_queue* cq) {
+  grpc_completion_queue_shutdown(cq);
+  while (grpc_completion_queue_next(cq, gpr_inf_future(GPR_CLOCK_MONOTONIC),
+                                    nullptr)
+             .type != GRPC_QUEUE_SHUTDOWN) {
+  }
+  grpc_completion_queue_destroy(cq);
+}
+
+struct ThreadState {
+  grpc_completion_queue* server_cq;
+  grpc_completion_queue* client_cq;
+  grpc_channel* channel;
+  void* registered_call;
+};
+
+grpc_server* g_server;
+void* g_registered_method;
+std::vector<ThreadState> g_threads;
+
+void SetUp(int num_threads) {
+  g_server = grpc_server_create(nullptr, nullptr);
+  g_registered_method = grpc_server_register_method(
+      g_server, kMethod, nullptr, GRPC_SRM_PAYLOAD_NONE, 0);
+  g_threads.resize(num_threads);
+  for (ThreadState& thread : g_threads) {
+    thread.server_cq = grpc_completion_queue_create_for_next(nullptr);
+    grpc_server_register_completion_queue(g_server, thread.server_cq, nullptr);
+  }
+  grpc_server_start(g_server);
+  for (ThreadState& thread : g_threads) {
+    thread.client_cq = grpc_completion_queue_create_for_next(nullptr);
+    thread.channel = grpc_inproc_channel_create(g_server, nullptr, nullptr);
+    thread.registered_call =
+        grpc_channel_register_call(thread.channel, kMethod, nullptr, nullptr);
+  }
+}
+
+void TearDown() {
+  grpc_server_shutdown_and_notify(g_server, g_threads[0].server_cq, Tag(0));
+  ExpectTag(g_threads[0].server_cq, Tag(0));
+  grpc_server_destroy(g_server);
+  for (ThreadState& thread : g_threads) {
+    grpc_channel_destroy(thread.channel);
+    ShutdownAndDestroy(thread.client_cq);
+    ShutdownAndDestroy(thread.server_cq);
+  }
+  g_threads.clear();
+}
+
+// One unary call without messages: the server side requests the call, the
+// client side starts it, and the server side finishes it once matched.
+void RunCall(ThreadState& thread) {
+  grpc_call* server_call;
+  gpr_timespec deadline;
+  grpc_metadata_array request_metadata;
+  grpc_metadata_array_init(&request_metadata);
+  CHECK_EQ(grpc_server_request_registered_call(
+               g_server, g_registered_method, &server_call, &deadline,
+               &request_metadata, nullptr, thread.server_cq, thread.server_cq,
+               Tag(1)),
+           GRPC_CALL_OK);
+
+  grpc_call* client_call = grpc_channel_create_registered_call(
+      thread.channel, nullptr, GRPC_PROPAGATE_DEFAULTS, thread.client_cq,
+      thread.registered_call, gpr_inf_future(GPR_CLOCK_MONOTONIC), nullptr);
+  grpc_metadata_array initial_metadata;
+  grpc_metadata_array trailing_metadata;
+  grpc_metadata_array_init(&initial_metadata);
+  grpc_metadata_array_init(&trailing_metadata);
+  grpc_status_code status;
+  grpc_slice details;
+  grpc_op client_ops[4] = {};
+  client_ops[0].op = GRPC_OP_SEND_INITIAL_METADATA;
+  client_ops[1].op = GRPC_OP_SEND_CLOSE_FROM_CLIENT;
+  client_ops[2].op = GRPC_OP_RECV_INITIAL_METADATA;
+  client_ops[2].data.recv_initial_metadata.recv_initial_metadata =
+      &initial_metadata;
+  client_ops[3].op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+  client_ops[3].data.recv_status_on_client.trailing_metadata =
+      &trailing_metadata;
+  client_ops[3].data.recv_status_on_client.status = &status;
+  client_ops[3].data.recv_status_on_client.status_details = &details;
+  CHECK_EQ(grpc_call_start_batch(client_call, client_ops, 4, Tag(2), nullptr),
+           GRPC_CALL_OK);
+
+  // The requested call may be matched with the call of another thread.
+  ExpectTag(thread.server_cq, Tag(1));
+  int cancelled;
+  grpc_op server_ops[3] = {};
+  server_ops[0].op = GRPC_OP_SEND_INITIAL_METADATA;
+  server_ops[1].op = GRPC_OP_SEND_STATUS_FROM_SERVER;
+  server_ops[1].data.send_status_from_server.status = GRPC_STATUS_OK;
+  server_ops[2].op = GRPC_OP_RECV_CLOSE_ON_SERVER;
+  server_ops[2].data.recv_close_on_server.cancelled = &cancelled;
+  CHECK_EQ(grpc_call_start_batch(server_call, server_ops, 3, Tag(3), nullptr),
+           GRPC_CALL_OK);
+  ExpectTag(thread.server_cq, Tag(3));
+  grpc_call_unref(server_call);
+  grpc_metadata_array_destroy(&request_metadata);
+
+  ExpectTag(thread.client_cq, Tag(2));
+  CHECK_EQ(status, GRPC_STATUS_OK);
+  grpc_call_unref(client_call);
+  grpc_slice_unref(details);
+  grpc_metadata_array_destroy(&initial_metadata);
+  grpc_metadata_array_destroy(&trailing_metadata);
+}
+
+void BM_RegisteredMethodCalls(benchmark::State& state) {
+  if (state.thread_index() == 0) SetUp(state.threads());
+  for (auto _ : state) {
+    RunCall(g_threads[state.thread_index()]);
+  }
+  state.SetItemsProcessed(state.iterations());
+  if (state.thread_index() == 0) TearDown();
+}
+BENCHMARK(BM_RegisteredMethodCalls)->ThreadRange(1, 64)->UseRealTime();
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  grpc_init();
+  benchmark::RunTheBenchmarksNamespaced();
+  grpc_shutdown();
+  return 0;
+}
@@ -0,0 +1,174 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares the posix EventEngine timer structures with a large number of
+// outstanding timers, most of which get cancelled before they fire (as call
+// deadlines and keepalive timers do).
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <grpc/event_engine/event_engine.h>
+
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+#include "src/core/lib/gprpp/time.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc {
+namespace testing {
+
+using grpc_event_engine::experimental::EventEngine;
+using grpc_event_engine::experimental::Timer;
+using grpc_event_engine::experimental::TimerListHost;
+
+class ManualClockHost final : public TimerListHost {
+ public:
+  grpc_core::Timestamp Now() override { return now_; }
+  void Kick() override {}
+
+  void Advance(grpc_core::Duration d) { now_ = now_ + d; }
+
+ private:
+  grpc_core::Timestamp now_ =
+      grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(1000);
+};
+
+// A timer together with the closure it runs, so that fired closures can be
+// mapped back to their timer.
+struct TimerEntry final : public EventEngine::Closure {
+  void Run() override {}
+  Timer timer;
+};
+
+// Keeps num_timers timers outstanding, with deadlines between one second and
+// one hour out.
+template <class TimerListType>
+class Fixture {
+ public:
+  explicit Fixture(size_t num_timers)
+      : timer_list_(&host_), entries_(num_timers) {
+    for (TimerEntry& entry : entries_) Arm(&entry);
+  }
+
+  ~Fixture() {
+    for (TimerEntry& entry : entries_) {
+      if (entry.timer.pending) (void)timer_list_.TimerCancel(&entry.timer);
+    }
+  }
+
+  void Arm(TimerEntry* entry) {
+    timer_list_.TimerInit(&entry->timer, RandomDeadline(), entry);
+  }
+
+  grpc_core::Timestamp RandomDeadline() {
+    return host_.Now() + grpc_core::Duration::Milliseconds(delay_(rng_));
+  }
+
+  ManualClockHost& host() { return host_; }
+  TimerListType& timer_list() { return timer_list_; }
+  std::vector<TimerEntry>& entries() { return entries_; }
+
+ private:
+  ManualClockHost host_;
+  TimerListType timer_list_;
+  std::vector<TimerEntry> entries_;
+  std::mt19937 rng_{0};
+  std::uniform_int_distribution<int64_t> delay_{1000, 3600 * 1000};
+};
+
+// Adding and cancelling a deadline timer: the common case for every RPC.
+template <class TimerListType>
+static void BM_TimerInitCancel(benchmark::State& state) {
+  Fixture<TimerListType> fixture(state.range(0));
+  TimerEntry entry;
+  for (auto _ : state) {
+    fixture.Arm(&entry);
+    benchmark::DoNotOptimize(fixture.timer_list().TimerCancel(&entry.timer));
+  }
+}
+BENCHMARK_TEMPLATE(BM_TimerInitCancel,
+                   grpc_event_engine::experimental::TimerList)
+    ->Arg(1000)
+    ->Arg(1000000);
+BENCHMARK_TEMPLATE(BM_TimerInitCancel,
+                   grpc_event_engine::experimental::TimerWheel)
+    ->Arg(1000)
+    ->Arg(1000000);
+
+// Cancel a random outstanding timer and re-arm it, as a keepalive or idle
+// timer is reset on activity.
+template <class TimerListType>
+static void BM_TimerReset(benchmark::State& state) {
+  Fixture<TimerListType> fixture(state.range(0));
+  std::mt19937 rng(1);
+  std::uniform_int_distribution<size_t> pick(0, fixture.entries().size() - 1);
+  for (auto _ : state) {
+    TimerEntry* entry = &fixture.entries()[pick(rng)];
+    benchmark::DoNotOptimize(fixture.timer_list().TimerCancel(&entry->timer));
+    fixture.Arm(entry);
+  }
+}
+BENCHMARK_TEMPLATE(BM_TimerReset, grpc_event_engine::experimental::TimerList)
+    ->Arg(1000)
+    ->Arg(1000000);
+BENCHMARK_TEMPLATE(BM_TimerReset, grpc_event_engine::experimental::TimerWheel)
+    ->Arg(1000)
+    ->Arg(1000000);
+
+// Advance the clock by a millisecond per iteration and collect expired
+// timers, re-arming each one that fired.
+template <class TimerListType>
+static void BM_TimerCheck(benchmark::State& state) {
+  Fixture<TimerListType> fixture(state.range(0));
+  int64_t fired = 0;
+  for (auto _ : state) {
+    fixture.host().Advance(grpc_core::Duration::Milliseconds(1));
+    auto expired = fixture.timer_list().TimerCheck(nullptr);
+    if (!expired.has_value()) continue;
+    fired += expired->size();
+    for (EventEngine::Closure* closure : *expired) {
+      fixture.Arm(static_cast<TimerEntry*>(closure));
+    }
+  }
+  state.counters["fired"] = fired;
+}
+BENCHMARK_TEMPLATE(BM_TimerCheck, grpc_event_engine::experimental::TimerList)
+    ->Arg(1000)
+    ->Arg(1000000);
+BENCHMARK_TEMPLATE(BM_TimerCheck, grpc_event_engine::experimental::TimerWheel)
+    ->Arg(1000)
+    ->Arg(1000000);
+
+}  // namespace testing
+}  // namespace grpc
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
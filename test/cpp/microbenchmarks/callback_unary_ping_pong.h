@@ -27,6 +27,8 @@
 
 #include "absl/log/check.h"
 
+#include <grpcpp/support/proto_arena_message_allocator.h>
+
 #include "src/proto/grpc/testing/echo.grpc.pb.h"
 #include "test/cpp/microbenchmarks/callback_test_service.h"
 #include "test/cpp/microbenchmarks/fullstack_context_mutators.h"
@@ -96,6 +98,44 @@ static void BM_CallbackUnaryPingPong(benchmark::State& state) {
                           response_msgs_size * state.iterations());
 }
 
+// Unary ping pong with requests of state.range(0) nested entries, allocated
+// on a protobuf arena by the server if kUseArenaAllocator.
+template <class Fixture, bool kUseArenaAllocator>
+static void BM_CallbackUnaryPingPongNestedMessages(benchmark::State& state) {
+  int num_entries = state.range(0);
+  CallbackStreamingTestService service;
+  // Outlives the server.
+  ProtoArenaMessageAllocator<EchoRequest, EchoResponse> allocator;
+  if (kUseArenaAllocator) {
+    service.SetMessageAllocatorFor_Echo(&allocator);
+  }
+  std::unique_ptr<Fixture> fixture(new Fixture(&service));
+  std::unique_ptr<EchoTestService::Stub> stub_(
+      EchoTestService::NewStub(fixture->channel()));
+  EchoRequest request;
+  EchoResponse response;
+  ClientContext cli_ctx;
+
+  DebugInfo* debug_info = request.mutable_param()->mutable_debug_info();
+  for (int i = 0; i < num_entries; i++) {
+    debug_info->add_stack_entries(std::string(64, 'a'));
+  }
+
+  std::mutex mu;
+  std::condition_variable cv;
+  bool done = false;
+  if (state.KeepRunning()) {
+    SendCallbackUnaryPingPong(&state, &cli_ctx, &request, &response,
+                              stub_.get(), &done, &mu, &cv);
+  }
+  std::unique_lock<std::mutex> l(mu);
+  while (!done) {
+    cv.wait(l);
+  }
+  fixture.reset();
+  state.SetBytesProcessed(request.ByteSizeLong() * state.iterations());
+}
+
 }  // namespace testing
 }  // namespace grpc
 
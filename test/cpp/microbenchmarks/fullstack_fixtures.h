@@ -19,6 +19,12 @@
 #ifndef GRPC_TEST_CPP_MICROBENCHMARKS_FULLSTACK_FIXTURES_H
 #define GRPC_TEST_CPP_MICROBENCHMARKS_FULLSTACK_FIXTURES_H
 
+#include <grpc/support/port_platform.h>
+
+#ifdef GPR_SUPPORT_CHANNELS_FROM_FD
+#include <sys/socket.h>
+#endif
+
 #include "absl/log/check.h"
 
 #include <grpc/grpc.h>
@@ -32,6 +38,7 @@
 #include <grpcpp/server_builder.h>
 
 #include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
+#include "src/core/ext/transport/shm/shm_transport.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/config/core_configuration.h"
 #include "src/core/lib/gprpp/crash.h"
@@ -257,6 +264,56 @@ class SockPair : public EndpointPairFixture {
                             fixture_configuration) {}
 };
 
+#ifdef GPR_SUPPORT_CHANNELS_FROM_FD
+// Shared memory transport between a client and server that are joined by a
+// Unix socketpair.
+// Requires the chaotic_good experiment (and its promise based call
+// dependencies) to be enabled.
+class SharedMemory : public BaseFixture {
+ public:
+  explicit SharedMemory(Service* service,
+                        const FixtureConfiguration& fixture_configuration =
+                            FixtureConfiguration()) {
+    ServerBuilder b;
+    cq_ = b.AddCompletionQueue(true);
+    b.RegisterService(service);
+    fixture_configuration.ApplyCommonServerBuilderConfig(&b);
+    server_ = b.BuildAndStart();
+    int fds[2];
+    CHECK_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+    grpc_server_add_shm_channel_from_fd(server_->c_server(), fds[1]);
+    ChannelArguments args;
+    args.SetString(GRPC_ARG_DEFAULT_AUTHORITY, "test.authority");
+    fixture_configuration.ApplyCommonChannelArguments(&args);
+    grpc_channel_args c_args;
+    args.SetChannelArgs(&c_args);
+    grpc_channel* channel =
+        grpc_shm_channel_create_from_fd("target", fds[0], &c_args);
+    channel_ = grpc::CreateChannelInternal(
+        "", channel,
+        std::vector<std::unique_ptr<
+            experimental::ClientInterceptorFactoryInterface>>());
+  }
+
+  ~SharedMemory() override {
+    server_->Shutdown(grpc_timeout_milliseconds_to_deadline(0));
+    cq_->Shutdown();
+    void* tag;
+    bool ok;
+    while (cq_->Next(&tag, &ok)) {
+    }
+  }
+
+  ServerCompletionQueue* cq() { return cq_.get(); }
+  std::shared_ptr<Channel> channel() { return channel_; }
+
+ private:
+  std::unique_ptr<Server> server_;
+  std::unique_ptr<ServerCompletionQueue> cq_;
+  std::shared_ptr<Channel> channel_;
+};
+#endif  // GPR_SUPPORT_CHANNELS_FROM_FD
+
 ////////////////////////////////////////////////////////////////////////////////
 // Minimal stack fixtures
 
@@ -283,6 +340,9 @@ typedef MinStackize<TCP> MinTCP;
 typedef MinStackize<UDS> MinUDS;
 typedef MinStackize<InProcess> MinInProcess;
 typedef MinStackize<SockPair> MinSockPair;
+#ifdef GPR_SUPPORT_CHANNELS_FROM_FD
+typedef MinStackize<SharedMemory> MinSharedMemory;
+#endif
 
 }  // namespace testing
 }  // namespace grpc
@@ -0,0 +1,143 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <grpc/grpc.h>
+#include <grpc/slice.h>
+#include <grpc/support/time.h>
+#include <grpcpp/impl/completion_queue_tag.h>
+#include <grpcpp/support/callback_common.h>
+
+#include "test/core/test_util/test_config.h"
+
+namespace grpc {
+namespace testing {
+namespace {
+
+using internal::CallbackWithSuccessTag;
+using internal::InlineReactionBudget;
+
+TEST(InlineReactionBudgetTest, FastReactionsStayInline) {
+  InlineReactionBudget budget("/svc/Method", std::chrono::milliseconds(1));
+  EXPECT_TRUE(budget.inlineable());
+  budget.Record(std::chrono::microseconds(10));
+  budget.Record(std::chrono::milliseconds(1));
+  EXPECT_TRUE(budget.inlineable());
+}
+
+TEST(InlineReactionBudgetTest, SlowReactionDemotesForGood) {
+  InlineReactionBudget budget("/svc/Method", std::chrono::milliseconds(1));
+  budget.Record(std::chrono::milliseconds(2));
+  EXPECT_FALSE(budget.inlineable());
+  budget.Record(std::chrono::microseconds(10));
+  EXPECT_FALSE(budget.inlineable());
+}
+
+// Stands in for the ops of a reaction.
+class FakeOps : public internal::CompletionQueueTag {
+ public:
+  bool FinalizeResult(void** /*tag*/, bool* /*status*/) override {
+    return true;
+  }
+};
+
+class CallbackWithSuccessTagTest : public ::testing::Test {
+ protected:
+  CallbackWithSuccessTagTest() {
+    cq_ = grpc_completion_queue_create_for_next(nullptr);
+    channel_ = grpc_lame_client_channel_create(
+        "localhost", GRPC_STATUS_UNAVAILABLE, "lame");
+    grpc_slice method = grpc_slice_from_static_string("/svc/Method");
+    call_ = grpc_channel_create_call(channel_, nullptr, GRPC_PROPAGATE_DEFAULTS,
+                                     cq_, method, nullptr,
+                                     gpr_inf_future(GPR_CLOCK_REALTIME),
+                                     nullptr);
+  }
+
+  ~CallbackWithSuccessTagTest() override {
+    grpc_call_unref(call_);
+    grpc_channel_destroy(channel_);
+    grpc_completion_queue_shutdown(cq_);
+    while (grpc_completion_queue_next(cq_, gpr_inf_future(GPR_CLOCK_REALTIME),
+                                      nullptr)
+               .type != GRPC_QUEUE_SHUTDOWN) {
+    }
+    grpc_completion_queue_destroy(cq_);
+  }
+
+  // Completes the operation of tag, as the completion queue would.
+  static void Complete(CallbackWithSuccessTag* tag) {
+    tag->functor_run(tag, /*ok=*/1);
+  }
+
+  grpc_completion_queue* cq_;
+  grpc_channel* channel_;
+  grpc_call* call_;
+  FakeOps ops_;
+};
+
+TEST_F(CallbackWithSuccessTagTest, MethodsWithoutBudgetAreNotInlined) {
+  CallbackWithSuccessTag tag;
+  tag.Set(call_, [](bool) {}, &ops_, /*budget=*/nullptr);
+  EXPECT_FALSE(tag.inlineable);
+}
+
+TEST_F(CallbackWithSuccessTagTest, SlowReactionSendsLaterOnesToExecutor) {
+  InlineReactionBudget budget("/svc/Method", std::chrono::microseconds(1));
+  int reactions = 0;
+  CallbackWithSuccessTag tag;
+  tag.Set(
+      call_,
+      [&reactions](bool ok) {
+        EXPECT_TRUE(ok);
+        ++reactions;
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+      },
+      &ops_, &budget);
+  // The first reaction runs inline and goes over the budget.
+  EXPECT_TRUE(tag.inlineable);
+  Complete(&tag);
+  EXPECT_EQ(reactions, 1);
+  EXPECT_FALSE(budget.inlineable());
+  // A streaming reactor reuses its tag, which notices the demotion the next
+  // time it runs: the operations after that one go to the executor.
+  Complete(&tag);
+  EXPECT_EQ(reactions, 2);
+  EXPECT_FALSE(tag.inlineable);
+  // So do the reactions of the other calls of the method.
+  CallbackWithSuccessTag other_tag;
+  other_tag.Set(call_, [](bool) {}, &ops_, &budget);
+  EXPECT_FALSE(other_tag.inlineable);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
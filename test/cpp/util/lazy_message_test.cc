@@ -0,0 +1,141 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <grpc/grpc.h>
+#include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/support/lazy_message.h>
+#include <grpcpp/support/slice.h>
+
+#include "src/proto/grpc/testing/echo_messages.pb.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc {
+namespace {
+
+using testing::EchoRequest;
+
+class LazyMessageTest : public ::testing::Test {
+ protected:
+  static void SetUpTestSuite() { grpc_init(); }
+
+  static void TearDownTestSuite() { grpc_shutdown(); }
+
+  static EchoRequest MakeRequest() {
+    EchoRequest request;
+    request.set_message(std::string(4096, 'a'));
+    request.mutable_param()->set_echo_peer(true);
+    request.mutable_param()->mutable_debug_info()->set_detail("detail");
+    return request;
+  }
+
+  // Returns a message as received by a call.
+  static LazyMessage<EchoRequest> Receive(const EchoRequest& request) {
+    Slice slice(request.SerializeAsString());
+    ByteBuffer buffer(&slice, 1);
+    LazyMessage<EchoRequest> message;
+    EXPECT_TRUE(SerializationTraits<LazyMessage<EchoRequest>>::Deserialize(
+                    &buffer, &message)
+                    .ok());
+    buffer.Release();
+    return message;
+  }
+};
+
+TEST_F(LazyMessageTest, Parse) {
+  EchoRequest request = MakeRequest();
+  LazyMessage<EchoRequest> message = Receive(request);
+  EXPECT_EQ(message.Length(), request.ByteSizeLong());
+  EchoRequest parsed;
+  ASSERT_TRUE(message.Parse(&parsed).ok());
+  EXPECT_EQ(parsed.SerializeAsString(), request.SerializeAsString());
+  // The serialized message is kept.
+  EXPECT_EQ(message.Length(), request.ByteSizeLong());
+}
+
+TEST_F(LazyMessageTest, ParseFields) {
+  EchoRequest request = MakeRequest();
+  LazyMessage<EchoRequest> message = Receive(request);
+  EchoRequest parsed;
+  ASSERT_TRUE(message.ParseFields({2}, &parsed).ok());
+  EXPECT_TRUE(parsed.message().empty());
+  EXPECT_EQ(parsed.param().SerializeAsString(),
+            request.param().SerializeAsString());
+  ASSERT_TRUE(message.ParseFields({1}, &parsed).ok());
+  EXPECT_EQ(parsed.message(), request.message());
+  EXPECT_FALSE(parsed.has_param());
+}
+
+TEST_F(LazyMessageTest, ParseInvalidMessage) {
+  Slice slice(std::string("\x0a\x10truncated"));
+  ByteBuffer buffer(&slice, 1);
+  LazyMessage<EchoRequest> message;
+  ASSERT_TRUE(
+      SerializationTraits<LazyMessage<EchoRequest>>::Deserialize(&buffer,
+                                                                 &message)
+          .ok());
+  buffer.Release();
+  EchoRequest parsed;
+  EXPECT_FALSE(message.Parse(&parsed).ok());
+  EXPECT_FALSE(message.ParseFields({1}, &parsed).ok());
+}
+
+TEST_F(LazyMessageTest, ForwardWithoutCopy) {
+  LazyMessage<EchoRequest> message = Receive(MakeRequest());
+  ByteBuffer forwarded;
+  bool own_buffer;
+  ASSERT_TRUE(SerializationTraits<LazyMessage<EchoRequest>>::Serialize(
+                  message, &forwarded, &own_buffer)
+                  .ok());
+  std::vector<Slice> received_slices;
+  std::vector<Slice> forwarded_slices;
+  ASSERT_TRUE(message.buffer().Dump(&received_slices).ok());
+  ASSERT_TRUE(forwarded.Dump(&forwarded_slices).ok());
+  ASSERT_EQ(forwarded_slices.size(), received_slices.size());
+  for (size_t i = 0; i < forwarded_slices.size(); ++i) {
+    EXPECT_EQ(forwarded_slices[i].begin(), received_slices[i].begin());
+  }
+}
+
+TEST_F(LazyMessageTest, Serialize) {
+  EchoRequest request = MakeRequest();
+  LazyMessage<EchoRequest> message(request);
+  ByteBuffer serialized;
+  bool own_buffer;
+  ASSERT_TRUE(SerializationTraits<LazyMessage<EchoRequest>>::Serialize(
+                  message, &serialized, &own_buffer)
+                  .ok());
+  Slice slice;
+  ASSERT_TRUE(serialized.DumpToSingleSlice(&slice).ok());
+  EXPECT_EQ(std::string(reinterpret_cast<const char*>(slice.begin()),
+                        slice.size()),
+            request.SerializeAsString());
+}
+
+}  // namespace
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -238,6 +238,40 @@ _DATA_MEMBERS = [
         test_value_1="false",
         test_value_2="true",
     ),
+    DataMember(
+        name="session_ticket_key_provider",
+        type=(
+            "grpc_core::RefCountedPtr<grpc_core::FileWatcherSessionTicketKeyProvider>"
+        ),
+        getter_comment=(
+            "Returns the key ring of session_ticket_key_provider_ if it is set,"
+            " nullptr otherwise."
+        ),
+        override_getter="""tsi::SslSessionTicketKeyRing* session_ticket_key_ring() {
+    if (session_ticket_key_provider_ != nullptr) { return session_ticket_key_provider_->key_ring(); }
+    return nullptr;
+  }""",
+        setter_comment=(
+            "Keeps the session ticket keys of a TLS server in sync with a file,"
+            " so that all the servers given the same file can resume each"
+            " other's sessions. If not set, each server uses its own random"
+            " key."
+        ),
+        setter_move_semantics=True,
+        special_comparator=(
+            "(session_ticket_key_provider_ =="
+            " other.session_ticket_key_provider_)"
+        ),
+        test_name="DifferentSessionTicketKeyProvider",
+        test_value_1=(
+            "MakeRefCounted<FileWatcherSessionTicketKeyProvider>("
+            '"session_ticket_keys_1", 1)'
+        ),
+        test_value_2=(
+            "MakeRefCounted<FileWatcherSessionTicketKeyProvider>("
+            '"session_ticket_keys_2", 1)'
+        ),
+    ),
 ]
 
 